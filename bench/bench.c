@@ -0,0 +1,110 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "parser.h"
+#include "edid_bench.h"
+
+/**
+ * Benchmark and check driver, built as its own program next to edid_parser
+ */
+
+static const char usage[] =
+    "usage: edid_bench --bench-hex [iterations] | --bench-batch [count] | --bench-validate [count]\n"
+    "                  --bench-fixed [passes] | --bench-timings [iterations] | --bench-stages [count] [seed]\n"
+    "                  --synth [count] [seed] | --bench-corpus <file> [max_threads] | --bench-threads <file> [threads]\n"
+    "                  --bench-archive <file> | --bench-record <file> | --bench-cache <file> [memory_kb]\n"
+    "                  --bench-reparse <file> | --bench-regs <file> | --bench-tx <file> [threads]\n"
+    "                  --bench-modes <file> | --bench-view <file> | --bench-pnp <registry>\n";
+
+int main(int argc, char **argv)
+{
+    if (argc > 1 && strcmp(argv[1], "--bench-hex") == 0)
+    {
+        unsigned int iterations = argc > 2 ? (unsigned int)strtoul(argv[2], NULL, 10) : 100000;
+        return edid_bench_hex(iterations);
+    }
+    if (argc > 1 && strcmp(argv[1], "--bench-batch") == 0)
+    {
+        unsigned int count = argc > 2 ? (unsigned int)strtoul(argv[2], NULL, 10) : 100000;
+        return edid_bench_batch(count);
+    }
+    if (argc > 1 && strcmp(argv[1], "--bench-validate") == 0)
+    {
+        unsigned int count = argc > 2 ? (unsigned int)strtoul(argv[2], NULL, 10) : 4096;
+        return edid_bench_validate(count);
+    }
+    if (argc > 1 && strcmp(argv[1], "--bench-fixed") == 0)
+    {
+        unsigned int iterations = argc > 2 ? (unsigned int)strtoul(argv[2], NULL, 10) : 1000;
+        return edid_bench_fixed(iterations);
+    }
+    if (argc > 1 && strcmp(argv[1], "--bench-timings") == 0)
+    {
+        unsigned int iterations = argc > 2 ? (unsigned int)strtoul(argv[2], NULL, 10) : 1000000;
+        return edid_bench_timings(iterations);
+    }
+    if (argc > 1 && strcmp(argv[1], "--bench-stages") == 0)
+    {
+        unsigned int count = argc > 2 ? (unsigned int)strtoul(argv[2], NULL, 10) : 10000;
+        uint32_t seed = argc > 3 ? (uint32_t)strtoul(argv[3], NULL, 10) : 1;
+        return edid_bench_stages(count, seed);
+    }
+    if (argc > 1 && strcmp(argv[1], "--synth") == 0)
+    {
+        unsigned int count = argc > 2 ? (unsigned int)strtoul(argv[2], NULL, 10) : 10000;
+        uint32_t seed = argc > 3 ? (uint32_t)strtoul(argv[3], NULL, 10) : 1;
+        return edid_write_synthetic(count, seed);
+    }
+    if (argc > 2 && strcmp(argv[1], "--bench-corpus") == 0)
+    {
+        unsigned int threads = argc > 3 ? (unsigned int)strtoul(argv[3], NULL, 10) : 0;
+        return edid_bench_corpus(argv[2], threads);
+    }
+    if (argc > 2 && strcmp(argv[1], "--bench-threads") == 0)
+    {
+        unsigned int threads = argc > 3 ? (unsigned int)strtoul(argv[3], NULL, 10) : 0;
+        return edid_bench_threads(argv[2], threads);
+    }
+    if (argc > 2 && strcmp(argv[1], "--bench-archive") == 0)
+    {
+        return edid_bench_archive(argv[2]);
+    }
+    if (argc > 2 && strcmp(argv[1], "--bench-record") == 0)
+    {
+        return edid_bench_record(argv[2]);
+    }
+    if (argc > 2 && strcmp(argv[1], "--bench-cache") == 0)
+    {
+        unsigned int memory_kb = argc > 3 ? (unsigned int)strtoul(argv[3], NULL, 10) : 0;
+        return edid_bench_cache(argv[2], memory_kb);
+    }
+    if (argc > 2 && strcmp(argv[1], "--bench-reparse") == 0)
+    {
+        return edid_bench_reparse(argv[2]);
+    }
+    if (argc > 2 && strcmp(argv[1], "--bench-regs") == 0)
+    {
+        return edid_bench_regs(argv[2]);
+    }
+    if (argc > 2 && strcmp(argv[1], "--bench-tx") == 0)
+    {
+        unsigned int threads = argc > 3 ? (unsigned int)strtoul(argv[3], NULL, 10) : 0;
+        return edid_bench_tx(argv[2], threads);
+    }
+    if (argc > 2 && strcmp(argv[1], "--bench-modes") == 0)
+    {
+        return edid_bench_modes(argv[2]);
+    }
+    if (argc > 2 && strcmp(argv[1], "--bench-view") == 0)
+    {
+        return edid_bench_view(argv[2]);
+    }
+    if (argc > 2 && strcmp(argv[1], "--bench-pnp") == 0)
+    {
+        return edid_bench_pnp(argv[2]);
+    }
+
+    fputs(usage, stderr);
+    return 1;
+}
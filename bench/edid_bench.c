@@ -0,0 +1,2318 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include "parser.h"
+#include "edid_bench.h"
+#include "edid_corpus.h"
+#include "edid_archive.h"
+#include "edid_cache.h"
+#include "edid_regs.h"
+#include "edid_tx.h"
+/**
+ * Microbenchmarks for the EDID decode stages, run from the benchmark driver in bench.c
+ */
+
+static const char bench_edid_hex[] =
+    "00 FF FF FF FF FF FF 00 10 AC 79 42 4C 47 5A 42 0F 22 01 04 B5 3C 22 78 3A DF 15 AD 50 44 AD 25 "
+    "0F 50 54 A5 4B 00 D1 00 D1 C0 B3 00 A9 40 81 80 81 00 71 4F E1 C0 4D D0 00 A0 F0 70 3E 80 30 20 "
+    "35 00 55 50 21 00 00 1A 00 00 00 FF 00 32 33 5A 53 4A 30 34 0A 20 20 20 20 20 00 00 00 FC 00 44 "
+    "45 4C 4C 20 55 32 37 32 33 51 45 0A 00 00 00 FD 00 17 56 0F 8C 36 01 0A 20 20 20 20 20 20 01 2A";
+
+static uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+/*
+ * Counts heap allocations for --bench-stages. The benchmark build defines
+ * BENCH_COUNT_ALLOCATIONS and links with
+ * -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc, so every allocation the
+ * parser and the benchmarks make goes through these wrappers. The parser
+ * itself never sees them.
+ */
+#ifndef BENCH_COUNT_ALLOCATIONS
+#define BENCH_COUNT_ALLOCATIONS 0
+#endif
+
+#if BENCH_COUNT_ALLOCATIONS
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+static _Atomic uint64_t bench_allocations;
+
+void *__wrap_malloc(size_t size)
+{
+    atomic_fetch_add_explicit(&bench_allocations, 1, memory_order_relaxed);
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size)
+{
+    atomic_fetch_add_explicit(&bench_allocations, 1, memory_order_relaxed);
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+    atomic_fetch_add_explicit(&bench_allocations, 1, memory_order_relaxed);
+    return __real_realloc(ptr, size);
+}
+#endif
+
+/**
+ * The sscanf based decoder that string_to_hex() used before edid_hex_decode(),
+ * kept as the benchmark baseline.
+ */
+static size_t legacy_string_to_hex(const char *hex_string, unsigned char *edid, size_t capacity)
+{
+    size_t index = 0;
+
+    while (*hex_string && index < capacity)
+    {
+        while (*hex_string && isspace((unsigned char)*hex_string))
+        {
+            hex_string++;
+        }
+
+        if (*hex_string == '\0')
+            break;
+
+        unsigned int byte;
+        if (sscanf(hex_string, "%2x", &byte) == 1)
+        {
+            edid[index++] = (unsigned char)byte;
+            hex_string += 2;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    return index;
+}
+
+/**
+ * check_header() and verify_edid_checksum() as they were before the vector
+ * paths, kept as the benchmark baseline.
+ */
+static uint8_t legacy_validate(const unsigned char *edid)
+{
+    uint8_t status = EDID_STATUS_OK;
+    uint8_t sum = 0;
+
+    if (edid[0] != 0x00 || edid[1] != 0xFF || edid[2] != 0xFF || edid[3] != 0xFF || edid[4] != 0xFF || edid[5] != 0xFF ||
+        edid[6] != 0xFF || edid[7] != 0x00)
+    {
+        status |= EDID_STATUS_BAD_HEADER;
+    }
+    for (int i = 0; i < EDID_LENGTH; ++i)
+    {
+        sum += edid[i];
+    }
+    if (sum != 0)
+    {
+        status |= EDID_STATUS_BAD_CHECKSUM;
+    }
+    return status;
+}
+
+/**
+ * The float based formatter used for chromaticity and gamma before the
+ * fixed-point path, kept as the benchmark baseline. It truncates.
+ */
+static void legacy_float_to_string(float value, char *float_string)
+{
+    int int_part = (int)value;
+    int frac_part = (int)((value - int_part) * 10000);
+
+    sprintf(float_string, "%d.%04d", int_part, frac_part);
+}
+
+/**
+ * The bit-by-bit established timing formatter and the switch based standard
+ * timing decoder used before the generated tables, kept as the reference the
+ * tables are checked against.
+ */
+static void legacy_established_timings(const unsigned char *edid, struct edid_sink *sink)
+{
+    const char *established_timings[] = {
+        "720x400 @ 70Hz", "720x400 @ 88Hz", "640x480 @ 60Hz", "640x480 @ 67Hz", "640x480 @ 72Hz", "640x480 @ 75Hz", "800x600 @ 56Hz", "800x600 @ 60Hz",
+
+        "800x600 @ 72Hz", "800x600 @ 75Hz", "832x624 @ 75Hz", "1024x768 @ 87Hz (interlaced)", "1024x768 @ 60Hz", "1024x768 @ 70Hz", "1024x768 @ 75Hz", "1280x1024 @ 75Hz"};
+    uint16_t timings = (uint16_t)((edid[35] << 8) | edid[36]);
+    uint16_t mask = 0x8000;
+
+    EDID_SINK_LITERAL(sink, "Established Timings:\n");
+    for (int i = 0; i < 16; i++)
+    {
+        if (timings & mask)
+        {
+            EDID_SINK_LITERAL(sink, " - ");
+            edid_sink_puts(sink, established_timings[i]);
+            edid_sink_putc(sink, '\n');
+        }
+        mask >>= 1;
+    }
+    if (edid[37] != 0x00)
+    {
+        EDID_SINK_LITERAL(sink, " - Manufacturer reserved timings: 0x");
+        edid_sink_puthex(sink, edid[37], 2);
+        edid_sink_putc(sink, '\n');
+    }
+}
+
+static void legacy_standard_timings(const unsigned char *edid, struct edid_sink *sink)
+{
+    const char *aspect_ratios[] = {"16:10", "4:3", "5:4", "16:9"};
+
+    EDID_SINK_LITERAL(sink, "Standard Timings:\n");
+    for (int i = 0; i < EDID_STANDARD_TIMING_COUNT; i++)
+    {
+        uint8_t byte1 = edid[38 + i * 2];
+        uint8_t byte2 = edid[39 + i * 2];
+
+        if (byte1 == 0x01 && byte2 == 0x01)
+        {
+            continue;
+        }
+
+        int horizontal_resolution = (byte1 + 31) * 8;
+        uint8_t aspect = (byte2 >> 6) & 0x03;
+        int vertical_resolution;
+        switch (aspect)
+        {
+        case 0:
+            vertical_resolution = horizontal_resolution * 10 / 16;
+            break;
+        case 1:
+            vertical_resolution = horizontal_resolution * 3 / 4;
+            break;
+        case 2:
+            vertical_resolution = horizontal_resolution * 4 / 5;
+            break;
+        default:
+            vertical_resolution = horizontal_resolution * 9 / 16;
+            break;
+        }
+
+        EDID_SINK_LITERAL(sink, " - ");
+        edid_sink_putu(sink, (unsigned int)horizontal_resolution);
+        EDID_SINK_LITERAL(sink, " x ");
+        edid_sink_putu(sink, (unsigned int)vertical_resolution);
+        EDID_SINK_LITERAL(sink, " (");
+        edid_sink_puts(sink, aspect_ratios[aspect]);
+        EDID_SINK_LITERAL(sink, ") @ ");
+        edid_sink_putu(sink, (unsigned int)((byte2 & 0x3F) + 60));
+        EDID_SINK_LITERAL(sink, "Hz\n");
+    }
+}
+
+static void report(const char *name, uint64_t elapsed_ns, unsigned int iterations, size_t text_len)
+{
+    double ns_per_edid = (double)elapsed_ns / iterations;
+    double mb_per_s = elapsed_ns ? (double)text_len * iterations * 1000.0 / elapsed_ns : 0.0;
+
+    printf("  %-28s %10.1f ns/EDID %10.1f MB/s\n", name, ns_per_edid, mb_per_s);
+}
+
+/**
+ * Compares the legacy sscanf decoder against edid_hex_decode() on space
+ * separated and packed copies of the same 128-byte EDID.
+ *
+ * @param iterations Number of decodes per variant
+ * @return 0 on success, 1 if the decoders disagree
+ */
+int edid_bench_hex(unsigned int iterations)
+{
+    char packed[2 * EDID_LENGTH + 1];
+    unsigned char expected[EDID_LENGTH];
+    unsigned char edid[EDID_LENGTH];
+    size_t separated_len = strlen(bench_edid_hex);
+    volatile unsigned int sink = 0;
+
+    if (iterations == 0)
+    {
+        iterations = 1;
+    }
+
+    legacy_string_to_hex(bench_edid_hex, expected, sizeof(expected));
+    for (size_t i = 0; i < EDID_LENGTH; i++)
+    {
+        static const char digits[] = "0123456789ABCDEF";
+        packed[2 * i] = digits[expected[i] >> 4];
+        packed[2 * i + 1] = digits[expected[i] & 0x0F];
+    }
+    packed[2 * EDID_LENGTH] = '\0';
+
+    if (edid_hex_decode(bench_edid_hex, separated_len, edid, sizeof(edid), NULL) != EDID_LENGTH || memcmp(edid, expected, EDID_LENGTH) != 0 ||
+        edid_hex_decode(packed, 2 * EDID_LENGTH, edid, sizeof(edid), NULL) != EDID_LENGTH || memcmp(edid, expected, EDID_LENGTH) != 0)
+    {
+        fprintf(stderr, "edid_hex_decode disagrees with the sscanf decoder\n");
+        return 1;
+    }
+
+    printf("Hex decode, %u iterations (CPU features 0x%X):\n", iterations, (unsigned)edid_cpu_features());
+
+    uint64_t start = bench_now_ns();
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        sink += (unsigned int)legacy_string_to_hex(bench_edid_hex, edid, sizeof(edid));
+    }
+    report("sscanf, separated", bench_now_ns() - start, iterations, separated_len);
+
+    start = bench_now_ns();
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        sink += (unsigned int)legacy_string_to_hex(packed, edid, sizeof(edid));
+    }
+    report("sscanf, packed", bench_now_ns() - start, iterations, 2 * EDID_LENGTH);
+
+    start = bench_now_ns();
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        sink += (unsigned int)edid_hex_decode(bench_edid_hex, separated_len, edid, sizeof(edid), NULL);
+    }
+    report("edid_hex_decode, separated", bench_now_ns() - start, iterations, separated_len);
+
+    start = bench_now_ns();
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        sink += (unsigned int)edid_hex_decode(packed, 2 * EDID_LENGTH, edid, sizeof(edid), NULL);
+    }
+    report("edid_hex_decode, packed", bench_now_ns() - start, iterations, 2 * EDID_LENGTH);
+
+    (void)sink;
+    return 0;
+}
+
+/**
+ * Compares looping parse_edid_array() over a corpus against one
+ * parse_edid_batch() call. Every 16th block gets a broken checksum and every
+ * 64th a broken header so the status path is exercised too.
+ *
+ * @param count Number of blocks in the synthetic corpus
+ * @return 0 on success, 1 on allocation failure or if the results disagree
+ */
+int edid_bench_batch(unsigned int count)
+{
+    unsigned char edid[EDID_LENGTH];
+    char text[4096];
+    volatile size_t sink = 0;
+
+    if (count == 0)
+    {
+        count = 1;
+    }
+
+    unsigned char *blocks = malloc((size_t)count * EDID_LENGTH);
+    struct edid_info *infos = malloc((size_t)count * sizeof(*infos));
+    if (!blocks || !infos)
+    {
+        free(blocks);
+        free(infos);
+        return 1;
+    }
+
+    edid_hex_decode(bench_edid_hex, strlen(bench_edid_hex), edid, sizeof(edid), NULL);
+    for (unsigned int i = 0; i < count; i++)
+    {
+        unsigned char *block = blocks + (size_t)i * EDID_LENGTH;
+        uint8_t sum = 0;
+
+        memcpy(block, edid, EDID_LENGTH);
+        memcpy(block + 12, &i, sizeof(i)); // serial number
+        for (int k = 0; k < EDID_LENGTH - 1; k++)
+        {
+            sum += block[k];
+        }
+        block[EDID_LENGTH - 1] = (uint8_t)(0x100 - sum);
+        if (i % 16 == 15)
+        {
+            block[EDID_LENGTH - 1] ^= 0x01;
+        }
+        if (i % 64 == 63)
+        {
+            block[0] = 0x01;
+        }
+    }
+
+    printf("Batch decode, %u blocks:\n", count);
+
+    uint64_t start = bench_now_ns();
+    for (unsigned int i = 0; i < count; i++)
+    {
+        sink += parse_edid_array(blocks + (size_t)i * EDID_LENGTH, text, sizeof(text));
+    }
+    uint64_t array_ns = bench_now_ns() - start;
+
+    start = bench_now_ns();
+    size_t valid = parse_edid_batch(blocks, count, infos);
+    uint64_t batch_ns = bench_now_ns() - start;
+
+    int result = 0;
+    for (unsigned int i = 0; i < count; i++)
+    {
+        struct edid_info info;
+
+        parse_edid_struct(blocks + (size_t)i * EDID_LENGTH, &info);
+        if (memcmp(&info, &infos[i], sizeof(info)) != 0)
+        {
+            fprintf(stderr, "parse_edid_batch disagrees with parse_edid_struct at block %u\n", i);
+            result = 1;
+            break;
+        }
+    }
+
+    printf("  %-28s %10.1f ns/EDID %12.0f blocks/s\n", "parse_edid_array loop", (double)array_ns / count,
+           array_ns ? count * 1e9 / array_ns : 0.0);
+    printf("  %-28s %10.1f ns/EDID %12.0f blocks/s\n", "parse_edid_batch", (double)batch_ns / count,
+           batch_ns ? count * 1e9 / batch_ns : 0.0);
+    printf("  %zu of %u blocks valid\n", valid, count);
+
+    (void)sink;
+    free(blocks);
+    free(infos);
+    return result;
+}
+
+/**
+ * Compares the byte-at-a-time header and checksum checks against
+ * edid_validate_blocks() on a corpus where most blocks are junk, as in an
+ * ingest pipeline that rejects most of its input. The corpus is walked
+ * repeatedly so a small one stays in cache and the checks themselves are timed.
+ *
+ * @param count Number of blocks in the synthetic corpus
+ * @return 0 on success, 1 on allocation failure or if the results disagree
+ */
+int edid_bench_validate(unsigned int count)
+{
+    unsigned char edid[EDID_LENGTH];
+    uint32_t seed = 12345;
+    int result = 0;
+
+    if (count == 0)
+    {
+        count = 1;
+    }
+    unsigned int passes = 1 + 4000000 / count;
+    uint64_t total = (uint64_t)count * passes;
+
+    unsigned char *blocks = malloc((size_t)count * EDID_LENGTH);
+    uint8_t *expected = malloc(count);
+    uint8_t *status = malloc(count);
+    if (!blocks || !expected || !status)
+    {
+        free(blocks);
+        free(expected);
+        free(status);
+        return 1;
+    }
+
+    // One block in four is a real EDID, the rest random bytes
+    edid_hex_decode(bench_edid_hex, strlen(bench_edid_hex), edid, sizeof(edid), NULL);
+    for (unsigned int i = 0; i < count; i++)
+    {
+        unsigned char *block = blocks + (size_t)i * EDID_LENGTH;
+
+        if (i % 4 == 0)
+        {
+            memcpy(block, edid, EDID_LENGTH);
+            continue;
+        }
+        for (int k = 0; k < EDID_LENGTH; k++)
+        {
+            seed = seed * 1103515245u + 12345u;
+            block[k] = (unsigned char)(seed >> 16);
+        }
+    }
+
+    printf("Header and checksum validation, %u blocks x %u passes (CPU features 0x%X):\n", count, passes,
+           (unsigned)edid_cpu_features());
+
+    uint64_t start = bench_now_ns();
+    for (unsigned int pass = 0; pass < passes; pass++)
+    {
+        for (unsigned int i = 0; i < count; i++)
+        {
+            expected[i] = legacy_validate(blocks + (size_t)i * EDID_LENGTH);
+        }
+    }
+    uint64_t legacy_ns = bench_now_ns() - start;
+
+    start = bench_now_ns();
+    for (unsigned int pass = 0; pass < passes; pass++)
+    {
+        for (unsigned int i = 0; i < count; i++)
+        {
+            const unsigned char *block = blocks + (size_t)i * EDID_LENGTH;
+            status[i] = (uint8_t)((check_header(block) ? 0 : EDID_STATUS_BAD_HEADER) |
+                                  (verify_edid_checksum(block) ? 0 : EDID_STATUS_BAD_CHECKSUM));
+        }
+        result |= memcmp(status, expected, count) != 0;
+    }
+    uint64_t single_ns = bench_now_ns() - start;
+
+    start = bench_now_ns();
+    for (unsigned int pass = 0; pass < passes; pass++)
+    {
+        edid_validate_blocks(blocks, count, status);
+        result |= memcmp(status, expected, count) != 0;
+    }
+    uint64_t batch_ns = bench_now_ns() - start;
+
+    if (result)
+    {
+        fprintf(stderr, "edid_validate_blocks disagrees with the byte-at-a-time checks\n");
+    }
+
+    printf("  %-28s %10.2f ns/block %12.0f blocks/s\n", "byte at a time", (double)legacy_ns / total,
+           legacy_ns ? total * 1e9 / legacy_ns : 0.0);
+    printf("  %-28s %10.2f ns/block %12.0f blocks/s\n", "check_header + checksum", (double)single_ns / total,
+           single_ns ? total * 1e9 / single_ns : 0.0);
+    printf("  %-28s %10.2f ns/block %12.0f blocks/s\n", "edid_validate_blocks", (double)batch_ns / total,
+           batch_ns ? total * 1e9 / batch_ns : 0.0);
+
+    free(blocks);
+    free(expected);
+    free(status);
+    return result;
+}
+
+/**
+ * Parses a corpus file with 1, 2, 4, ... threads up to max_threads and reports
+ * blocks/s and scaling efficiency against the single-threaded run. The text
+ * is measured but not kept, so the numbers cover decoding and formatting only.
+ *
+ * @param path Corpus of hex lines or concatenated binary EDIDs
+ * @param max_threads Highest thread count to try, 0 for one per processor
+ * @return 0 on success, 1 if the corpus cannot be loaded or parsed
+ */
+int edid_bench_corpus(const char *path, unsigned int max_threads)
+{
+    struct edid_corpus corpus;
+    double single_rate = 0.0;
+
+    if (!edid_corpus_load(path, &corpus))
+    {
+        fprintf(stderr, "Cannot load corpus %s\n", path);
+        return 1;
+    }
+    if (max_threads == 0)
+    {
+        max_threads = edid_corpus_default_threads();
+    }
+
+    printf("Corpus parse, %zu EDIDs in %zu blocks:\n", corpus.count, corpus.blocks);
+
+    for (unsigned int threads = 1;; threads = threads * 2 > max_threads && threads < max_threads ? max_threads : threads * 2)
+    {
+        uint64_t start = bench_now_ns();
+        if (!edid_corpus_parse(&corpus, threads, EDID_FORMAT_TEXT, NULL))
+        {
+            edid_corpus_free(&corpus);
+            return 1;
+        }
+        uint64_t elapsed_ns = bench_now_ns() - start;
+        double rate = elapsed_ns ? corpus.blocks * 1e9 / elapsed_ns : 0.0;
+
+        if (threads == 1)
+        {
+            single_rate = rate;
+        }
+        printf("  %3u thread(s) %14.0f blocks/s %8.2fx %7.1f%% efficiency\n", threads, rate,
+               single_rate > 0.0 ? rate / single_rate : 0.0, single_rate > 0.0 ? 100.0 * rate / single_rate / threads : 0.0);
+
+        if (threads >= max_threads)
+        {
+            break;
+        }
+    }
+
+    edid_corpus_free(&corpus);
+    return 0;
+}
+
+#define BENCH_THREADS_FORMATS 3    // text, JSON and CSV
+
+struct bench_threads_worker
+{
+    const struct edid_corpus *corpus;
+    const char *expected;               // single-threaded output of every EDID in every format
+    const size_t *offsets;              // start of each output in expected, count * formats + 1 entries
+    atomic_int *start;
+    size_t first;                       // EDID this worker starts at
+    size_t mismatches;
+    size_t first_mismatch;
+    pthread_t thread;
+};
+
+/**
+ * Parses every EDID of the corpus in every output format, starting at its
+ * own offset so the workers work on different EDIDs at the same time, and
+ * compares each result byte for byte with the single-threaded run.
+ */
+static void *bench_threads_worker_main(void *arg)
+{
+    static _Thread_local char text[16384];
+    struct bench_threads_worker *worker = arg;
+    const struct edid_corpus *corpus = worker->corpus;
+
+    while (!atomic_load(worker->start))
+    {
+        sched_yield();
+    }
+    for (size_t n = 0; n < corpus->count; n++)
+    {
+        size_t i = (worker->first + n) % corpus->count;
+        const unsigned char *edid = corpus->data + corpus->offsets[i];
+        size_t length = (size_t)corpus->block_counts[i] * EDID_LENGTH;
+
+        for (int format = 0; format < BENCH_THREADS_FORMATS; format++)
+        {
+            size_t k = i * BENCH_THREADS_FORMATS + format;
+            size_t expected_length = worker->offsets[k + 1] - worker->offsets[k];
+            size_t got = parse_edid_blocks_as(edid, length, format, text, sizeof(text));
+
+            if (got != expected_length || memcmp(text, worker->expected + worker->offsets[k], got) != 0)
+            {
+                if (worker->mismatches++ == 0)
+                {
+                    worker->first_mismatch = i;
+                }
+            }
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Checks that parsing is reentrant: the corpus is parsed once on this
+ * thread, then by several threads at the same time, each covering every
+ * EDID in text, JSON and CSV, and every result must match the
+ * single-threaded one byte for byte. Run it under ThreadSanitizer to also
+ * catch races that happen not to change the output.
+ *
+ * @param path Corpus file, hex lines or a binary archive
+ * @param threads Number of parsing threads, 0 for 8
+ * @return 0 on success, 1 if the corpus cannot be loaded or a result differs
+ */
+int edid_bench_threads(const char *path, unsigned int threads)
+{
+    struct bench_threads_worker workers[64];
+    struct edid_corpus corpus;
+    atomic_int start;
+    size_t mismatches = 0, total = 0;
+    unsigned int started = 0;
+    char label[32];
+
+    if (!edid_corpus_load(path, &corpus))
+    {
+        fprintf(stderr, "Cannot load corpus %s\n", path);
+        return 1;
+    }
+    threads = threads ? threads : 8;
+    threads = threads < 64 ? threads : 64;
+
+    size_t outputs = corpus.count * BENCH_THREADS_FORMATS;
+    size_t *offsets = malloc((outputs + 1) * sizeof(*offsets));
+    for (size_t k = 0; offsets && k < outputs; k++)
+    {
+        const size_t i = k / BENCH_THREADS_FORMATS;
+
+        offsets[k] = total;
+        total += parse_edid_blocks_as(corpus.data + corpus.offsets[i], (size_t)corpus.block_counts[i] * EDID_LENGTH,
+                                      (int)(k % BENCH_THREADS_FORMATS), NULL, 0);
+    }
+    char *expected = offsets ? malloc(total + 1) : NULL;
+    if (!expected)
+    {
+        free(offsets);
+        edid_corpus_free(&corpus);
+        return 1;
+    }
+    offsets[outputs] = total;
+
+    uint64_t single_start = bench_now_ns();
+    for (size_t k = 0; k < outputs; k++)
+    {
+        const size_t i = k / BENCH_THREADS_FORMATS;
+
+        // Each output's NUL lands on the first byte of the next one, which overwrites it
+        parse_edid_blocks_as(corpus.data + corpus.offsets[i], (size_t)corpus.block_counts[i] * EDID_LENGTH,
+                             (int)(k % BENCH_THREADS_FORMATS), expected + offsets[k], total + 1 - offsets[k]);
+    }
+    uint64_t single_ns = bench_now_ns() - single_start;
+
+    atomic_init(&start, 0);
+    for (; started < threads; started++)
+    {
+        struct bench_threads_worker *worker = &workers[started];
+
+        worker->corpus = &corpus;
+        worker->expected = expected;
+        worker->offsets = offsets;
+        worker->start = &start;
+        worker->first = corpus.count * started / threads;
+        worker->mismatches = 0;
+        worker->first_mismatch = 0;
+        if (pthread_create(&worker->thread, NULL, bench_threads_worker_main, worker) != 0)
+        {
+            break;
+        }
+    }
+    if (started < threads)
+    {
+        fprintf(stderr, "Started only %u of %u threads\n", started, threads);
+        mismatches++;
+    }
+
+    uint64_t threaded_start = bench_now_ns();
+    atomic_store(&start, 1);
+    for (unsigned int i = 0; i < started; i++)
+    {
+        pthread_join(workers[i].thread, NULL);
+        if (workers[i].mismatches)
+        {
+            fprintf(stderr, "Thread %u: %zu results differ, the first for EDID %zu\n", i, workers[i].mismatches,
+                    workers[i].first_mismatch);
+        }
+        mismatches += workers[i].mismatches;
+    }
+    uint64_t threaded_ns = bench_now_ns() - threaded_start;
+
+    printf("Concurrent parsing, %zu EDIDs in %d formats:\n", corpus.count, BENCH_THREADS_FORMATS);
+    printf("  %-28s %10zu results %10.1f ms\n", "1 thread, reference", outputs, single_ns / 1e6);
+    snprintf(label, sizeof(label), "%u threads, all EDIDs each", started);
+    printf("  %-28s %10zu results %10.1f ms, %zu differ\n", label, outputs * started, threaded_ns / 1e6, mismatches);
+
+    free(expected);
+    free(offsets);
+    edid_corpus_free(&corpus);
+    return mismatches ? 1 : 0;
+}
+
+/**
+ * Compares reading an archive with one fread() per EDID into a buffer, as the
+ * old single-file path did, against walking a memory mapping of it. Both
+ * decode every EDID into structures so the comparison covers ingest only.
+ *
+ * @param path Binary archive of concatenated EDIDs
+ * @return 0 on success, 1 if the archive cannot be read or the walks disagree
+ */
+int edid_bench_archive(const char *path)
+{
+    unsigned char buffer[EDID_LENGTH * 256];
+    struct edid_info info;
+    struct edid_ext_info ext;
+    size_t fread_edids = 0, fread_bytes = 0, fread_valid = 0;
+    size_t mmap_edids = 0, mmap_bytes = 0, mmap_valid = 0;
+
+    FILE *file = fopen(path, "rb");
+    if (!file)
+    {
+        fprintf(stderr, "Cannot open archive %s\n", path);
+        return 1;
+    }
+
+    uint64_t start = bench_now_ns();
+    while (fread(buffer, 1, EDID_LENGTH, file) == EDID_LENGTH)
+    {
+        size_t length = EDID_LENGTH + fread(buffer + EDID_LENGTH, 1, (size_t)buffer[126] * EDID_LENGTH, file);
+
+        length -= length % EDID_LENGTH;
+        fread_valid += (size_t)parse_edid_struct(buffer, &info);
+        parse_edid_extensions(buffer, length, &ext);
+        fread_edids++;
+        fread_bytes += length;
+    }
+    uint64_t fread_ns = bench_now_ns() - start;
+    fclose(file);
+
+    struct edid_archive archive;
+    struct edid_archive_iter iter;
+    const unsigned char *edid;
+    size_t length;
+
+    start = bench_now_ns();
+    if (!edid_archive_open(path, &archive))
+    {
+        fprintf(stderr, "Cannot map archive %s\n", path);
+        return 1;
+    }
+    edid_archive_iter_init(&iter, &archive);
+    while ((edid = edid_archive_next(&iter, &length)) != NULL)
+    {
+        mmap_valid += (size_t)parse_edid_struct(edid, &info);
+        parse_edid_extensions(edid, length, &ext);
+        mmap_edids++;
+        mmap_bytes += length;
+    }
+    edid_archive_close(&archive);
+    uint64_t mmap_ns = bench_now_ns() - start;
+
+    printf("Archive ingest, %zu EDIDs in %zu bytes, %zu with a valid header:\n", mmap_edids, mmap_bytes, mmap_valid);
+    printf("  %-28s %10.1f MB/s %12.0f EDIDs/s\n", "fread per EDID", fread_ns ? fread_bytes * 1000.0 / fread_ns : 0.0,
+           fread_ns ? fread_edids * 1e9 / fread_ns : 0.0);
+    printf("  %-28s %10.1f MB/s %12.0f EDIDs/s\n", "memory mapped", mmap_ns ? mmap_bytes * 1000.0 / mmap_ns : 0.0,
+           mmap_ns ? mmap_edids * 1e9 / mmap_ns : 0.0);
+
+    if (fread_edids != mmap_edids || fread_bytes != mmap_bytes || fread_valid != mmap_valid)
+    {
+        fprintf(stderr, "The fread and mapped walks disagree\n");
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * Copies the extension fields the record's extension section carries, the
+ * rest left zero, to what edid_record_read() should give back.
+ */
+static void bench_record_summary(const struct edid_ext_info *ext, struct edid_ext_info *summary)
+{
+    const struct edid_cta_info *cta = &ext->cta;
+    const struct edid_displayid_info *displayid = &ext->displayid;
+
+    memset(summary, 0, sizeof(*summary));
+    summary->block_count = ext->block_count;
+    summary->blocks_decoded = ext->blocks_decoded;
+    summary->bad_checksums = ext->bad_checksums;
+
+    summary->cta.present = cta->present;
+    summary->cta.revision = cta->revision;
+    summary->cta.flags = cta->flags;
+    summary->cta.vic_count = cta->vic_count;
+    memcpy(summary->cta.vics, cta->vics, sizeof(cta->vics));
+    summary->cta.native_vics = cta->native_vics;
+    summary->cta.audio_count = cta->audio_count;
+    memcpy(summary->cta.audio, cta->audio, sizeof(cta->audio));
+    summary->cta.has_hdmi = cta->has_hdmi;
+    summary->cta.physical_address = cta->physical_address;
+    summary->cta.hdmi_max_tmds_mhz = cta->hdmi_max_tmds_mhz;
+    summary->cta.has_hdmi_forum = cta->has_hdmi_forum;
+    summary->cta.hdmi_forum_max_tmds_mhz = cta->hdmi_forum_max_tmds_mhz;
+    summary->cta.has_hdr_static = cta->has_hdr_static;
+    summary->cta.hdr_eotfs = cta->hdr_eotfs;
+    summary->cta.hdr_metadata_types = cta->hdr_metadata_types;
+
+    summary->displayid.present = displayid->present;
+    summary->displayid.version = displayid->version;
+    summary->displayid.has_tile = displayid->has_tile;
+    summary->displayid.tile.horizontal_tiles = displayid->tile.horizontal_tiles;
+    summary->displayid.tile.vertical_tiles = displayid->tile.vertical_tiles;
+    summary->displayid.tile.horizontal_location = displayid->tile.horizontal_location;
+    summary->displayid.tile.vertical_location = displayid->tile.vertical_location;
+    summary->displayid.tile.tile_width = displayid->tile.tile_width;
+    summary->displayid.tile.tile_height = displayid->tile.tile_height;
+}
+
+/**
+ * Formats a decoded EDID as text, the extensions after the base block.
+ */
+static size_t bench_record_text(const struct edid_info *info, const struct edid_ext_info *ext, char *text, size_t capacity)
+{
+    struct edid_sink sink;
+
+    edid_sink_init(&sink, text, capacity);
+    format_edid_info(info, &sink);
+    format_edid_extensions(ext, &sink);
+    return sink.length;
+}
+
+/**
+ * Round-trips every EDID of a corpus through the binary record format and
+ * checks the result against the structured decode: the base block and the
+ * extension summary must format to the same text, and writing the read-back
+ * structures must give the same record bytes. Also reports the record size
+ * against the text output and the write and read cost.
+ *
+ * @param path Corpus file, hex lines or a binary archive
+ * @return 0 on success, 1 if the corpus cannot be loaded or a record differs
+ */
+int edid_bench_record(const char *path)
+{
+    static char text[8192], text_back[8192];
+    static struct edid_ext_info ext, ext_back, summary;
+    unsigned char record[EDID_RECORD_MAX_SIZE], record_back[EDID_RECORD_MAX_SIZE];
+    struct edid_info info, info_back;
+    struct edid_corpus corpus;
+    size_t record_bytes = 0, text_bytes = 0, mismatches = 0;
+    uint64_t write_ns = 0, read_ns = 0;
+
+    if (!edid_corpus_load(path, &corpus))
+    {
+        fprintf(stderr, "Cannot load corpus %s\n", path);
+        return 1;
+    }
+
+    for (size_t i = 0; i < corpus.count; i++)
+    {
+        const unsigned char *edid = corpus.data + corpus.offsets[i];
+        size_t length = (size_t)corpus.block_counts[i] * EDID_LENGTH;
+
+        parse_edid_struct(edid, &info);
+        parse_edid_extensions(edid, length, &ext);
+        text_bytes += parse_edid_blocks(edid, length, NULL, 0);
+
+        // Base record alone for EDIDs without extensions
+        const struct edid_ext_info *with_ext = ext.block_count ? &ext : NULL;
+        uint64_t start = bench_now_ns();
+        size_t written = edid_record_write(&info, with_ext, record, sizeof(record));
+        uint64_t middle = bench_now_ns();
+        size_t read = edid_record_read(record, written, &info_back, &ext_back);
+        write_ns += middle - start;
+        read_ns += bench_now_ns() - middle;
+        record_bytes += written;
+
+        if (with_ext)
+        {
+            bench_record_summary(&ext, &summary);
+        }
+        else
+        {
+            memset(&summary, 0, sizeof(summary));
+        }
+        size_t text_length = bench_record_text(&info, &summary, text, sizeof(text));
+
+        if (read != written || bench_record_text(&info_back, &ext_back, text_back, sizeof(text_back)) != text_length ||
+            memcmp(text, text_back, text_length) != 0 ||
+            edid_record_write(&info_back, with_ext ? &ext_back : NULL, record_back, sizeof(record_back)) != written ||
+            memcmp(record, record_back, written) != 0)
+        {
+            if (mismatches++ == 0)
+            {
+                fprintf(stderr, "Record round trip differs for EDID %zu\n", i);
+            }
+        }
+    }
+
+    printf("Binary records, %zu EDIDs:\n", corpus.count);
+    printf("  %-28s %10zu bytes %8.1f per EDID\n", "records", record_bytes,
+           corpus.count ? (double)record_bytes / corpus.count : 0.0);
+    printf("  %-28s %10zu bytes %8.1f per EDID\n", "text output", text_bytes,
+           corpus.count ? (double)text_bytes / corpus.count : 0.0);
+    printf("  %-28s %10.1f ns/record\n", "write", corpus.count ? (double)write_ns / corpus.count : 0.0);
+    printf("  %-28s %10.1f ns/record\n", "read", corpus.count ? (double)read_ns / corpus.count : 0.0);
+
+    if (mismatches)
+    {
+        fprintf(stderr, "%zu of %zu records did not round trip\n", mismatches, corpus.count);
+    }
+    edid_corpus_free(&corpus);
+    return mismatches ? 1 : 0;
+}
+
+/**
+ * Compares the float and sprintf path for chromaticity and gamma against the
+ * fixed-point writers over every possible field value. The fixed-point output
+ * is checked against printf's correctly rounded "%.4f" first, and the number
+ * of values the old path got wrong is reported.
+ *
+ * @param iterations Passes over the 1024 chromaticity and 256 gamma values
+ * @return 0 on success, 1 if a fixed-point string is not correctly rounded
+ */
+int edid_bench_fixed(unsigned int iterations)
+{
+    char expected[16], legacy[16], text[16];
+    struct edid_sink sink;
+    unsigned int legacy_wrong = 0;
+    volatile size_t total = 0;
+
+    if (iterations == 0)
+    {
+        iterations = 1;
+    }
+
+    for (unsigned int value = 0; value < 1024 + 256; value++)
+    {
+        edid_sink_init(&sink, text, sizeof(text));
+        if (value < 1024)
+        {
+            snprintf(expected, sizeof(expected), "%.4f", value / 1024.0);
+            legacy_float_to_string(value / 1024.0f, legacy);
+            edid_sink_putchromaticity(&sink, (uint16_t)value);
+        }
+        else
+        {
+            uint8_t gamma = (uint8_t)(value - 1024);
+            snprintf(expected, sizeof(expected), "%.4f", (gamma + 100) / 100.0);
+            legacy_float_to_string((gamma + 100) / 100.0f, legacy);
+            edid_sink_putgamma(&sink, gamma, 4);
+        }
+        if (strcmp(text, expected) != 0)
+        {
+            fprintf(stderr, "Fixed-point output %s differs from %s\n", text, expected);
+            return 1;
+        }
+        legacy_wrong += strcmp(legacy, expected) != 0;
+    }
+
+    printf("Chromaticity and gamma formatting, %u passes over 1280 values:\n", iterations);
+    printf("  float_to_string was wrong for %u of 1280 values\n", legacy_wrong);
+
+    uint64_t start = bench_now_ns();
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        edid_sink_init(&sink, text, sizeof(text));
+        for (unsigned int value = 0; value < 1024; value++)
+        {
+            legacy_float_to_string(value / 1024.0f, legacy);
+            edid_sink_init(&sink, text, sizeof(text));
+            edid_sink_puts(&sink, legacy);
+            total += sink.length;
+        }
+        for (unsigned int gamma = 0; gamma < 256; gamma++)
+        {
+            legacy_float_to_string((gamma + 100) / 100.0f, legacy);
+            edid_sink_init(&sink, text, sizeof(text));
+            edid_sink_puts(&sink, legacy);
+            total += sink.length;
+        }
+    }
+    uint64_t legacy_ns = bench_now_ns() - start;
+
+    start = bench_now_ns();
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        for (unsigned int value = 0; value < 1024; value++)
+        {
+            edid_sink_init(&sink, text, sizeof(text));
+            edid_sink_putchromaticity(&sink, (uint16_t)value);
+            total += sink.length;
+        }
+        for (unsigned int gamma = 0; gamma < 256; gamma++)
+        {
+            edid_sink_init(&sink, text, sizeof(text));
+            edid_sink_putgamma(&sink, (uint8_t)gamma, 4);
+            total += sink.length;
+        }
+    }
+    uint64_t fixed_ns = bench_now_ns() - start;
+
+    printf("  %-28s %10.1f ns/value\n", "float_to_string + sprintf", (double)legacy_ns / (1280.0 * iterations));
+    printf("  %-28s %10.1f ns/value\n", "fixed point", (double)fixed_ns / (1280.0 * iterations));
+    (void)total;
+    return 0;
+}
+
+/**
+ * Replays a hotplug trace over the first few hundred EDIDs of a corpus, the
+ * same monitors reconnecting in random order, through parse_edid_blocks_as()
+ * and through a cache in front of it. Every cached result is compared with
+ * the uncached one before timing.
+ *
+ * @param path Corpus file, hex lines or a binary archive
+ * @param memory_kb Cache memory cap in KiB, 0 for the default
+ * @return 0 on success, 1 if the corpus cannot be loaded or a cached result differs
+ */
+int edid_bench_cache(const char *path, unsigned int memory_kb)
+{
+    enum { MODELS = 300, LOOKUPS = 200000 };
+    static char text[65536], cached[65536];
+    struct edid_corpus corpus;
+    struct edid_cache cache;
+    size_t models;
+    uint32_t seed = 12345;
+    volatile size_t total = 0;
+    int failed = 0;
+
+    if (!edid_corpus_load(path, &corpus))
+    {
+        fprintf(stderr, "Cannot load corpus %s\n", path);
+        return 1;
+    }
+    models = corpus.count < MODELS ? corpus.count : MODELS;
+    if (models == 0 || !edid_cache_init(&cache, (size_t)memory_kb * 1024))
+    {
+        edid_corpus_free(&corpus);
+        return 1;
+    }
+
+    uint32_t *trace = malloc(LOOKUPS * sizeof(*trace));
+    if (!trace)
+    {
+        edid_cache_free(&cache);
+        edid_corpus_free(&corpus);
+        return 1;
+    }
+    for (size_t i = 0; i < LOOKUPS; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        trace[i] = (uint32_t)((seed >> 8) % models);
+    }
+
+    for (size_t i = 0; i < LOOKUPS && !failed; i++)
+    {
+        const unsigned char *edid = corpus.data + corpus.offsets[trace[i]];
+        size_t length = (size_t)corpus.block_counts[trace[i]] * EDID_LENGTH;
+        int format = (int)(i % 3);
+        size_t expected = parse_edid_blocks_as(edid, length, format, text, sizeof(text));
+
+        if (edid_cache_parse(&cache, edid, length, format, cached, sizeof(cached)) != expected ||
+            memcmp(text, cached, expected < sizeof(text) ? expected : sizeof(text) - 1) != 0)
+        {
+            fprintf(stderr, "Cached output differs for EDID %u\n", (unsigned)trace[i]);
+            failed = 1;
+        }
+    }
+
+    if (!failed)
+    {
+        edid_cache_clear(&cache);
+        cache.hits = cache.misses = cache.evictions = 0;
+
+        uint64_t start = bench_now_ns();
+        for (size_t i = 0; i < LOOKUPS; i++)
+        {
+            const unsigned char *edid = corpus.data + corpus.offsets[trace[i]];
+            total += parse_edid_blocks_as(edid, (size_t)corpus.block_counts[trace[i]] * EDID_LENGTH, EDID_FORMAT_TEXT, text,
+                                          sizeof(text));
+        }
+        uint64_t uncached_ns = bench_now_ns() - start;
+
+        start = bench_now_ns();
+        for (size_t i = 0; i < LOOKUPS; i++)
+        {
+            const unsigned char *edid = corpus.data + corpus.offsets[trace[i]];
+            total += edid_cache_parse(&cache, edid, (size_t)corpus.block_counts[trace[i]] * EDID_LENGTH, EDID_FORMAT_TEXT,
+                                      text, sizeof(text));
+        }
+        uint64_t cached_ns = bench_now_ns() - start;
+
+        printf("Decode cache, %d lookups over %zu EDIDs, cap %zu KiB:\n", LOOKUPS, models, cache.memory_cap / 1024);
+        printf("  %-28s %10.1f ns/lookup\n", "parse_edid_blocks_as", (double)uncached_ns / LOOKUPS);
+        printf("  %-28s %10.1f ns/lookup\n", "edid_cache_parse", (double)cached_ns / LOOKUPS);
+        printf("  hits %llu, misses %llu, evictions %llu, %zu entries in %zu bytes\n", (unsigned long long)cache.hits,
+               (unsigned long long)cache.misses, (unsigned long long)cache.evictions, cache.entries, cache.memory_used);
+    }
+
+    free(trace);
+    edid_cache_free(&cache);
+    edid_corpus_free(&corpus);
+    (void)total;
+    return failed;
+}
+
+/**
+ * Patches one section of every EDID in a corpus, the way firmware overrides a
+ * few bytes before re-advertising it, and brings the decoded result up to
+ * date with edid_reparse() and with a full decode. The two results must be
+ * identical, and edid_info_diff() may only report sections that changed.
+ *
+ * @param path Corpus file, hex lines or a binary archive
+ * @return 0 on success, 1 if the corpus cannot be loaded or the results differ
+ */
+int edid_bench_reparse(const char *path)
+{
+    static const uint8_t ranges[][2] = {{8, 17}, {18, 19}, {20, 24}, {25, 34}, {35, 53}, {54, 125}, {126, 126}};
+    static struct edid_ext_info old_ext, full_ext, ext;
+    unsigned char patched[EDID_LENGTH * 256];
+    struct edid_info old_info, full_info, info;
+    struct edid_corpus corpus;
+    uint64_t full_ns = 0, reparse_ns = 0;
+    uint32_t seed = 777;
+    size_t mismatches = 0;
+
+    if (!edid_corpus_load(path, &corpus))
+    {
+        fprintf(stderr, "Cannot load corpus %s\n", path);
+        return 1;
+    }
+
+    for (size_t i = 0; i < corpus.count; i++)
+    {
+        const unsigned char *edid = corpus.data + corpus.offsets[i];
+        size_t length = (size_t)corpus.block_counts[i] * EDID_LENGTH;
+        const uint8_t *range = ranges[i % (sizeof(ranges) / sizeof(ranges[0]))];
+
+        parse_edid_struct(edid, &old_info);
+        parse_edid_extensions(edid, length, &old_ext);
+
+        // Patch up to three bytes of one section, or of a range limits descriptor if there is one
+        memcpy(patched, edid, length);
+        for (int d = 0; d < EDID_DESCRIPTOR_COUNT && i % 2; d++)
+        {
+            if (old_info.descriptor_tags[d] == EDID_DESCRIPTOR_RANGE_LIMITS)
+            {
+                static uint8_t range_limits[2];
+                range_limits[0] = (uint8_t)(54 + d * 18 + 5);
+                range_limits[1] = (uint8_t)(range_limits[0] + 4);
+                range = range_limits;
+            }
+        }
+        for (int k = 0; k < 3; k++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            patched[range[0] + (seed >> 8) % (range[1] - range[0] + 1u)] ^= (uint8_t)(seed >> 24 | 1);
+        }
+        if (i % 4 != 3 && range[0] != 126)
+        {
+            patched[127] = (uint8_t)(patched[127] - edid_block_sum(patched));
+        }
+
+        info = old_info;
+        memcpy(&ext, &old_ext, sizeof(ext));
+
+        uint64_t start = bench_now_ns();
+        parse_edid_struct(patched, &full_info);
+        parse_edid_extensions(patched, length, &full_ext);
+        uint64_t middle = bench_now_ns();
+        unsigned int decoded = edid_reparse(edid, length, patched, length, &info, &ext);
+        full_ns += middle - start;
+        reparse_ns += bench_now_ns() - middle;
+
+        unsigned int changed = edid_info_diff(&old_info, &old_ext, &full_info, &full_ext);
+        if (memcmp(&info, &full_info, sizeof(info)) != 0 || memcmp(&ext, &full_ext, sizeof(ext)) != 0 ||
+            (changed & ~decoded) != 0)
+        {
+            if (mismatches++ == 0)
+            {
+                fprintf(stderr, "Reparse differs from a full decode for EDID %zu (decoded 0x%X, changed 0x%X)\n", i,
+                        decoded, changed);
+            }
+        }
+    }
+
+    printf("Incremental reparse, %zu patched EDIDs:\n", corpus.count);
+    printf("  %-28s %10.1f ns/EDID\n", "full decode", corpus.count ? (double)full_ns / corpus.count : 0.0);
+    printf("  %-28s %10.1f ns/EDID\n", "edid_reparse", corpus.count ? (double)reparse_ns / corpus.count : 0.0);
+
+    if (mismatches)
+    {
+        fprintf(stderr, "%zu of %zu reparsed EDIDs differ\n", mismatches, corpus.count);
+    }
+    edid_corpus_free(&corpus);
+    return mismatches ? 1 : 0;
+}
+
+#define BENCH_REG_TX 4
+
+/**
+ * The word-at-a-time text upload that write_parsed_edid_data() used to do,
+ * kept as the benchmark baseline: one register write per four text bytes,
+ * unbounded by the window.
+ */
+static size_t legacy_write_text(struct edid_reg_region *region, unsigned int tx_id, const char *text)
+{
+    size_t len = strlen(text);
+    uint32_t base = EDID_REG_WINDOW(tx_id);
+
+    for (size_t i = 0; i < len; i += 4)
+    {
+        uint32_t value = 0;
+
+        if (i < len) value |= (uint8_t)text[i];
+        if (i + 1 < len) value |= ((uint8_t)text[i + 1]) << 8;
+        if (i + 2 < len) value |= ((uint8_t)text[i + 2]) << 16;
+        if (i + 3 < len) value |= ((uint8_t)text[i + 3]) << 24;
+        edid_reg_region_burst(region, base + (uint32_t)i, &value, 1);
+    }
+    return (len + 3) / 4;
+}
+
+/**
+ * Publishes every EDID of a corpus to the register windows of BENCH_REG_TX
+ * transmitters in a plain array standing in for the FPGA, once as text the
+ * old way and once as a record in bursts, and reads each record back.
+ *
+ * @param path Corpus file, hex lines or a binary archive
+ * @return 0 on success, 1 if the corpus cannot be loaded or a record reads back differently
+ */
+int edid_bench_regs(const char *path)
+{
+    static char text[8192];
+    static struct edid_ext_info ext, ext_back;
+    unsigned char record[EDID_RECORD_MAX_SIZE], window[EDID_REG_STRIDE], record_back[EDID_RECORD_MAX_SIZE];
+    struct edid_info info, info_back;
+    struct edid_corpus corpus;
+    struct edid_reg_region region;
+    struct edid_reg_sink sink;
+    uint64_t text_ns = 0, record_ns = 0, text_words = 0, record_words = 0, record_bursts = 0;
+    size_t overflows = 0, mismatches = 0;
+
+    if (!edid_corpus_load(path, &corpus))
+    {
+        fprintf(stderr, "Cannot load corpus %s\n", path);
+        return 1;
+    }
+    region.origin = 0;
+    region.size = EDID_REG_WINDOW(BENCH_REG_TX);
+    region.rejected = 0;
+    region.words = calloc(region.size / 4, sizeof(uint32_t));
+    if (!region.words)
+    {
+        edid_corpus_free(&corpus);
+        return 1;
+    }
+
+    for (size_t i = 0; i < corpus.count; i++)
+    {
+        const unsigned char *edid = corpus.data + corpus.offsets[i];
+        size_t length = (size_t)corpus.block_counts[i] * EDID_LENGTH;
+        unsigned int tx_id = (unsigned int)(i % BENCH_REG_TX);
+
+        parse_edid_struct(edid, &info);
+        parse_edid_extensions(edid, length, &ext);
+        size_t text_length = parse_edid_blocks(edid, length, text, sizeof(text));
+        overflows += text_length > EDID_REG_STRIDE;
+
+        uint64_t start = bench_now_ns();
+        text_words += legacy_write_text(&region, tx_id, text);
+        uint64_t middle = bench_now_ns();
+        edid_reg_sink_init(&sink, edid_reg_region_burst, &region, 0, tx_id);
+        size_t written = edid_reg_write_record(&sink, &info, ext.block_count ? &ext : NULL);
+        text_ns += middle - start;
+        record_ns += bench_now_ns() - middle;
+        record_words += sink.words;
+        record_bursts += sink.bursts;
+
+        // Read the window back the way the FPGA side sees it
+        for (size_t w = 0; w < EDID_REG_STRIDE / 4; w++)
+        {
+            uint32_t value = region.words[(EDID_REG_WINDOW(tx_id) / 4) + w];
+
+            window[w * 4] = (unsigned char)value;
+            window[w * 4 + 1] = (unsigned char)(value >> 8);
+            window[w * 4 + 2] = (unsigned char)(value >> 16);
+            window[w * 4 + 3] = (unsigned char)(value >> 24);
+        }
+        int with_ext = ext.block_count != 0;
+        size_t expected = edid_record_write(&info, with_ext ? &ext : NULL, record, sizeof(record));
+        if (written != expected || memcmp(window, record, written) != 0 ||
+            edid_record_read(window, sizeof(window), &info_back, &ext_back) != written ||
+            edid_record_write(&info_back, with_ext ? &ext_back : NULL, record_back, sizeof(record_back)) != written ||
+            memcmp(record, record_back, written) != 0)
+        {
+            if (mismatches++ == 0)
+            {
+                fprintf(stderr, "Register window differs from the record for EDID %zu\n", i);
+            }
+        }
+    }
+
+    double count = corpus.count ? (double)corpus.count : 1.0;
+    printf("Register upload, %zu EDIDs over %d transmitter windows of %d bytes:\n", corpus.count, BENCH_REG_TX,
+           EDID_REG_STRIDE);
+    printf("  %-28s %8.1f writes/EDID %8.1f ns/EDID, %zu overflow the window\n", "text, word at a time",
+           (double)text_words / count, (double)text_ns / count, overflows);
+    printf("  %-28s %8.1f words/EDID in %.1f bursts %8.1f ns/EDID\n", "record, bursts", (double)record_words / count,
+           (double)record_bursts / count, (double)record_ns / count);
+
+    if (mismatches)
+    {
+        fprintf(stderr, "%zu of %zu register windows differ\n", mismatches, corpus.count);
+    }
+    free((void *)region.words);
+    edid_corpus_free(&corpus);
+    return mismatches ? 1 : 0;
+}
+
+#define BENCH_TX_ROUNDS 4000
+
+struct bench_tx_worker
+{
+    struct edid_tx_manager *manager;
+    atomic_int *done;
+    pthread_t thread;
+};
+
+static void *bench_tx_worker_main(void *arg)
+{
+    struct bench_tx_worker *worker = arg;
+
+    for (;;)
+    {
+        int done = atomic_load(worker->done);
+
+        if (edid_tx_process(worker->manager, 0) == 0)
+        {
+            if (done)
+            {
+                return NULL;
+            }
+            sched_yield();
+        }
+    }
+}
+
+static size_t bench_tx_entry(const struct edid_corpus *corpus, unsigned int round, unsigned int tx_id, size_t *length)
+{
+    size_t entry = (tx_id + (size_t)(round / 4) * 131) % corpus->count;
+
+    *length = (size_t)corpus->block_counts[entry] * EDID_LENGTH;
+    *length = *length < EDID_TX_MAX_LENGTH ? *length : EDID_TX_MAX_LENGTH;
+    return entry;
+}
+
+/**
+ * Replays every round through a fresh manager, then checks every channel's
+ * decoded result and register window against a fresh decode of the EDID it
+ * last reported. With no worker threads the submitting thread applies the
+ * events itself whenever the queue fills.
+ */
+static uint64_t bench_tx_pass(const struct edid_corpus *corpus, struct edid_reg_region *region, unsigned int threads,
+                              unsigned int *started_out, uint64_t counts[4], size_t *mismatches)
+{
+    static struct edid_ext_info ext;
+    static unsigned char record[EDID_RECORD_MAX_SIZE], window[EDID_REG_STRIDE];
+    static struct edid_tx_manager manager;
+    struct bench_tx_worker workers[64];
+    struct edid_info info;
+    atomic_int done;
+    size_t last[EDID_TX_MAX_CHANNELS];
+    unsigned int started = 0;
+
+    memset((void *)region->words, 0, region->size);
+    if (!edid_tx_init(&manager, EDID_TX_MAX_CHANNELS, 0, edid_reg_region_burst, region, 0))
+    {
+        (*mismatches)++;
+        return 0;
+    }
+
+    atomic_init(&done, 0);
+    for (; started < threads; started++)
+    {
+        workers[started].manager = &manager;
+        workers[started].done = &done;
+        if (pthread_create(&workers[started].thread, NULL, bench_tx_worker_main, &workers[started]) != 0)
+        {
+            break;
+        }
+    }
+
+    uint64_t start = bench_now_ns();
+    for (unsigned int round = 0; round < BENCH_TX_ROUNDS; round++)
+    {
+        for (unsigned int tx_id = 0; tx_id < EDID_TX_MAX_CHANNELS; tx_id++)
+        {
+            size_t length;
+            size_t entry = bench_tx_entry(corpus, round, tx_id, &length);
+
+            while (!edid_tx_submit(&manager, tx_id, corpus->data + corpus->offsets[entry], length))
+            {
+                // Queue full: help drain it
+                edid_tx_process(&manager, 1);
+            }
+            last[tx_id] = entry;
+        }
+    }
+    atomic_store(&done, 1);
+    for (unsigned int i = 0; i < started; i++)
+    {
+        pthread_join(workers[i].thread, NULL);
+    }
+    edid_tx_process(&manager, 0);
+    uint64_t elapsed = bench_now_ns() - start;
+
+    for (unsigned int tx_id = 0; tx_id < EDID_TX_MAX_CHANNELS; tx_id++)
+    {
+        const struct edid_tx_slot *slot = &manager.slots[tx_id];
+        const unsigned char *edid = corpus->data + corpus->offsets[last[tx_id]];
+        size_t length = (size_t)corpus->block_counts[last[tx_id]] * EDID_LENGTH;
+
+        length = length < EDID_TX_MAX_LENGTH ? length : EDID_TX_MAX_LENGTH;
+        counts[0] += slot->decodes;
+        counts[1] += slot->unchanged;
+        counts[2] += slot->stale;
+        counts[3] += slot->sink.bursts;
+
+        parse_edid_struct(edid, &info);
+        parse_edid_extensions(edid, length, &ext);
+        size_t written = edid_record_write(&info, ext.block_count ? &ext : NULL, record,
+                                           sizeof(record));
+        for (size_t w = 0; w < EDID_REG_STRIDE / 4; w++)
+        {
+            uint32_t value = region->words[EDID_REG_WINDOW(tx_id) / 4 + w];
+
+            window[w * 4] = (unsigned char)value;
+            window[w * 4 + 1] = (unsigned char)(value >> 8);
+            window[w * 4 + 2] = (unsigned char)(value >> 16);
+            window[w * 4 + 3] = (unsigned char)(value >> 24);
+        }
+        if (slot->length != length || memcmp(slot->data, edid, length) != 0 ||
+            memcmp(&slot->info, &info, sizeof(info)) != 0 || memcmp(&slot->ext, &ext, sizeof(ext)) != 0 ||
+            memcmp(window, record, written) != 0)
+        {
+            if ((*mismatches)++ == 0)
+            {
+                fprintf(stderr, "Channel %u does not hold its last EDID\n", tx_id);
+            }
+        }
+    }
+
+    edid_tx_free(&manager);
+    *started_out = started;
+    return elapsed;
+}
+
+/**
+ * Replays power cycles of an EDID_TX_MAX_CHANNELS port switch: every round
+ * all channels reconnect at once, and every fourth round the sinks change.
+ * The events go through the hotplug manager twice, once applied by the
+ * submitting thread alone and once by worker threads, and are compared with
+ * decoding and publishing every event.
+ *
+ * @param path Corpus file, hex lines or a binary archive
+ * @param threads Worker threads, or 0 for one per processor
+ * @return 0 on success, 1 if the corpus cannot be loaded or a channel is wrong
+ */
+int edid_bench_tx(const char *path, unsigned int threads)
+{
+    static struct edid_ext_info ext;
+    struct edid_reg_region region;
+    struct edid_corpus corpus;
+    struct edid_info info;
+    size_t mismatches = 0, events = (size_t)BENCH_TX_ROUNDS * EDID_TX_MAX_CHANNELS;
+    uint64_t full_ns = 0, inline_counts[4] = {0}, counts[4] = {0};
+    unsigned int started;
+    char label[32];
+
+    if (!edid_corpus_load(path, &corpus))
+    {
+        fprintf(stderr, "Cannot load corpus %s\n", path);
+        return 1;
+    }
+    threads = threads ? threads : edid_corpus_default_threads();
+    threads = threads < 64 ? threads : 64;
+    region.origin = 0;
+    region.size = EDID_REG_WINDOW(EDID_TX_MAX_CHANNELS);
+    region.rejected = 0;
+    region.words = calloc(region.size / 4, sizeof(uint32_t));
+    if (!region.words)
+    {
+        edid_corpus_free(&corpus);
+        return 1;
+    }
+
+    // Baseline: decode and publish every event, changed or not
+    for (unsigned int round = 0; round < BENCH_TX_ROUNDS; round++)
+    {
+        for (unsigned int tx_id = 0; tx_id < EDID_TX_MAX_CHANNELS; tx_id++)
+        {
+            size_t length;
+            const unsigned char *edid = corpus.data + corpus.offsets[bench_tx_entry(&corpus, round, tx_id, &length)];
+            struct edid_reg_sink sink;
+
+            uint64_t start = bench_now_ns();
+            parse_edid_struct(edid, &info);
+            parse_edid_extensions(edid, length, &ext);
+            edid_reg_sink_init(&sink, edid_reg_region_burst, &region, 0, tx_id);
+            edid_reg_write_record(&sink, &info, ext.block_count ? &ext : NULL);
+            full_ns += bench_now_ns() - start;
+        }
+    }
+
+    uint64_t inline_ns = bench_tx_pass(&corpus, &region, 0, &started, inline_counts, &mismatches);
+    uint64_t managed_ns = bench_tx_pass(&corpus, &region, threads, &started, counts, &mismatches);
+
+    printf("Hotplug manager, %zu events on %d channels:\n", events, EDID_TX_MAX_CHANNELS);
+    printf("  %-28s %10.1f ns/event\n", "decode and write every event", (double)full_ns / events);
+    printf("  %-28s %10.1f ns/event\n", "manager, submitter applies", (double)inline_ns / events);
+    snprintf(label, sizeof(label), "manager, %u worker threads", started);
+    printf("  %-28s %10.1f ns/event\n", label, (double)managed_ns / events);
+    printf("  %-28s %10llu decoded, %llu unchanged, %llu stale, %llu bursts\n", "events with workers",
+           (unsigned long long)counts[0], (unsigned long long)counts[1], (unsigned long long)counts[2],
+           (unsigned long long)counts[3]);
+
+    if (mismatches)
+    {
+        fprintf(stderr, "%zu channels are wrong\n", mismatches);
+    }
+    free((void *)region.words);
+    edid_corpus_free(&corpus);
+    return mismatches ? 1 : 0;
+}
+
+/**
+ * One measured stage of --bench-stages. Base block stages run on block 0 of
+ * every EDID; whole-EDID stages on all of its blocks.
+ */
+enum bench_stage_kind
+{
+    STAGE_HEX,
+    STAGE_HEADER,
+    STAGE_CHECKSUM,
+    STAGE_SECTION,
+    STAGE_STRUCT,
+    STAGE_EXTENSIONS,
+    STAGE_TEXT
+};
+
+struct bench_stage
+{
+    const char *name;
+    enum bench_stage_kind kind;
+    void (*section)(const unsigned char *edid, struct edid_sink *sink);
+};
+
+static const struct bench_stage bench_stages[] = {
+    {"string_to_hex", STAGE_HEX, NULL},
+    {"check_header", STAGE_HEADER, NULL},
+    {"verify_edid_checksum", STAGE_CHECKSUM, NULL},
+    {"parse_edid_version", STAGE_SECTION, parse_edid_version},
+    {"parse_manufacturer_id", STAGE_SECTION, parse_manufacturer_id},
+    {"parse_product_code", STAGE_SECTION, parse_product_code},
+    {"parse_serial_number", STAGE_SECTION, parse_serial_number},
+    {"parse_manufacture_date", STAGE_SECTION, parse_manufacture_date},
+    {"parse_video_input", STAGE_SECTION, parse_video_input},
+    {"parse_screen_size", STAGE_SECTION, parse_screen_size},
+    {"parse_display_gamma", STAGE_SECTION, parse_display_gamma},
+    {"parse_supported_features", STAGE_SECTION, parse_supported_features},
+    {"parse_colour_characteristics", STAGE_SECTION, parse_colour_characteristics},
+    {"parse_established_timings", STAGE_SECTION, parse_established_timings},
+    {"parse_standard_timings", STAGE_SECTION, parse_standard_timings},
+    {"parse_descriptors", STAGE_SECTION, parse_descriptors},
+    {"parse_edid_struct", STAGE_STRUCT, NULL},
+    {"parse_edid_extensions", STAGE_EXTENSIONS, NULL},
+    {"full text output", STAGE_TEXT, NULL},
+};
+
+/**
+ * Writes every EDID of a corpus as a line of space separated hex.
+ *
+ * @return Buffer holding the NUL terminated lines back to back, offsets[i] giving the start of line i, or NULL
+ */
+static char *bench_corpus_hex(const struct edid_corpus *corpus, size_t *offsets)
+{
+    static const char digits[] = "0123456789ABCDEF";
+    char *text = malloc(corpus->blocks * EDID_LENGTH * 3 + corpus->count);
+    size_t pos = 0;
+
+    if (!text)
+    {
+        return NULL;
+    }
+    for (size_t i = 0; i < corpus->count; i++)
+    {
+        const unsigned char *edid = corpus->data + corpus->offsets[i];
+        size_t length = (size_t)corpus->block_counts[i] * EDID_LENGTH;
+
+        offsets[i] = pos;
+        for (size_t k = 0; k < length; k++)
+        {
+            text[pos++] = digits[edid[k] >> 4];
+            text[pos++] = digits[edid[k] & 0x0F];
+            text[pos++] = ' ';
+        }
+        text[pos - 1] = '\0';
+    }
+    return text;
+}
+
+static size_t run_stage(const struct bench_stage *stage, const struct edid_corpus *corpus, const char *hex,
+                        const size_t *hex_offsets, unsigned char *scratch, char *text, size_t text_capacity)
+{
+    static struct edid_ext_info ext;
+    struct edid_info info;
+    struct edid_sink sink;
+    size_t result = 0;
+
+    for (size_t i = 0; i < corpus->count; i++)
+    {
+        const unsigned char *edid = corpus->data + corpus->offsets[i];
+        size_t length = (size_t)corpus->block_counts[i] * EDID_LENGTH;
+
+        switch (stage->kind)
+        {
+        case STAGE_HEX:
+            result += string_to_hex(hex + hex_offsets[i], scratch, EDID_LENGTH * 256);
+            break;
+        case STAGE_HEADER:
+            result += (size_t)check_header(edid);
+            break;
+        case STAGE_CHECKSUM:
+            result += (size_t)verify_edid_checksum(edid);
+            break;
+        case STAGE_SECTION:
+            edid_sink_init(&sink, text, text_capacity);
+            stage->section(edid, &sink);
+            result += sink.length;
+            break;
+        case STAGE_STRUCT:
+            result += (size_t)parse_edid_struct(edid, &info);
+            break;
+        case STAGE_EXTENSIONS:
+            result += (size_t)parse_edid_extensions(edid, length, &ext);
+            break;
+        case STAGE_TEXT:
+            result += parse_edid_blocks(edid, length, text, text_capacity);
+            break;
+        }
+    }
+    return result;
+}
+
+/**
+ * Times each decode stage on its own over a synthetic corpus from
+ * edid_corpus_synthesize(), so a change to one stage can be measured
+ * without the others hiding it.
+ *
+ * @param count Number of EDIDs in the corpus
+ * @param seed Corpus seed
+ * @return 0 on success, 1 on allocation failure
+ */
+int edid_bench_stages(unsigned int count, uint32_t seed)
+{
+    static char text[16384];
+    struct edid_corpus corpus;
+    volatile size_t sink = 0;
+
+    if (count == 0)
+    {
+        count = 1;
+    }
+    if (!edid_corpus_synthesize(count, seed, &corpus))
+    {
+        return 1;
+    }
+    size_t *hex_offsets = malloc(corpus.count * sizeof(*hex_offsets));
+    unsigned char *scratch = malloc(EDID_LENGTH * 256);
+    char *hex = hex_offsets ? bench_corpus_hex(&corpus, hex_offsets) : NULL;
+    if (!hex_offsets || !scratch || !hex)
+    {
+        free(hex_offsets);
+        free(scratch);
+        free(hex);
+        edid_corpus_free(&corpus);
+        return 1;
+    }
+
+    size_t valid = 0;
+    for (size_t i = 0; i < corpus.count; i++)
+    {
+        valid += (size_t)verify_edid_checksum(corpus.data + corpus.offsets[i]) &
+                 (size_t)check_header(corpus.data + corpus.offsets[i]);
+    }
+
+    unsigned int passes = 1 + 200000 / count;
+    printf("Decode stages, %zu synthetic EDIDs (seed %u, %zu blocks, %zu valid base blocks), %u passes:\n",
+           corpus.count, (unsigned)seed, corpus.blocks, valid, passes);
+
+    for (size_t s = 0; s < sizeof(bench_stages) / sizeof(bench_stages[0]); s++)
+    {
+        const struct bench_stage *stage = &bench_stages[s];
+        int whole = stage->kind == STAGE_HEX || stage->kind == STAGE_EXTENSIONS || stage->kind == STAGE_TEXT;
+        double blocks = (double)(whole ? corpus.blocks : corpus.count) * passes;
+
+#if BENCH_COUNT_ALLOCATIONS
+        uint64_t allocations = atomic_load(&bench_allocations);
+#endif
+        uint64_t start = bench_now_ns();
+        for (unsigned int p = 0; p < passes; p++)
+        {
+            sink += run_stage(stage, &corpus, hex, hex_offsets, scratch, text, sizeof(text));
+        }
+        uint64_t elapsed = bench_now_ns() - start;
+
+        printf("  %-30s %10.1f ns/EDID %14.0f blocks/s", stage->name, (double)elapsed / ((double)corpus.count * passes),
+               elapsed ? blocks * 1e9 / elapsed : 0.0);
+#if BENCH_COUNT_ALLOCATIONS
+        printf(" %8.2f allocs/EDID\n",
+               (double)(atomic_load(&bench_allocations) - allocations) / ((double)corpus.count * passes));
+#else
+        printf("\n");
+#endif
+    }
+
+    (void)sink;
+    free(hex_offsets);
+    free(scratch);
+    free(hex);
+    edid_corpus_free(&corpus);
+    return 0;
+}
+
+/**
+ * Writes a synthetic corpus from edid_corpus_synthesize() to stdout as hex
+ * lines, for the benchmarks that take a corpus file.
+ *
+ * @param count Number of EDIDs
+ * @param seed Corpus seed
+ * @return 0 on success, 1 on allocation failure
+ */
+int edid_write_synthetic(unsigned int count, uint32_t seed)
+{
+    struct edid_corpus corpus;
+
+    if (!edid_corpus_synthesize(count, seed, &corpus))
+    {
+        return 1;
+    }
+    size_t *offsets = malloc((corpus.count ? corpus.count : 1) * sizeof(*offsets));
+    char *hex = offsets ? bench_corpus_hex(&corpus, offsets) : NULL;
+    if (!hex)
+    {
+        free(offsets);
+        edid_corpus_free(&corpus);
+        return 1;
+    }
+    for (size_t i = 0; i < corpus.count; i++)
+    {
+        puts(hex + offsets[i]);
+    }
+    free(offsets);
+    free(hex);
+    edid_corpus_free(&corpus);
+    return 0;
+}
+
+/**
+ * Checks the generated timing tables against the computation they replaced
+ * for every input: all 65536 values of bytes 35-36 with each value of byte
+ * 37, and every standard timing encoding in every slot. Then times both on
+ * the bench EDID with its timing bytes varied.
+ *
+ * @param iterations Number of timed decodes per variant
+ * @return 0 on success, 1 if any output differs
+ */
+int edid_bench_timings(unsigned int iterations)
+{
+    char text[2048], expected[2048];
+    unsigned char edid[EDID_LENGTH];
+    struct edid_sink sink, legacy;
+    size_t mismatches = 0;
+    volatile size_t total = 0;
+
+    if (iterations == 0)
+    {
+        iterations = 1;
+    }
+    edid_hex_decode(bench_edid_hex, strlen(bench_edid_hex), edid, sizeof(edid), NULL);
+
+    for (uint32_t value = 0; value < 0x1000000; value += value < 0x10000 ? 1 : 0x10000)
+    {
+        edid[35] = (uint8_t)(value >> 8);
+        edid[36] = (uint8_t)value;
+        edid[37] = (uint8_t)(value >> 16);
+        edid_sink_init(&sink, text, sizeof(text));
+        parse_established_timings(edid, &sink);
+        edid_sink_init(&legacy, expected, sizeof(expected));
+        legacy_established_timings(edid, &legacy);
+        mismatches += sink.length != legacy.length || memcmp(text, expected, sink.length) != 0;
+    }
+
+    for (uint32_t value = 0; value < 0x10000; value++)
+    {
+        // Each slot gets a different encoding so every slot sees every value
+        for (int slot = 0; slot < EDID_STANDARD_TIMING_COUNT; slot++)
+        {
+            uint16_t encoding = (uint16_t)(value + slot * 0x2001u);
+
+            edid[38 + slot * 2] = (uint8_t)(encoding >> 8);
+            edid[39 + slot * 2] = (uint8_t)encoding;
+        }
+        edid_sink_init(&sink, text, sizeof(text));
+        parse_standard_timings(edid, &sink);
+        edid_sink_init(&legacy, expected, sizeof(expected));
+        legacy_standard_timings(edid, &legacy);
+        mismatches += sink.length != legacy.length || memcmp(text, expected, sink.length) != 0;
+    }
+
+    if (mismatches)
+    {
+        fprintf(stderr, "Timing tables differ from the computed timings for %zu inputs\n", mismatches);
+        return 1;
+    }
+
+    printf("Timing tables, %u iterations, all inputs match:\n", iterations);
+
+    uint64_t start = bench_now_ns();
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        edid[35] = (uint8_t)i;
+        edid[36] = (uint8_t)(i * 7);
+        edid_sink_init(&sink, text, sizeof(text));
+        legacy_established_timings(edid, &sink);
+        total += sink.length;
+    }
+    report("established, bit loop", bench_now_ns() - start, iterations, sink.length);
+
+    start = bench_now_ns();
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        edid[35] = (uint8_t)i;
+        edid[36] = (uint8_t)(i * 7);
+        edid_sink_init(&sink, text, sizeof(text));
+        parse_established_timings(edid, &sink);
+        total += sink.length;
+    }
+    report("established, tables", bench_now_ns() - start, iterations, sink.length);
+
+    start = bench_now_ns();
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        edid[38] = (uint8_t)i;
+        edid[41] = (uint8_t)(i * 7);
+        edid_sink_init(&sink, text, sizeof(text));
+        legacy_standard_timings(edid, &sink);
+        total += sink.length;
+    }
+    report("standard, switch", bench_now_ns() - start, iterations, sink.length);
+
+    start = bench_now_ns();
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        edid[38] = (uint8_t)i;
+        edid[41] = (uint8_t)(i * 7);
+        edid_sink_init(&sink, text, sizeof(text));
+        parse_standard_timings(edid, &sink);
+        total += sink.length;
+    }
+    report("standard, tables", bench_now_ns() - start, iterations, sink.length);
+
+    (void)total;
+    return 0;
+}
+
+#define BENCH_MODE_GROUP 16
+
+/**
+ * The text search a switch used to find common modes: every timing line of
+ * the first sink's report looked up in the reports of the others.
+ */
+static size_t legacy_common_lines(char *const *texts, size_t count)
+{
+    size_t common = 0;
+    const char *line = texts[0];
+
+    while ((line = strstr(line, "\n - ")) != NULL)
+    {
+        char needle[64];
+        const char *end = strchr(line + 1, '\n');
+        size_t length = end ? (size_t)(end - line) : strlen(line);
+        size_t found = 1;
+
+        if (length >= sizeof(needle))
+        {
+            length = sizeof(needle) - 1;
+        }
+        memcpy(needle, line, length);
+        needle[length] = '\0';
+        for (size_t s = 1; s < count && found; s++)
+        {
+            found = strstr(texts[s], needle) != NULL;
+        }
+        common += found;
+        line += length;
+    }
+    return common;
+}
+
+/**
+ * Builds the mode set of every EDID in a corpus and checks it: sorted,
+ * without duplicates, and holding every advertised timing. Then intersects
+ * groups of BENCH_MODE_GROUP sinks, checking each common mode against every
+ * member, and times that against searching the text reports.
+ *
+ * @param path Corpus file, hex lines or a binary archive
+ * @return 0 on success, 1 if the corpus cannot be loaded or a set is wrong
+ */
+int edid_bench_modes(const char *path)
+{
+    static struct edid_ext_info ext;
+    static char texts[BENCH_MODE_GROUP][8192];
+    struct edid_mode_set *sets;
+    struct edid_mode_set common;
+    struct edid_corpus corpus;
+    struct edid_info info;
+    struct edid_mode mode;
+    uint64_t build_ns = 0, intersect_ns = 0, legacy_ns = 0, query_ns = 0;
+    size_t mismatches = 0, modes = 0, groups = 0, common_modes = 0;
+    volatile size_t total = 0;
+
+    if (!edid_corpus_load(path, &corpus))
+    {
+        fprintf(stderr, "Cannot load corpus %s\n", path);
+        return 1;
+    }
+    sets = malloc((corpus.count ? corpus.count : 1) * sizeof(*sets));
+    if (!sets)
+    {
+        edid_corpus_free(&corpus);
+        return 1;
+    }
+
+    for (size_t i = 0; i < corpus.count; i++)
+    {
+        const unsigned char *edid = corpus.data + corpus.offsets[i];
+        size_t length = (size_t)corpus.block_counts[i] * EDID_LENGTH;
+
+        parse_edid_struct(edid, &info);
+        parse_edid_extensions(edid, length, &ext);
+        uint64_t start = bench_now_ns();
+        edid_mode_set_build(&info, &ext, &sets[i]);
+        build_ns += bench_now_ns() - start;
+        modes += sets[i].count;
+
+        int ok = 1;
+        for (uint16_t k = 1; k < sets[i].count; k++)
+        {
+            ok &= sets[i].keys[k - 1] < sets[i].keys[k];
+        }
+        for (int k = 0; k < info.standard_timing_count; k++)
+        {
+            const struct edid_standard_timing *t = &info.standard_timings[k];
+            ok &= edid_mode_set_contains(&sets[i], t->horizontal_resolution, t->vertical_resolution, t->vertical_frequency, 0);
+        }
+        for (int k = 0; k < ext.cta.vic_count; k++)
+        {
+            const struct edid_cta_vic *vic = edid_cta_vic_lookup(ext.cta.vics[k]);
+            ok &= !vic || edid_mode_set_contains(&sets[i], vic->width, vic->height, vic->refresh, vic->interlaced);
+        }
+        ok &= !(info.established_timings & 0x0008) || edid_mode_set_contains(&sets[i], 1024, 768, 60, 0);
+        if (!ok && mismatches++ == 0)
+        {
+            fprintf(stderr, "Mode set of EDID %zu is unsorted or misses a timing\n", i);
+        }
+
+        start = bench_now_ns();
+        total += (size_t)edid_mode_set_contains(&sets[i], 1920, 1080, 60, 0);
+        query_ns += bench_now_ns() - start;
+    }
+
+    for (size_t first = 0; first + BENCH_MODE_GROUP <= corpus.count; first += BENCH_MODE_GROUP)
+    {
+        const struct edid_mode_set *group[BENCH_MODE_GROUP];
+        char *text_group[BENCH_MODE_GROUP];
+
+        for (size_t k = 0; k < BENCH_MODE_GROUP; k++)
+        {
+            const unsigned char *edid = corpus.data + corpus.offsets[first + k];
+
+            group[k] = &sets[first + k];
+            text_group[k] = texts[k];
+            parse_edid_blocks(edid, (size_t)corpus.block_counts[first + k] * EDID_LENGTH, texts[k], sizeof(texts[k]));
+        }
+
+        uint64_t start = bench_now_ns();
+        size_t count = edid_mode_set_intersect(group, BENCH_MODE_GROUP, &common);
+        total += (size_t)edid_mode_set_best(&common, &mode);
+        uint64_t middle = bench_now_ns();
+        total += legacy_common_lines(text_group, BENCH_MODE_GROUP);
+        intersect_ns += middle - start;
+        legacy_ns += bench_now_ns() - middle;
+        groups++;
+        common_modes += count;
+
+        // Every common mode is in every set, and every mode of the first set in all sets is common
+        int ok = 1;
+        for (uint16_t m = 0; m < common.count; m++)
+        {
+            for (size_t k = 0; k < BENCH_MODE_GROUP; k++)
+            {
+                ok &= edid_mode_set_find(group[k], common.keys[m]) >= 0;
+            }
+        }
+        size_t expected = 0;
+        for (uint16_t m = 0; m < group[0]->count; m++)
+        {
+            size_t k = 1;
+            while (k < BENCH_MODE_GROUP && edid_mode_set_find(group[k], group[0]->keys[m]) >= 0)
+            {
+                k++;
+            }
+            expected += k == BENCH_MODE_GROUP;
+        }
+        ok &= expected == count;
+        if (!ok && mismatches++ == 0)
+        {
+            fprintf(stderr, "Common modes of the group starting at EDID %zu are wrong\n", first);
+        }
+    }
+
+    double count = corpus.count ? (double)corpus.count : 1.0;
+    printf("Mode sets, %zu EDIDs, %.1f modes each:\n", corpus.count, (double)modes / count);
+    printf("  %-28s %10.1f ns/EDID\n", "edid_mode_set_build", (double)build_ns / count);
+    printf("  %-28s %10.1f ns/query\n", "contains 1920x1080@60", (double)query_ns / count);
+    printf("  %-28s %10.1f ns/group, %.2f common modes\n", "intersect 16 sinks + best", groups ? (double)intersect_ns / groups : 0.0,
+           groups ? (double)common_modes / groups : 0.0);
+    printf("  %-28s %10.1f ns/group\n", "text search, 16 sinks", groups ? (double)legacy_ns / groups : 0.0);
+
+    if (mismatches)
+    {
+        fprintf(stderr, "%zu mode sets are wrong\n", mismatches);
+    }
+    (void)total;
+    free(sets);
+    edid_corpus_free(&corpus);
+    return mismatches ? 1 : 0;
+}
+
+/**
+ * Checks every edid_view accessor against parse_edid_struct() over a corpus,
+ * then times reading only the vendor, product and serial through a view
+ * against decoding the whole base block for them.
+ */
+int edid_bench_view(const char *path)
+{
+    struct edid_corpus corpus;
+    struct edid_info info;
+    uint64_t view_ns = 0, full_ns = 0;
+    uint32_t checksum = 0, expected = 0;
+    size_t mismatches = 0;
+    unsigned int rounds;
+
+    if (!edid_corpus_load(path, &corpus))
+    {
+        fprintf(stderr, "Cannot load corpus %s\n", path);
+        return 1;
+    }
+
+    for (size_t i = 0; i < corpus.count; i++)
+    {
+        const unsigned char *edid = corpus.data + corpus.offsets[i];
+        struct edid_view view;
+        struct edid_chromaticity points;
+        struct edid_range_limits range;
+        struct edid_detailed_timing timing;
+        char vendor[4], name[EDID_DESCRIPTOR_TEXT_LENGTH + 1];
+        int ok = 1, standard = 0, detailed = 0, has_range = 0;
+
+        int valid = edid_view_init(&view, edid, (size_t)corpus.block_counts[i] * EDID_LENGTH);
+        parse_edid_struct(edid, &info);
+        ok &= valid == (info.status == EDID_STATUS_OK && info.header_valid) && view.status == info.status;
+        if (!info.header_valid)
+        {
+            ok &= (view.status & EDID_STATUS_BAD_HEADER) != 0;
+            if (!ok && mismatches++ == 0)
+            {
+                fprintf(stderr, "View of EDID %zu differs from the decoded fields\n", i);
+            }
+            continue;
+        }
+
+        edid_vendor(&view, vendor);
+        edid_chromaticity_points(&view, &points);
+        ok &= strcmp(vendor, info.manufacturer_id) == 0 && edid_product(&view) == info.product_code &&
+              edid_serial(&view) == info.serial_number && edid_manufacture_week(&view) == info.manufacture_week &&
+              edid_manufacture_year(&view) == info.manufacture_year && edid_version(&view) == info.version &&
+              edid_revision(&view) == info.revision && edid_video_input(&view) == info.video_input &&
+              edid_screen_width_cm(&view) == info.horizontal_size_cm &&
+              edid_screen_height_cm(&view) == info.vertical_size_cm && edid_gamma(&view) == info.gamma_encoded &&
+              edid_features(&view) == info.features && memcmp(&points, &info.chromaticity, sizeof(points)) == 0 &&
+              edid_established(&view) == info.established_timings &&
+              edid_manufacturer_timings(&view) == info.manufacturer_timings &&
+              edid_extension_count(&view) == edid[126];
+
+        for (int s = 0; s < EDID_STANDARD_TIMING_COUNT; s++)
+        {
+            struct edid_standard_timing t;
+
+            if (edid_std_timing(&view, s, &t))
+            {
+                ok &= standard < info.standard_timing_count &&
+                      memcmp(&t, &info.standard_timings[standard], sizeof(t)) == 0;
+                standard++;
+            }
+        }
+        ok &= standard == info.standard_timing_count;
+
+        for (int d = 0; d < EDID_DESCRIPTOR_COUNT; d++)
+        {
+            ok &= edid_descriptor_tag(&view, d) == info.descriptor_tags[d];
+            if (edid_detailed_timing(&view, d, &timing))
+            {
+                ok &= detailed < info.detailed_timing_count &&
+                      memcmp(&timing, &info.detailed_timings[detailed], sizeof(timing)) == 0;
+                detailed++;
+            }
+            // With several range limits descriptors the decode keeps the last
+            has_range |= edid_descriptor_range_limits(&view, d, &range);
+        }
+        ok &= detailed == info.detailed_timing_count && has_range == info.has_range_limits &&
+              (!has_range || memcmp(&range, &info.range_limits, sizeof(range)) == 0);
+        edid_monitor_name(&view, name);
+        ok &= strcmp(name, info.monitor_name) == 0;
+
+        if (!ok && mismatches++ == 0)
+        {
+            fprintf(stderr, "View of EDID %zu differs from the decoded fields\n", i);
+        }
+    }
+
+    // Enough rounds for about a million lookups
+    rounds = corpus.count ? (unsigned int)(1000000 / corpus.count) + 1 : 0;
+
+    uint64_t start = bench_now_ns();
+    for (unsigned int r = 0; r < rounds; r++)
+    {
+        for (size_t i = 0; i < corpus.count; i++)
+        {
+            struct edid_view view;
+            char vendor[4];
+
+            if (edid_view_init(&view, corpus.data + corpus.offsets[i], EDID_LENGTH))
+            {
+                edid_vendor(&view, vendor);
+                checksum += (uint32_t)vendor[0] + edid_product(&view) + edid_serial(&view);
+            }
+        }
+    }
+    view_ns = bench_now_ns() - start;
+
+    start = bench_now_ns();
+    for (unsigned int r = 0; r < rounds; r++)
+    {
+        for (size_t i = 0; i < corpus.count; i++)
+        {
+            if (parse_edid_struct(corpus.data + corpus.offsets[i], &info) && info.status == EDID_STATUS_OK)
+            {
+                expected += (uint32_t)info.manufacturer_id[0] + info.product_code + info.serial_number;
+            }
+        }
+    }
+    full_ns = bench_now_ns() - start;
+
+    if (checksum != expected && mismatches++ == 0)
+    {
+        fprintf(stderr, "Vendor, product and serial read through views differ from the full decode\n");
+    }
+
+    double lookups = rounds * (double)corpus.count;
+    printf("EDID views, %zu EDIDs x %u rounds:\n", corpus.count, rounds);
+    printf("  %-28s %10.1f ns/EDID\n", "view: vendor/product/serial", lookups ? (double)view_ns / lookups : 0.0);
+    printf("  %-28s %10.1f ns/EDID\n", "parse_edid_struct", lookups ? (double)full_ns / lookups : 0.0);
+
+    if (mismatches)
+    {
+        fprintf(stderr, "%zu views differ from the decoded fields\n", mismatches);
+    }
+    edid_corpus_free(&corpus);
+    return mismatches ? 1 : 0;
+}
+
+#define BENCH_PNP_MAX 4096
+
+struct bench_pnp_entry
+{
+    char id[4];
+    char name[128];
+};
+
+/**
+ * Name lookup the way a report tool without the table would do it: a linear
+ * scan comparing the three letters.
+ */
+static const char *legacy_pnp_lookup(const struct bench_pnp_entry *entries, size_t count, const char *id)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        if (strcmp(entries[i].id, id) == 0)
+        {
+            return entries[i].name;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Checks the generated PNP table against the registry it was built from:
+ * every listed ID resolves to its name and no other ID resolves. Then times
+ * table lookups against a linear search over the registry.
+ *
+ * @param path Registry, normally data/pnp_ids.txt
+ * @return 0 on success, 1 if the table and the registry disagree
+ */
+int edid_bench_pnp(const char *path)
+{
+    static struct bench_pnp_entry entries[BENCH_PNP_MAX];
+    FILE *file = fopen(path, "r");
+    char line[256], ids[256][4];
+    size_t count = 0, mismatches = 0, known = 0;
+    uint32_t seed = 12345, hits = 0, legacy_hits = 0;
+    const unsigned int iterations = 1000000;
+
+    if (!file)
+    {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return 1;
+    }
+    while (fgets(line, sizeof(line), file) && count < BENCH_PNP_MAX)
+    {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0] == '#' || strlen(line) < 5 || line[3] != '\t')
+        {
+            continue;
+        }
+        memcpy(entries[count].id, line, 3);
+        entries[count].id[3] = '\0';
+        snprintf(entries[count].name, sizeof(entries[count].name), "%.127s", line + 4);
+        count++;
+    }
+    fclose(file);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const char *name = edid_pnp_lookup(entries[i].id);
+
+        if ((!name || strcmp(name, entries[i].name) != 0) && mismatches++ == 0)
+        {
+            fprintf(stderr, "%s resolves to %s instead of %s\n", entries[i].id, name ? name : "nothing", entries[i].name);
+        }
+    }
+    for (uint32_t id = 0; id < 0x10000; id++)
+    {
+        known += edid_pnp_name((uint16_t)id) != NULL;
+    }
+    // Bit 15 is ignored, so every listed ID resolves twice
+    if (known != count * 2 && mismatches++ == 0)
+    {
+        fprintf(stderr, "%zu IDs resolve, expected %zu\n", known / 2, count);
+    }
+
+    // Lookups for a mix of listed and unlisted IDs, as decoded from bytes 8-9
+    for (int i = 0; i < 256; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        if (count && (seed >> 31))
+        {
+            memcpy(ids[i], entries[(seed >> 8) % count].id, 4);
+        }
+        else
+        {
+            ids[i][0] = (char)('A' + (seed >> 8) % 26);
+            ids[i][1] = (char)('A' + (seed >> 16) % 26);
+            ids[i][2] = (char)('A' + (seed >> 24) % 26);
+            ids[i][3] = '\0';
+        }
+    }
+
+    uint64_t start = bench_now_ns();
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        hits += edid_pnp_lookup(ids[i & 255]) != NULL;
+    }
+    uint64_t table_ns = bench_now_ns() - start;
+
+    start = bench_now_ns();
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        legacy_hits += legacy_pnp_lookup(entries, count, ids[i & 255]) != NULL;
+    }
+    uint64_t legacy_ns = bench_now_ns() - start;
+
+    if (hits != legacy_hits && mismatches++ == 0)
+    {
+        fprintf(stderr, "Table lookups found %u names, the linear search %u\n", hits, legacy_hits);
+    }
+
+    printf("PNP names, %zu registry entries, %u lookups:\n", count, iterations);
+    printf("  %-28s %10.1f ns/lookup\n", "edid_pnp_lookup", (double)table_ns / iterations);
+    printf("  %-28s %10.1f ns/lookup\n", "linear search", (double)legacy_ns / iterations);
+
+    if (mismatches)
+    {
+        fprintf(stderr, "%zu PNP table mismatches\n", mismatches);
+    }
+    return mismatches ? 1 : 0;
+}
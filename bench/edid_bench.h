@@ -0,0 +1,28 @@
+#ifndef EDID_BENCH_H
+#define EDID_BENCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "edid_corpus.h"
+
+int edid_bench_hex(unsigned int iterations);
+int edid_bench_batch(unsigned int count);
+int edid_bench_validate(unsigned int count);
+int edid_bench_corpus(const char *path, unsigned int max_threads);
+int edid_bench_threads(const char *path, unsigned int threads);
+int edid_bench_archive(const char *path);
+int edid_bench_record(const char *path);
+int edid_bench_fixed(unsigned int iterations);
+int edid_bench_cache(const char *path, unsigned int memory_kb);
+int edid_bench_reparse(const char *path);
+int edid_bench_regs(const char *path);
+int edid_bench_tx(const char *path, unsigned int threads);
+int edid_bench_modes(const char *path);
+int edid_bench_view(const char *path);
+int edid_bench_pnp(const char *path);
+int edid_bench_timings(unsigned int iterations);
+int edid_bench_stages(unsigned int count, uint32_t seed);
+int edid_write_synthetic(unsigned int count, uint32_t seed);
+int edid_corpus_synthesize(size_t count, uint32_t seed, struct edid_corpus *corpus);
+
+#endif
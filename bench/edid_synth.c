@@ -0,0 +1,389 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "parser.h"
+#include "edid_corpus.h"
+#include "edid_bench.h"
+/**
+ * Reproducible synthetic EDID corpora for the benchmarks
+ */
+
+#define SYNTH_MAX_EXTENSIONS 4
+
+static uint32_t synth_next(uint32_t *state)
+{
+    uint32_t x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+static uint32_t synth_range(uint32_t *state, uint32_t low, uint32_t high)
+{
+    return low + synth_next(state) % (high - low + 1);
+}
+
+static void synth_checksum(unsigned char *block)
+{
+    block[EDID_LENGTH - 1] = (uint8_t)(block[EDID_LENGTH - 1] - edid_block_sum(block));
+}
+
+static void synth_detailed_timing(unsigned char *desc, uint32_t *state)
+{
+    uint32_t clock = synth_range(state, 2500, 60000);
+    uint32_t ha = synth_range(state, 640, 4095), hb = synth_range(state, 40, 1000);
+    uint32_t va = synth_range(state, 480, 4095), vb = synth_range(state, 3, 200);
+    uint32_t hso = synth_range(state, 8, 600), hsw = synth_range(state, 8, 300);
+    uint32_t vso = synth_range(state, 1, 40), vsw = synth_range(state, 1, 40);
+    uint32_t hmm = synth_range(state, 0, 1600), vmm = synth_range(state, 0, 1000);
+
+    desc[0] = (uint8_t)clock;
+    desc[1] = (uint8_t)(clock >> 8);
+    desc[2] = (uint8_t)ha;
+    desc[3] = (uint8_t)hb;
+    desc[4] = (uint8_t)(((ha >> 8) << 4) | (hb >> 8));
+    desc[5] = (uint8_t)va;
+    desc[6] = (uint8_t)vb;
+    desc[7] = (uint8_t)(((va >> 8) << 4) | (vb >> 8));
+    desc[8] = (uint8_t)hso;
+    desc[9] = (uint8_t)hsw;
+    desc[10] = (uint8_t)(((vso & 0x0F) << 4) | (vsw & 0x0F));
+    desc[11] = (uint8_t)(((hso >> 8) << 6) | ((hsw >> 8) << 4) | ((vso >> 4) << 2) | (vsw >> 4));
+    desc[12] = (uint8_t)hmm;
+    desc[13] = (uint8_t)vmm;
+    desc[14] = (uint8_t)(((hmm >> 8) << 4) | (vmm >> 8));
+    desc[15] = 0;
+    desc[16] = 0;
+    desc[17] = (uint8_t)(0x18 | (synth_next(state) & 0x86));
+}
+
+static void synth_text_descriptor(unsigned char *desc, uint8_t tag, uint32_t *state)
+{
+    uint32_t length = synth_range(state, 1, EDID_DESCRIPTOR_TEXT_LENGTH);
+
+    memset(desc, 0, 5);
+    desc[3] = tag;
+    for (uint32_t i = 0; i < EDID_DESCRIPTOR_TEXT_LENGTH; i++)
+    {
+        desc[5 + i] = i < length ? (uint8_t)synth_range(state, 0x20, 0x7E) : (i == length ? 0x0A : 0x20);
+    }
+}
+
+static void synth_range_limits(unsigned char *desc, uint32_t *state)
+{
+    memset(desc, 0, 18);
+    desc[3] = EDID_DESCRIPTOR_RANGE_LIMITS;
+    desc[5] = (uint8_t)synth_range(state, 24, 60);
+    desc[6] = (uint8_t)synth_range(state, 60, 240);
+    desc[7] = (uint8_t)synth_range(state, 15, 60);
+    desc[8] = (uint8_t)synth_range(state, 60, 255);
+    desc[9] = (uint8_t)synth_range(state, 8, 60);
+    desc[10] = (uint8_t)(synth_next(state) % 3 == 0 ? 0x01 : 0x00);
+    desc[11] = 0x0A;
+    memset(desc + 12, 0x20, 6);
+}
+
+static void synth_descriptor(unsigned char *desc, uint32_t *state)
+{
+    switch (synth_next(state) % 7)
+    {
+    case 0:
+        synth_detailed_timing(desc, state);
+        break;
+    case 1:
+        synth_text_descriptor(desc, EDID_DESCRIPTOR_NAME, state);
+        break;
+    case 2:
+        synth_text_descriptor(desc, EDID_DESCRIPTOR_SERIAL, state);
+        break;
+    case 3:
+        synth_text_descriptor(desc, EDID_DESCRIPTOR_TEXT, state);
+        break;
+    case 4:
+        synth_range_limits(desc, state);
+        break;
+    case 5:
+        // Dummy descriptor
+        memset(desc, 0, 18);
+        desc[3] = 0x10;
+        break;
+    default:
+        // Arbitrary bytes: usually a timing with odd values, sometimes a tag no decoder knows
+        for (int i = 0; i < 18; i++)
+        {
+            desc[i] = (uint8_t)synth_next(state);
+        }
+        break;
+    }
+}
+
+/**
+ * Fills a base block. Sequential indices walk every bit pattern of the
+ * established timing bytes and every byte value of each standard timing slot.
+ */
+static void synth_base_block(unsigned char *block, uint32_t index, unsigned int extensions, uint32_t *state)
+{
+    static const unsigned char header[8] = {0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00};
+    uint32_t vendor = (synth_range(state, 1, 26) << 10) | (synth_range(state, 1, 26) << 5) | synth_range(state, 1, 26);
+    uint32_t serial = synth_next(state) % 4 == 0 ? 0 : synth_next(state);
+
+    memcpy(block, header, sizeof(header));
+    block[8] = (uint8_t)(vendor >> 8);
+    block[9] = (uint8_t)vendor;
+    block[10] = (uint8_t)synth_next(state);
+    block[11] = (uint8_t)synth_next(state);
+    block[12] = (uint8_t)serial;
+    block[13] = (uint8_t)(serial >> 8);
+    block[14] = (uint8_t)(serial >> 16);
+    block[15] = (uint8_t)(serial >> 24);
+    block[16] = (uint8_t)(synth_next(state) % 16 == 0 ? 0xFF : synth_range(state, 0, 54));
+    block[17] = (uint8_t)synth_range(state, 0, 40);
+    block[18] = 1;
+    block[19] = (uint8_t)synth_range(state, 3, 4);
+
+    // Alternate digital inputs (bit depth and interface) with analog ones (levels, setup, sync)
+    block[20] = index % 2 ? (uint8_t)(0x80 | (synth_range(state, 0, 7) << 4) | synth_range(state, 0, 5))
+                          : (uint8_t)(synth_next(state) & 0x7F);
+    block[21] = (uint8_t)synth_range(state, 0, 120);
+    block[22] = (uint8_t)synth_range(state, 0, 70);
+    block[23] = (uint8_t)synth_next(state);
+    block[24] = (uint8_t)synth_next(state);
+    for (int i = 25; i <= 34; i++)
+    {
+        block[i] = (uint8_t)synth_next(state);
+    }
+
+    block[35] = (uint8_t)index;
+    block[36] = (uint8_t)(index >> 8);
+    block[37] = (uint8_t)(index >> 16);
+    for (int slot = 0; slot < EDID_STANDARD_TIMING_COUNT; slot++)
+    {
+        unsigned char *timing = block + 38 + slot * 2;
+
+        if (synth_next(state) % 4 == 0)
+        {
+            timing[0] = 0x01;
+            timing[1] = 0x01;
+        }
+        else
+        {
+            timing[0] = (uint8_t)(index + slot * 37u);
+            timing[1] = (uint8_t)((index >> 8) * 13u + index + slot * 91u);
+        }
+    }
+
+    // The first descriptor holds the preferred timing as EDID 1.3 requires
+    synth_detailed_timing(block + 54, state);
+    for (int d = 1; d < EDID_DESCRIPTOR_COUNT; d++)
+    {
+        synth_descriptor(block + 54 + d * 18, state);
+    }
+
+    block[126] = (uint8_t)extensions;
+    block[127] = 0;
+    synth_checksum(block);
+}
+
+static void synth_cta_block(unsigned char *block, uint32_t *state)
+{
+    int pos = 4;
+
+    memset(block, 0, EDID_LENGTH);
+    block[0] = EDID_EXTENSION_CTA;
+    block[1] = 3;
+    block[3] = (uint8_t)((synth_next(state) & 0xF0) | synth_range(state, 0, 2));
+
+    // Video data block
+    int vics = (int)synth_range(state, 1, 20);
+    block[pos++] = (uint8_t)((2 << 5) | vics);
+    for (int i = 0; i < vics; i++)
+    {
+        uint8_t vic = (uint8_t)synth_range(state, 1, 219);
+        block[pos++] = (uint8_t)(vic <= 64 && synth_next(state) % 8 == 0 ? vic | 0x80 : vic);
+    }
+
+    // Audio data block
+    int sads = (int)synth_range(state, 1, 3);
+    block[pos++] = (uint8_t)((1 << 5) | (sads * 3));
+    for (int i = 0; i < sads; i++)
+    {
+        block[pos++] = (uint8_t)((synth_range(state, 1, 14) << 3) | synth_range(state, 0, 7));
+        block[pos++] = (uint8_t)(synth_next(state) & 0x7F);
+        block[pos++] = (uint8_t)synth_next(state);
+    }
+
+    // HDMI vendor specific block
+    block[pos++] = (uint8_t)((3 << 5) | 7);
+    block[pos++] = 0x03;
+    block[pos++] = 0x0C;
+    block[pos++] = 0x00;
+    block[pos++] = (uint8_t)(synth_range(state, 1, 4) << 4);
+    block[pos++] = 0x00;
+    block[pos++] = (uint8_t)synth_next(state);
+    block[pos++] = (uint8_t)synth_range(state, 33, 120);
+
+    if (synth_next(state) % 2)
+    {
+        // HDMI Forum vendor specific block
+        block[pos++] = (uint8_t)((3 << 5) | 7);
+        block[pos++] = 0xD8;
+        block[pos++] = 0x5D;
+        block[pos++] = 0xC4;
+        block[pos++] = 1;
+        block[pos++] = (uint8_t)synth_range(state, 68, 120);
+        block[pos++] = (uint8_t)synth_next(state);
+        block[pos++] = (uint8_t)synth_next(state);
+    }
+    if (synth_next(state) % 2)
+    {
+        // HDR static metadata extended block
+        block[pos++] = (uint8_t)((7 << 5) | 6);
+        block[pos++] = 6;
+        block[pos++] = (uint8_t)(synth_next(state) & 0x0F);
+        block[pos++] = 0x01;
+        block[pos++] = (uint8_t)synth_next(state);
+        block[pos++] = (uint8_t)synth_next(state);
+        block[pos++] = (uint8_t)synth_next(state);
+    }
+
+    block[2] = (uint8_t)pos;
+    while (pos + 18 <= EDID_LENGTH - 1 && synth_next(state) % 3 != 0)
+    {
+        synth_detailed_timing(block + pos, state);
+        pos += 18;
+    }
+    synth_checksum(block);
+}
+
+static void synth_displayid_block(unsigned char *block, uint32_t *state)
+{
+    int version2 = synth_next(state) % 2;
+    unsigned char *section = block + 1;
+    int pos = 4;
+
+    memset(block, 0, EDID_LENGTH);
+    block[0] = EDID_EXTENSION_DISPLAYID;
+    section[0] = version2 ? 0x20 : 0x12;
+    section[2] = (uint8_t)synth_range(state, 0, 4);
+
+    // Product identification with a short name
+    int name = (int)synth_range(state, 0, 8);
+    section[pos++] = version2 ? 0x20 : 0x00;
+    section[pos++] = 0;
+    section[pos++] = (uint8_t)(12 + name);
+    for (int i = 0; i < 12 + name; i++)
+    {
+        section[pos++] = i >= 12 ? (uint8_t)synth_range(state, 0x41, 0x5A) : (uint8_t)synth_next(state);
+    }
+
+    // One Type I or Type VII timing
+    section[pos++] = version2 ? 0x22 : 0x03;
+    section[pos++] = 0;
+    section[pos++] = 20;
+    for (int i = 0; i < 20; i++)
+    {
+        section[pos++] = (uint8_t)synth_next(state);
+    }
+
+    section[1] = (uint8_t)(pos - 4);
+    uint8_t sum = 0;
+    for (int i = 0; i < pos; i++)
+    {
+        sum += section[i];
+    }
+    section[pos] = (uint8_t)(0x100 - sum);
+    synth_checksum(block);
+}
+
+static void synth_extension_block(unsigned char *block, uint32_t *state)
+{
+    uint32_t kind = synth_next(state) % 8;
+
+    if (kind < 5)
+    {
+        synth_cta_block(block, state);
+    }
+    else if (kind < 7)
+    {
+        synth_displayid_block(block, state);
+    }
+    else
+    {
+        // A block no decoder knows
+        for (int i = 0; i < EDID_LENGTH; i++)
+        {
+            block[i] = (uint8_t)synth_next(state);
+        }
+        block[0] = 0x40;
+        synth_checksum(block);
+    }
+
+    if (synth_next(state) % 32 == 0)
+    {
+        block[EDID_LENGTH - 1] ^= 0x5A;
+    }
+}
+
+/**
+ * Generates a reproducible corpus of synthetic EDIDs. Every EDID has 0 to 4
+ * extension blocks (CTA-861, DisplayID 1.x/2.x or unknown), inputs alternate
+ * between digital and analog, and entry i carries i as its established timing
+ * bits. About one EDID in 16 has a broken header, one in 8 a bad base block
+ * checksum and one extension block in 32 a bad checksum.
+ *
+ * @param count Number of EDIDs
+ * @param seed Seed; the same count and seed always give the same bytes
+ * @param corpus Structure to fill; release it with edid_corpus_free()
+ * @return 1 on success, 0 on allocation failure
+ */
+int edid_corpus_synthesize(size_t count, uint32_t seed, struct edid_corpus *corpus)
+{
+    uint32_t state = seed * 2654435761u ^ 0x9E3779B9u;
+    size_t offset = 0;
+
+    memset(corpus, 0, sizeof(*corpus));
+    if (state == 0)
+    {
+        state = 1;
+    }
+
+    corpus->data = malloc(count * (1 + SYNTH_MAX_EXTENSIONS) * EDID_LENGTH);
+    corpus->offsets = malloc(count * sizeof(*corpus->offsets));
+    corpus->block_counts = malloc(count * sizeof(*corpus->block_counts));
+    if (!corpus->data || !corpus->offsets || !corpus->block_counts)
+    {
+        edid_corpus_free(corpus);
+        return 0;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        unsigned char *block = corpus->data + offset;
+        unsigned int extensions = (unsigned int)(i % (SYNTH_MAX_EXTENSIONS + 1));
+
+        synth_base_block(block, (uint32_t)i, extensions, &state);
+        for (unsigned int e = 1; e <= extensions; e++)
+        {
+            synth_extension_block(block + e * EDID_LENGTH, &state);
+        }
+
+        if (synth_next(&state) % 8 == 0)
+        {
+            block[127] ^= (uint8_t)synth_range(&state, 1, 255);
+        }
+        if (synth_next(&state) % 16 == 0)
+        {
+            block[synth_range(&state, 0, 7)] ^= (uint8_t)synth_range(&state, 1, 255);
+        }
+
+        corpus->offsets[i] = offset;
+        corpus->block_counts[i] = (uint16_t)(1 + extensions);
+        corpus->blocks += 1 + extensions;
+        offset += (1 + extensions) * EDID_LENGTH;
+    }
+    corpus->count = count;
+    return 1;
+}
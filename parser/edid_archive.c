@@ -0,0 +1,145 @@
+#include <string.h>
+#include <stdint.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include "parser.h"
+#include "edid_archive.h"
+/**
+ * Zero-copy reader for binary archives of concatenated EDIDs
+ */
+
+/**
+ * Maps an archive file read-only. The blocks are handed out straight from the
+ * mapping, so nothing is copied.
+ *
+ * @param path Archive file
+ * @param archive Structure to fill; release it with edid_archive_close()
+ * @return 1 on success, 0 if the file cannot be opened or mapped
+ */
+int edid_archive_open(const char *path, struct edid_archive *archive)
+{
+    memset(archive, 0, sizeof(*archive));
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    LARGE_INTEGER size;
+
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return 0;
+    }
+    if (!GetFileSizeEx(file, &size))
+    {
+        CloseHandle(file);
+        return 0;
+    }
+    if (size.QuadPart == 0)
+    {
+        CloseHandle(file);
+        return 1;
+    }
+
+    // The view keeps the mapping alive once both handles are closed
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (!mapping)
+    {
+        return 0;
+    }
+    archive->data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!archive->data)
+    {
+        return 0;
+    }
+    archive->size = (size_t)size.QuadPart;
+#else
+    int fd = open(path, O_RDONLY);
+    struct stat st;
+
+    if (fd < 0)
+    {
+        return 0;
+    }
+    if (fstat(fd, &st) != 0)
+    {
+        close(fd);
+        return 0;
+    }
+    if (st.st_size == 0)
+    {
+        close(fd);
+        return 1;
+    }
+
+    void *data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+        return 0;
+    }
+#ifdef MADV_SEQUENTIAL
+    madvise(data, (size_t)st.st_size, MADV_SEQUENTIAL);
+#endif
+    archive->data = data;
+    archive->size = (size_t)st.st_size;
+#endif
+
+    return 1;
+}
+
+void edid_archive_close(struct edid_archive *archive)
+{
+    if (archive->data)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(archive->data);
+#else
+        munmap((void *)archive->data, archive->size);
+#endif
+    }
+    memset(archive, 0, sizeof(*archive));
+}
+
+void edid_archive_iter_init(struct edid_archive_iter *iter, const struct edid_archive *archive)
+{
+    iter->archive = archive;
+    iter->offset = 0;
+}
+
+/**
+ * Returns the next EDID in the archive. Its length is 1 + byte 126 blocks,
+ * cut short if the archive ends first; a trailing partial block is ignored.
+ *
+ * @param iter Iterator from edid_archive_iter_init()
+ * @param length Set to the number of bytes in the EDID, a multiple of 128
+ * @return Pointer to the base block inside the mapping, or NULL at the end
+ */
+const unsigned char *edid_archive_next(struct edid_archive_iter *iter, size_t *length)
+{
+    const struct edid_archive *archive = iter->archive;
+    size_t remaining = archive->size - iter->offset;
+
+    if (remaining < EDID_LENGTH)
+    {
+        return NULL;
+    }
+
+    const unsigned char *block = archive->data + iter->offset;
+    size_t bytes = (1 + (size_t)block[126]) * EDID_LENGTH;
+
+    if (bytes > remaining)
+    {
+        bytes = remaining - remaining % EDID_LENGTH;
+    }
+    iter->offset += bytes;
+    *length = bytes;
+    return block;
+}
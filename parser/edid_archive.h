@@ -0,0 +1,30 @@
+#ifndef EDID_ARCHIVE_H
+#define EDID_ARCHIVE_H
+
+#include <stddef.h>
+
+/**
+ * A binary archive of concatenated EDIDs mapped read-only into memory.
+ * Every EDID starts on a 128-byte boundary of the file.
+ */
+struct edid_archive
+{
+    const unsigned char *data;
+    size_t size;
+};
+
+/**
+ * Position of a walk over an archive.
+ */
+struct edid_archive_iter
+{
+    const struct edid_archive *archive;
+    size_t offset;
+};
+
+int edid_archive_open(const char *path, struct edid_archive *archive);
+void edid_archive_close(struct edid_archive *archive);
+void edid_archive_iter_init(struct edid_archive_iter *iter, const struct edid_archive *archive);
+const unsigned char *edid_archive_next(struct edid_archive_iter *iter, size_t *length);
+
+#endif
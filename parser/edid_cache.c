@@ -0,0 +1,312 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "parser.h"
+#include "edid_cache.h"
+/**
+ * LRU cache of decoded EDIDs for sinks that reconnect with identical bytes
+ */
+
+#define CACHE_MIN_BUCKETS 64
+#define CACHE_BYTES_PER_BUCKET 4096   // roughly one entry with its text
+
+static uint64_t load64(const unsigned char *p)
+{
+    uint64_t value;
+
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static uint64_t mix64(uint64_t h)
+{
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+/**
+ * Fast non-cryptographic 64-bit hash. Reads eight bytes per step, so a
+ * 128-byte block costs 16 multiplies; the result depends on the host byte
+ * order and must not be stored.
+ *
+ * @param data Bytes to hash
+ * @param length Number of bytes
+ * @return 64-bit hash of data and length
+ */
+uint64_t edid_hash64(const unsigned char *data, size_t length)
+{
+    uint64_t h = 0x9E3779B97F4A7C15ull ^ (length * 0xC2B2AE3D27D4EB4Full);
+    size_t i = 0;
+
+    for (; i + 8 <= length; i += 8)
+    {
+        h = (h ^ mix64(load64(data + i))) * 0x9E3779B97F4A7C15ull;
+        h ^= h >> 29;
+    }
+    if (i < length)
+    {
+        unsigned char tail[8] = {0};
+
+        memcpy(tail, data + i, length - i);
+        h = (h ^ mix64(load64(tail))) * 0x9E3779B97F4A7C15ull;
+    }
+    return mix64(h);
+}
+
+/**
+ * Prepares an empty cache.
+ *
+ * @param cache Cache to initialise; release it with edid_cache_free()
+ * @param memory_cap Bytes the entries may use, copies and rendered text included,
+ *                   or 0 for EDID_CACHE_DEFAULT_MEMORY
+ * @return 1 on success, 0 on allocation failure
+ */
+int edid_cache_init(struct edid_cache *cache, size_t memory_cap)
+{
+    size_t buckets = CACHE_MIN_BUCKETS;
+
+    memset(cache, 0, sizeof(*cache));
+    cache->memory_cap = memory_cap ? memory_cap : EDID_CACHE_DEFAULT_MEMORY;
+    while (buckets < cache->memory_cap / CACHE_BYTES_PER_BUCKET)
+    {
+        buckets *= 2;
+    }
+
+    cache->buckets = calloc(buckets, sizeof(*cache->buckets));
+    if (!cache->buckets)
+    {
+        return 0;
+    }
+    cache->bucket_mask = buckets - 1;
+    return 1;
+}
+
+static void free_entry(struct edid_cache_entry *entry)
+{
+    free(entry->text);
+    free(entry);
+}
+
+/**
+ * Drops every entry but keeps the counters.
+ */
+void edid_cache_clear(struct edid_cache *cache)
+{
+    struct edid_cache_entry *entry = cache->newest;
+
+    while (entry)
+    {
+        struct edid_cache_entry *older = entry->older;
+        free_entry(entry);
+        entry = older;
+    }
+    memset(cache->buckets, 0, (cache->bucket_mask + 1) * sizeof(*cache->buckets));
+    cache->newest = NULL;
+    cache->oldest = NULL;
+    cache->memory_used = 0;
+    cache->entries = 0;
+}
+
+void edid_cache_free(struct edid_cache *cache)
+{
+    if (cache->buckets)
+    {
+        edid_cache_clear(cache);
+        free(cache->buckets);
+    }
+    memset(cache, 0, sizeof(*cache));
+}
+
+static void unlink_lru(struct edid_cache *cache, struct edid_cache_entry *entry)
+{
+    if (entry->newer)
+    {
+        entry->newer->older = entry->older;
+    }
+    else
+    {
+        cache->newest = entry->older;
+    }
+    if (entry->older)
+    {
+        entry->older->newer = entry->newer;
+    }
+    else
+    {
+        cache->oldest = entry->newer;
+    }
+}
+
+static void push_newest(struct edid_cache *cache, struct edid_cache_entry *entry)
+{
+    entry->newer = NULL;
+    entry->older = cache->newest;
+    if (cache->newest)
+    {
+        cache->newest->newer = entry;
+    }
+    else
+    {
+        cache->oldest = entry;
+    }
+    cache->newest = entry;
+}
+
+static void evict(struct edid_cache *cache, struct edid_cache_entry *entry)
+{
+    struct edid_cache_entry **link = &cache->buckets[entry->hash & cache->bucket_mask];
+
+    while (*link != entry)
+    {
+        link = &(*link)->chain;
+    }
+    *link = entry->chain;
+    unlink_lru(cache, entry);
+
+    cache->memory_used -= entry->memory;
+    cache->entries--;
+    cache->evictions++;
+    free_entry(entry);
+}
+
+/**
+ * Evicts least recently used entries until the cache fits its cap again.
+ * keep is never evicted, so an entry larger than the whole cap lives until
+ * the next call.
+ */
+static void enforce_cap(struct edid_cache *cache, const struct edid_cache_entry *keep)
+{
+    while (cache->memory_used > cache->memory_cap && cache->oldest && cache->oldest != keep)
+    {
+        evict(cache, cache->oldest);
+    }
+}
+
+static struct edid_cache_entry *lookup(struct edid_cache *cache, const unsigned char *data, size_t length)
+{
+    uint64_t hash = edid_hash64(data, length);
+    struct edid_cache_entry **bucket = &cache->buckets[hash & cache->bucket_mask];
+    struct edid_cache_entry *entry;
+
+    for (entry = *bucket; entry; entry = entry->chain)
+    {
+        // The hash only narrows the search; a hit needs identical bytes
+        if (entry->hash == hash && entry->length == length && memcmp(entry->data, data, length) == 0)
+        {
+            cache->hits++;
+            if (cache->newest != entry)
+            {
+                unlink_lru(cache, entry);
+                push_newest(cache, entry);
+            }
+            return entry;
+        }
+    }
+
+    cache->misses++;
+    entry = malloc(sizeof(*entry) + length);
+    if (!entry)
+    {
+        return NULL;
+    }
+    entry->hash = hash;
+    entry->data = (unsigned char *)(entry + 1);
+    entry->length = length;
+    memcpy(entry->data, data, length);
+    entry->text = NULL;
+    entry->text_length = 0;
+    entry->text_format = -1;
+    entry->memory = sizeof(*entry) + length;
+
+    parse_edid_struct(data, &entry->info);
+    if (entry->info.header_valid)
+    {
+        parse_edid_extensions(data, length, &entry->ext);
+    }
+    else
+    {
+        memset(&entry->ext, 0, sizeof(entry->ext));
+    }
+
+    entry->chain = *bucket;
+    *bucket = entry;
+    push_newest(cache, entry);
+    cache->entries++;
+    cache->memory_used += entry->memory;
+    enforce_cap(cache, entry);
+    return entry;
+}
+
+/**
+ * Returns the decoded structures for an EDID, decoding it only if the same
+ * bytes are not already cached.
+ *
+ * @param cache Cache from edid_cache_init()
+ * @param data Pointer to the base block followed by its extension blocks
+ * @param length Number of bytes in data, at least 128
+ * @return Cached entry, valid until the next call on the cache, or NULL on allocation failure
+ */
+const struct edid_cache_entry *edid_cache_decode(struct edid_cache *cache, const unsigned char *data, size_t length)
+{
+    return lookup(cache, data, length);
+}
+
+/**
+ * Cached equivalent of parse_edid_blocks_as(). On a hit the rendered output is
+ * copied out; if it was last rendered in another format it is rendered again
+ * from the cached structures without decoding.
+ *
+ * @param cache Cache from edid_cache_init()
+ * @param data Pointer to the base block followed by its extension blocks
+ * @param length Number of bytes in data, at least 128
+ * @param format EDID_FORMAT_TEXT, EDID_FORMAT_JSON or EDID_FORMAT_CSV
+ * @param output Buffer receiving the output, or NULL to only measure it
+ * @param capacity Size of output in bytes
+ * @return Length of the full output excluding the NUL
+ */
+size_t edid_cache_parse(struct edid_cache *cache, const unsigned char *data, size_t length, int format, char *output,
+                        size_t capacity)
+{
+    struct edid_cache_entry *entry = lookup(cache, data, length);
+    struct edid_sink sink;
+
+    if (!entry)
+    {
+        return parse_edid_blocks_as(data, length, format, output, capacity);
+    }
+
+    if (entry->text_format != format)
+    {
+        const struct edid_ext_info *ext = entry->info.header_valid ? &entry->ext : NULL;
+
+        edid_sink_init(&sink, NULL, 0);
+        format_edid_as(&entry->info, ext, format, &sink);
+
+        char *text = malloc(sink.length + 1);
+        if (!text)
+        {
+            edid_sink_init(&sink, output, capacity);
+            format_edid_as(&entry->info, ext, format, &sink);
+            return sink.length;
+        }
+        free(entry->text);
+        entry->text = text;
+        entry->text_length = sink.length;
+        entry->text_format = format;
+        cache->memory_used -= entry->memory;
+        entry->memory = sizeof(*entry) + entry->length + entry->text_length + 1;
+        cache->memory_used += entry->memory;
+
+        edid_sink_init(&sink, entry->text, entry->text_length + 1);
+        format_edid_as(&entry->info, ext, format, &sink);
+        enforce_cap(cache, entry);
+    }
+
+    edid_sink_init(&sink, output, capacity);
+    edid_sink_write(&sink, entry->text, entry->text_length);
+    return sink.length;
+}
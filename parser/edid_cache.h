@@ -0,0 +1,58 @@
+#ifndef EDID_CACHE_H
+#define EDID_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "parser.h"
+
+#define EDID_CACHE_DEFAULT_MEMORY (4u << 20)
+
+/**
+ * One cached EDID: a copy of its raw blocks, the decoded structures and the
+ * last output rendered from them.
+ */
+struct edid_cache_entry
+{
+    uint64_t hash;
+    struct edid_cache_entry *chain;     // next entry in the same hash bucket
+    struct edid_cache_entry *newer;     // LRU list, most recently used at the head
+    struct edid_cache_entry *older;
+    unsigned char *data;
+    size_t length;
+    struct edid_info info;
+    struct edid_ext_info ext;
+    char *text;                         // NUL terminated, NULL until first rendered
+    size_t text_length;
+    int text_format;                    // EDID_FORMAT_* of text
+    size_t memory;                      // bytes charged against the cap
+};
+
+/**
+ * Bounded LRU cache of decoded EDIDs keyed by a 64-bit hash of the raw
+ * blocks. A hash match is only a hit once the stored bytes compare equal.
+ * Not thread safe; callers sharing a cache must serialise access.
+ */
+struct edid_cache
+{
+    struct edid_cache_entry **buckets;
+    size_t bucket_mask;
+    struct edid_cache_entry *newest;
+    struct edid_cache_entry *oldest;
+    size_t memory_cap;
+    size_t memory_used;
+    size_t entries;
+
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+};
+
+uint64_t edid_hash64(const unsigned char *data, size_t length);
+int edid_cache_init(struct edid_cache *cache, size_t memory_cap);
+void edid_cache_free(struct edid_cache *cache);
+void edid_cache_clear(struct edid_cache *cache);
+const struct edid_cache_entry *edid_cache_decode(struct edid_cache *cache, const unsigned char *data, size_t length);
+size_t edid_cache_parse(struct edid_cache *cache, const unsigned char *data, size_t length, int format, char *output,
+                        size_t capacity);
+
+#endif
@@ -0,0 +1,559 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+#include "parser.h"
+#include "edid_corpus.h"
+#include "edid_archive.h"
+#include "edid_instrument.h"
+/**
+ * Multi-threaded parsing of a whole EDID corpus with work stealing
+ */
+
+#define CORPUS_WINDOW 16384     // EDIDs parsed before their text is written out
+#define CORPUS_TASK 16          // EDIDs per stealable task
+#define CORPUS_MAX_THREADS 64
+#define CORPUS_TEXT_START 65536
+
+static int add_entry(struct edid_corpus *corpus, size_t *entry_capacity, size_t offset, size_t blocks)
+{
+    if (corpus->count == *entry_capacity)
+    {
+        size_t capacity = *entry_capacity ? *entry_capacity * 2 : 1024;
+        size_t *offsets = realloc(corpus->offsets, capacity * sizeof(*offsets));
+        if (!offsets)
+        {
+            return 0;
+        }
+        corpus->offsets = offsets;
+
+        uint16_t *block_counts = realloc(corpus->block_counts, capacity * sizeof(*block_counts));
+        if (!block_counts)
+        {
+            return 0;
+        }
+        corpus->block_counts = block_counts;
+        *entry_capacity = capacity;
+    }
+
+    corpus->offsets[corpus->count] = offset;
+    corpus->block_counts[corpus->count] = (uint16_t)blocks;
+    corpus->count++;
+    corpus->blocks += blocks;
+    return 1;
+}
+
+/**
+ * Splits concatenated binary EDIDs the same way an archive walk does.
+ */
+static int index_binary(struct edid_corpus *corpus, size_t size)
+{
+    struct edid_archive view = {corpus->data, size};
+    struct edid_archive_iter iter;
+    size_t entry_capacity = 0;
+    const unsigned char *edid;
+    size_t length;
+
+    edid_archive_iter_init(&iter, &view);
+    while ((edid = edid_archive_next(&iter, &length)) != NULL)
+    {
+        if (!add_entry(corpus, &entry_capacity, (size_t)(edid - corpus->data), length / EDID_LENGTH))
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * Decodes hex text with one EDID per line into corpus->data. Each EDID is
+ * zero padded to whole blocks, like parse_edid_string() does, and lines
+ * without any hex are skipped.
+ */
+static int index_hex(struct edid_corpus *corpus, const char *text, size_t size)
+{
+    size_t entry_capacity = 0;
+    size_t data_capacity = 0;
+    size_t offset = 0;
+    size_t line = 0;
+
+    while (line < size)
+    {
+        const char *start = text + line;
+        const char *end = memchr(start, '\n', size - line);
+        size_t line_length = end ? (size_t)(end - start) : size - line;
+        size_t most = line_length / 2 + EDID_LENGTH;
+
+        line += line_length + 1;
+        if (offset + most > data_capacity)
+        {
+            size_t capacity = data_capacity ? data_capacity * 2 : 1 << 20;
+            while (capacity < offset + most)
+            {
+                capacity *= 2;
+            }
+
+            unsigned char *data = realloc(corpus->data, capacity);
+            if (!data)
+            {
+                return 0;
+            }
+            corpus->data = data;
+            data_capacity = capacity;
+        }
+
+        size_t length;
+        EDID_PROBE(EDID_PROBE_HEX,
+                   length = edid_hex_decode(start, line_length, corpus->data + offset, (size_t)EDID_LENGTH * 256, NULL));
+        if (length == 0)
+        {
+            continue;
+        }
+
+        size_t blocks = (length + EDID_LENGTH - 1) / EDID_LENGTH;
+        memset(corpus->data + offset + length, 0, blocks * EDID_LENGTH - length);
+        if (!add_entry(corpus, &entry_capacity, offset, blocks))
+        {
+            return 0;
+        }
+        offset += blocks * EDID_LENGTH;
+    }
+    return 1;
+}
+
+/**
+ * Loads a corpus file: either concatenated binary EDIDs, recognised by the
+ * EDID header at the start of the file, or hex text with one EDID per line.
+ *
+ * @param path File to read
+ * @param corpus Structure to fill; release it with edid_corpus_free()
+ * @return 1 on success, 0 if the file could not be read
+ */
+int edid_corpus_load(const char *path, struct edid_corpus *corpus)
+{
+    FILE *file = fopen(path, "rb");
+    long size;
+
+    memset(corpus, 0, sizeof(*corpus));
+    if (!file)
+    {
+        return 0;
+    }
+    if (fseek(file, 0, SEEK_END) != 0 || (size = ftell(file)) < 0 || fseek(file, 0, SEEK_SET) != 0)
+    {
+        fclose(file);
+        return 0;
+    }
+
+    unsigned char *contents = malloc(size ? (size_t)size : 1);
+    if (!contents || fread(contents, 1, (size_t)size, file) != (size_t)size)
+    {
+        fclose(file);
+        free(contents);
+        return 0;
+    }
+    fclose(file);
+
+    int ok;
+    if (size >= EDID_LENGTH && edid_header_valid(contents))
+    {
+        corpus->data = contents;
+        ok = index_binary(corpus, (size_t)size);
+    }
+    else
+    {
+        ok = index_hex(corpus, (const char *)contents, (size_t)size);
+        free(contents);
+    }
+    if (!ok)
+    {
+        edid_corpus_free(corpus);
+    }
+    return ok;
+}
+
+void edid_corpus_free(struct edid_corpus *corpus)
+{
+    free(corpus->data);
+    free(corpus->offsets);
+    free(corpus->block_counts);
+    memset(corpus, 0, sizeof(*corpus));
+}
+
+/**
+ * Returns the number of online processors, or 4 if it cannot be determined.
+ */
+unsigned int edid_corpus_default_threads(void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO info;
+
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors ? (unsigned int)info.dwNumberOfProcessors : 4;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return count > 0 ? (unsigned int)count : 4;
+#endif
+}
+
+/**
+ * Work-stealing deque of task indices. Every task is queued before the
+ * workers start, so the owner only ever pops from the bottom and thieves take
+ * from the top (Chase-Lev without the push side).
+ */
+struct task_deque
+{
+    _Atomic int64_t top;
+    _Atomic int64_t bottom;
+    char pad[64 - 2 * sizeof(int64_t)]; // keep each deque on its own cache line
+};
+
+#define TASK_EMPTY (-1)
+#define TASK_RETRY (-2)
+
+static int64_t deque_pop(struct task_deque *deque)
+{
+    int64_t b = atomic_load(&deque->bottom) - 1;
+    atomic_store(&deque->bottom, b);
+    int64_t t = atomic_load(&deque->top);
+
+    if (t > b)
+    {
+        atomic_store(&deque->bottom, b + 1);
+        return TASK_EMPTY;
+    }
+    if (t == b)
+    {
+        // Last task: race any thief for it
+        int won = atomic_compare_exchange_strong(&deque->top, &t, t + 1);
+        atomic_store(&deque->bottom, b + 1);
+        return won ? b : TASK_EMPTY;
+    }
+    return b;
+}
+
+static int64_t deque_steal(struct task_deque *deque)
+{
+    int64_t t = atomic_load(&deque->top);
+    int64_t b = atomic_load(&deque->bottom);
+
+    if (t >= b)
+    {
+        return TASK_EMPTY;
+    }
+    return atomic_compare_exchange_strong(&deque->top, &t, t + 1) ? t : TASK_RETRY;
+}
+
+/**
+ * Where one EDID's text ended up: a slice of a worker's text buffer.
+ */
+struct corpus_result
+{
+    uint32_t worker;
+    size_t offset;
+    size_t length;
+};
+
+struct corpus_worker
+{
+    struct task_deque deque;
+    struct corpus_job *job;
+    unsigned int index;
+    pthread_t thread;
+    char *text;
+    size_t text_capacity;
+    size_t text_used;
+    int failed;
+};
+
+struct corpus_job
+{
+    const struct edid_corpus *corpus;
+    size_t first;               // first EDID of the current window
+    size_t count;               // EDIDs in the current window
+    int keep_text;              // 0 when the text is only measured
+    int format;                 // EDID_FORMAT_*
+    struct corpus_result *results;
+    struct corpus_worker *workers;
+    unsigned int worker_count;
+
+    // Pool threads wait for a new generation, one per window
+    pthread_mutex_t lock;
+    pthread_cond_t window_ready;
+    pthread_cond_t window_done;
+    unsigned long generation;
+    unsigned int helpers;       // threads started besides the caller
+    unsigned int busy;          // helpers still working on the current window
+    int stopping;
+};
+
+static void parse_entry(struct corpus_job *job, struct corpus_worker *worker, size_t entry)
+{
+    const struct edid_corpus *corpus = job->corpus;
+    const unsigned char *data = corpus->data + corpus->offsets[job->first + entry];
+    size_t length = (size_t)corpus->block_counts[job->first + entry] * EDID_LENGTH;
+    struct corpus_result *result = &job->results[entry];
+
+    result->worker = worker->index;
+    result->offset = worker->text_used;
+    result->length = 0;
+
+    if (!job->keep_text)
+    {
+        result->length = parse_edid_blocks_as(data, length, job->format, NULL, 0);
+        return;
+    }
+
+    size_t room = worker->text_capacity - worker->text_used;
+    size_t needed = parse_edid_blocks_as(data, length, job->format, worker->text + worker->text_used, room);
+
+    if (needed >= room)
+    {
+        size_t capacity = worker->text_capacity * 2;
+        while (capacity - worker->text_used <= needed)
+        {
+            capacity *= 2;
+        }
+
+        char *text = realloc(worker->text, capacity);
+        if (!text)
+        {
+            worker->failed = 1;
+            return;
+        }
+        worker->text = text;
+        worker->text_capacity = capacity;
+        parse_edid_blocks_as(data, length, job->format, worker->text + worker->text_used, capacity - worker->text_used);
+    }
+
+    result->length = needed;
+    worker->text_used += needed;
+}
+
+static void run_task(struct corpus_job *job, struct corpus_worker *worker, int64_t task)
+{
+    size_t first = (size_t)task * CORPUS_TASK;
+    size_t last = first + CORPUS_TASK < job->count ? first + CORPUS_TASK : job->count;
+
+    for (size_t entry = first; entry < last; entry++)
+    {
+        parse_entry(job, worker, entry);
+    }
+}
+
+/**
+ * Runs tasks of the current window until every deque is empty.
+ */
+static void run_window(struct corpus_worker *worker)
+{
+    struct corpus_job *job = worker->job;
+    int64_t task;
+
+    for (;;)
+    {
+        while ((task = deque_pop(&worker->deque)) >= 0)
+        {
+            run_task(job, worker, task);
+        }
+
+        // Own deque is empty: steal from the others until they are all empty
+        int retry = 0;
+        task = TASK_EMPTY;
+        for (unsigned int i = 1; i < job->worker_count && task < 0; i++)
+        {
+            task = deque_steal(&job->workers[(worker->index + i) % job->worker_count].deque);
+            retry |= task == TASK_RETRY;
+        }
+        if (task >= 0)
+        {
+            run_task(job, worker, task);
+        }
+        else if (!retry)
+        {
+            return;
+        }
+    }
+}
+
+/**
+ * Pool thread: works on each window as parse_window() publishes it, until
+ * the corpus is done.
+ */
+static void *corpus_worker_main(void *arg)
+{
+    struct corpus_worker *worker = arg;
+    struct corpus_job *job = worker->job;
+    unsigned long seen = 0;
+
+    pthread_mutex_lock(&job->lock);
+    for (;;)
+    {
+        while (job->generation == seen && !job->stopping)
+        {
+            pthread_cond_wait(&job->window_ready, &job->lock);
+        }
+        if (job->stopping)
+        {
+            break;
+        }
+        seen = job->generation;
+        pthread_mutex_unlock(&job->lock);
+
+        run_window(worker);
+
+        pthread_mutex_lock(&job->lock);
+        if (--job->busy == 0)
+        {
+            pthread_cond_signal(&job->window_done);
+        }
+    }
+    pthread_mutex_unlock(&job->lock);
+    return NULL;
+}
+
+/**
+ * Parses one window of the corpus. Tasks are dealt out in contiguous runs so
+ * each worker starts on its own part of the input.
+ */
+static int parse_window(struct corpus_job *job)
+{
+    int64_t tasks = (int64_t)((job->count + CORPUS_TASK - 1) / CORPUS_TASK);
+    int ok = 1;
+
+    for (unsigned int i = 0; i < job->worker_count; i++)
+    {
+        struct corpus_worker *worker = &job->workers[i];
+
+        atomic_store(&worker->deque.top, tasks * i / job->worker_count);
+        atomic_store(&worker->deque.bottom, tasks * (i + 1) / job->worker_count);
+        worker->text_used = 0;
+    }
+
+    // Wake the pool; worker 0 runs on the calling thread
+    pthread_mutex_lock(&job->lock);
+    job->busy = job->helpers;
+    job->generation++;
+    pthread_cond_broadcast(&job->window_ready);
+    pthread_mutex_unlock(&job->lock);
+
+    run_window(&job->workers[0]);
+
+    pthread_mutex_lock(&job->lock);
+    while (job->busy > 0)
+    {
+        pthread_cond_wait(&job->window_done, &job->lock);
+    }
+    pthread_mutex_unlock(&job->lock);
+
+    // A worker that failed to start left its tasks to be stolen, so only a failed allocation is fatal
+    for (unsigned int i = 0; i < job->worker_count; i++)
+    {
+        ok &= !job->workers[i].failed;
+    }
+    return ok;
+}
+
+/**
+ * Parses every EDID in a corpus on several threads and writes the output to
+ * out in input order, each EDID followed by the separator of its format.
+ *
+ * @param corpus Corpus from edid_corpus_load()
+ * @param threads Number of worker threads, including the calling thread
+ * @param format EDID_FORMAT_TEXT, EDID_FORMAT_JSON or EDID_FORMAT_CSV; CSV rows come without a header line
+ * @param out Destination for the output, or NULL to parse without keeping it
+ * @return 1 on success, 0 on allocation or write failure
+ */
+int edid_corpus_parse(const struct edid_corpus *corpus, unsigned int threads, int format, FILE *out)
+{
+    struct corpus_job job;
+    int ok = 1;
+
+    if (threads == 0)
+    {
+        threads = 1;
+    }
+    if (threads > CORPUS_MAX_THREADS)
+    {
+        threads = CORPUS_MAX_THREADS;
+    }
+
+    memset(&job, 0, sizeof(job));
+    job.corpus = corpus;
+    job.keep_text = out != NULL;
+    job.format = format;
+    job.worker_count = threads;
+    job.results = malloc(CORPUS_WINDOW * sizeof(*job.results));
+    job.workers = calloc(threads, sizeof(*job.workers));
+    if (!job.results || !job.workers)
+    {
+        free(job.results);
+        free(job.workers);
+        return 0;
+    }
+
+    for (unsigned int i = 0; i < threads && ok; i++)
+    {
+        job.workers[i].job = &job;
+        job.workers[i].index = i;
+        if (job.keep_text)
+        {
+            job.workers[i].text_capacity = CORPUS_TEXT_START;
+            job.workers[i].text = malloc(CORPUS_TEXT_START);
+            ok = job.workers[i].text != NULL;
+        }
+    }
+
+    // The pool lives for the whole corpus; a thread that fails to start leaves its tasks to be stolen
+    pthread_mutex_init(&job.lock, NULL);
+    pthread_cond_init(&job.window_ready, NULL);
+    pthread_cond_init(&job.window_done, NULL);
+    for (unsigned int i = 1; i < threads && ok; i++)
+    {
+        if (pthread_create(&job.workers[i].thread, NULL, corpus_worker_main, &job.workers[i]) != 0)
+        {
+            break;
+        }
+        job.helpers++;
+    }
+
+    for (job.first = 0; ok && job.first < corpus->count; job.first += job.count)
+    {
+        job.count = corpus->count - job.first < CORPUS_WINDOW ? corpus->count - job.first : CORPUS_WINDOW;
+        ok = parse_window(&job);
+
+        for (size_t i = 0; ok && out && i < job.count; i++)
+        {
+            const struct corpus_result *result = &job.results[i];
+
+            ok = fwrite(job.workers[result->worker].text + result->offset, 1, result->length, out) == result->length;
+        }
+    }
+
+    pthread_mutex_lock(&job.lock);
+    job.stopping = 1;
+    pthread_cond_broadcast(&job.window_ready);
+    pthread_mutex_unlock(&job.lock);
+    for (unsigned int i = 1; i <= job.helpers; i++)
+    {
+        pthread_join(job.workers[i].thread, NULL);
+    }
+    pthread_cond_destroy(&job.window_done);
+    pthread_cond_destroy(&job.window_ready);
+    pthread_mutex_destroy(&job.lock);
+
+    for (unsigned int i = 0; i < threads; i++)
+    {
+        free(job.workers[i].text);
+    }
+    free(job.workers);
+    free(job.results);
+    return ok;
+}
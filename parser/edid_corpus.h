@@ -0,0 +1,26 @@
+#ifndef EDID_CORPUS_H
+#define EDID_CORPUS_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * A corpus of EDIDs held in memory as whole 128-byte blocks. Entry i starts
+ * at data + offsets[i] and is block_counts[i] blocks long.
+ */
+struct edid_corpus
+{
+    unsigned char *data;
+    size_t count;               // number of EDIDs
+    size_t blocks;              // total blocks across all EDIDs
+    size_t *offsets;
+    uint16_t *block_counts;
+};
+
+int edid_corpus_load(const char *path, struct edid_corpus *corpus);
+void edid_corpus_free(struct edid_corpus *corpus);
+unsigned int edid_corpus_default_threads(void);
+int edid_corpus_parse(const struct edid_corpus *corpus, unsigned int threads, int format, FILE *out);
+
+#endif
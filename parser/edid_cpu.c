@@ -0,0 +1,68 @@
+#include <stdint.h>
+#include <stdatomic.h>
+#include "parser.h"
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+/**
+ * Runtime CPU feature detection for the vectorised decode paths
+ */
+
+static int detect_cpu_features(void)
+{
+    int features = 0;
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse2"))
+    {
+        features |= EDID_CPU_SSE2;
+    }
+    if (__builtin_cpu_supports("avx2"))
+    {
+        features |= EDID_CPU_AVX2;
+    }
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    int regs[4];
+
+    __cpuid(regs, 0);
+    int max_leaf = regs[0];
+
+    __cpuid(regs, 1);
+    if (regs[3] & (1 << 26))
+    {
+        features |= EDID_CPU_SSE2;
+    }
+
+    // AVX2 also needs the OS to save the YMM state (OSXSAVE + XCR0 bits 1 and 2)
+    int osxsave = (regs[2] & (1 << 27)) != 0;
+    if (max_leaf >= 7 && osxsave && (_xgetbv(0) & 0x6) == 0x6)
+    {
+        __cpuidex(regs, 7, 0);
+        if (regs[1] & (1 << 5))
+        {
+            features |= EDID_CPU_AVX2;
+        }
+    }
+#endif
+
+    return features;
+}
+
+/**
+ * Returns the EDID_CPU_* flags supported by the running CPU.
+ * The result is computed once. Concurrent first calls may each detect it,
+ * but they store the same value, so relaxed ordering is enough.
+ */
+int edid_cpu_features(void)
+{
+    static _Atomic int cached = -1;
+    int features = atomic_load_explicit(&cached, memory_order_relaxed);
+
+    if (features < 0)
+    {
+        features = detect_cpu_features();
+        atomic_store_explicit(&cached, features, memory_order_relaxed);
+    }
+    return features;
+}
@@ -0,0 +1,452 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "parser.h"
+/**
+ * CTA-861 extension block decoder
+ */
+
+#define DEBUG_PRINT_ENABLED 0
+#if DEBUG_PRINT_ENABLED
+#define DGB_PRINTF printf
+#else
+#define DGB_PRINTF(...) ((void)0)
+#endif
+
+// Data block tags (bits 7..5 of the block header)
+#define CTA_TAG_AUDIO 1
+#define CTA_TAG_VIDEO 2
+#define CTA_TAG_VENDOR 3
+#define CTA_TAG_SPEAKER 4
+#define CTA_TAG_EXTENDED 7
+
+// Extended tags (first payload byte of tag 7 blocks)
+#define CTA_EXT_COLORIMETRY 5
+#define CTA_EXT_HDR_STATIC 6
+#define CTA_EXT_Y420_VIDEO 14
+#define CTA_EXT_Y420_CAPABILITY_MAP 15
+
+#define OUI_HDMI 0x000C03
+#define OUI_HDMI_FORUM 0xC45DD8
+
+// Commonly advertised VICs, sorted by VIC
+static const struct edid_cta_vic cta_vics[] = {
+    {1, 0, 640, 480, 60},     {2, 0, 720, 480, 60},     {3, 0, 720, 480, 60},     {4, 0, 1280, 720, 60},
+    {5, 1, 1920, 1080, 60},   {6, 1, 1440, 480, 60},    {7, 1, 1440, 480, 60},    {8, 0, 1440, 240, 60},
+    {9, 0, 1440, 240, 60},    {14, 0, 1440, 480, 60},   {15, 0, 1440, 480, 60},   {16, 0, 1920, 1080, 60},
+    {17, 0, 720, 576, 50},    {18, 0, 720, 576, 50},    {19, 0, 1280, 720, 50},   {20, 1, 1920, 1080, 50},
+    {21, 1, 1440, 576, 50},   {22, 1, 1440, 576, 50},   {31, 0, 1920, 1080, 50},  {32, 0, 1920, 1080, 24},
+    {33, 0, 1920, 1080, 25},  {34, 0, 1920, 1080, 30},  {39, 1, 1920, 1080, 50},  {40, 1, 1920, 1080, 100},
+    {41, 0, 1280, 720, 100},  {42, 0, 720, 576, 100},   {43, 0, 720, 576, 100},   {44, 1, 1440, 576, 100},
+    {45, 1, 1440, 576, 100},  {46, 1, 1920, 1080, 120}, {47, 0, 1280, 720, 120},  {48, 0, 720, 480, 120},
+    {49, 0, 720, 480, 120},   {60, 0, 1280, 720, 24},   {61, 0, 1280, 720, 25},   {62, 0, 1280, 720, 30},
+    {63, 0, 1920, 1080, 120}, {64, 0, 1920, 1080, 100}, {93, 0, 3840, 2160, 24},  {94, 0, 3840, 2160, 25},
+    {95, 0, 3840, 2160, 30},  {96, 0, 3840, 2160, 50},  {97, 0, 3840, 2160, 60},  {98, 0, 4096, 2160, 24},
+    {99, 0, 4096, 2160, 25},  {100, 0, 4096, 2160, 30}, {101, 0, 4096, 2160, 50}, {102, 0, 4096, 2160, 60},
+    {103, 0, 3840, 2160, 24}, {104, 0, 3840, 2160, 25}, {105, 0, 3840, 2160, 30}, {106, 0, 3840, 2160, 50},
+    {107, 0, 3840, 2160, 60}, {117, 0, 3840, 2160, 100}, {118, 0, 3840, 2160, 120},
+};
+
+/**
+ * Looks up the video format of a VIC.
+ *
+ * @param vic Video Identification Code
+ * @return Pointer to the format, or NULL if the VIC is not in the table
+ */
+const struct edid_cta_vic *edid_cta_vic_lookup(uint8_t vic)
+{
+    int low = 0;
+    int high = (int)(sizeof(cta_vics) / sizeof(cta_vics[0])) - 1;
+
+    while (low <= high)
+    {
+        int mid = (low + high) / 2;
+
+        if (cta_vics[mid].vic == vic)
+        {
+            return &cta_vics[mid];
+        }
+        if (cta_vics[mid].vic < vic)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid - 1;
+        }
+    }
+    return NULL;
+}
+
+static void decode_video_block(const unsigned char *payload, int len, struct edid_cta_info *cta)
+{
+    for (int i = 0; i < len && cta->vic_count < EDID_CTA_MAX_VICS; i++)
+    {
+        uint8_t svd = payload[i];
+
+        // 129-192 carry the native flag in bit 7; 193 and up are plain 8-bit VICs
+        if (svd >= 129 && svd <= 192)
+        {
+            cta->native_vics |= (uint64_t)1 << cta->vic_count;
+            svd &= 0x7F;
+        }
+        cta->vics[cta->vic_count++] = svd;
+    }
+}
+
+static void decode_audio_block(const unsigned char *payload, int len, struct edid_cta_info *cta)
+{
+    for (int i = 0; i + 3 <= len && cta->audio_count < EDID_CTA_MAX_AUDIO; i += 3)
+    {
+        struct edid_cta_audio *sad = &cta->audio[cta->audio_count++];
+
+        sad->format = (payload[i] >> 3) & 0x0F;
+        sad->channels = (payload[i] & 0x07) + 1;
+        sad->sample_rates = payload[i + 1] & 0x7F;
+        sad->detail = payload[i + 2];
+    }
+}
+
+static void decode_vendor_block(const unsigned char *payload, int len, struct edid_cta_info *cta)
+{
+    if (len < 3)
+    {
+        return;
+    }
+
+    uint32_t oui = payload[0] | (payload[1] << 8) | ((uint32_t)payload[2] << 16);
+
+    if (oui == OUI_HDMI && len >= 5)
+    {
+        cta->has_hdmi = 1;
+        cta->physical_address = (payload[3] << 8) | payload[4];
+        if (len >= 6)
+        {
+            cta->hdmi_flags = payload[5];
+        }
+        if (len >= 7)
+        {
+            cta->hdmi_max_tmds_mhz = payload[6] * 5;
+        }
+    }
+    else if (oui == OUI_HDMI_FORUM && len >= 6)
+    {
+        cta->has_hdmi_forum = 1;
+        cta->hdmi_forum_version = payload[3];
+        cta->hdmi_forum_max_tmds_mhz = payload[4] * 5;
+        cta->hdmi_forum_flags = payload[5];
+        if (len >= 7)
+        {
+            cta->hdmi_forum_max_frl = payload[6] >> 4;
+            cta->hdmi_forum_dc_420 = payload[6] & 0x07;
+        }
+    }
+}
+
+static void decode_extended_block(const unsigned char *payload, int len, struct edid_cta_info *cta)
+{
+    if (len < 1)
+    {
+        return;
+    }
+
+    switch (payload[0])
+    {
+    case CTA_EXT_COLORIMETRY:
+        if (len >= 3)
+        {
+            cta->has_colorimetry = 1;
+            cta->colorimetry = payload[1] | (payload[2] << 8);
+        }
+        break;
+    case CTA_EXT_HDR_STATIC:
+        if (len >= 3)
+        {
+            cta->has_hdr_static = 1;
+            cta->hdr_eotfs = payload[1];
+            cta->hdr_metadata_types = payload[2];
+            cta->hdr_max_luminance = len >= 4 ? payload[3] : 0;
+            cta->hdr_max_frame_avg = len >= 5 ? payload[4] : 0;
+            cta->hdr_min_luminance = len >= 6 ? payload[5] : 0;
+        }
+        break;
+    case CTA_EXT_Y420_VIDEO:
+        for (int i = 1; i < len && cta->y420_vic_count < EDID_CTA_MAX_Y420_VICS; i++)
+        {
+            cta->y420_vics[cta->y420_vic_count++] = payload[i];
+        }
+        break;
+    case CTA_EXT_Y420_CAPABILITY_MAP:
+        cta->has_y420_capability_map = 1;
+        if (len == 1)
+        {
+            // An empty map means every SVD also supports 4:2:0
+            cta->y420_capability_map = ~(uint64_t)0;
+        }
+        for (int i = 1; i < len && i <= 8; i++)
+        {
+            cta->y420_capability_map |= (uint64_t)payload[i] << ((i - 1) * 8);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * Decodes one CTA-861 extension block and merges it into cta. The caller
+ * zeroes cta before the first block.
+ *
+ * @param block Pointer to the 128-byte extension block (tag 0x02)
+ * @param cta Structure receiving the decoded data blocks and timings
+ */
+void parse_cta_block(const unsigned char *block, struct edid_cta_info *cta)
+{
+    uint8_t dtd_offset = block[2];
+
+    cta->present = 1;
+    cta->revision = block[1];
+    cta->flags = block[3];
+
+    // d = 0 means neither data blocks nor DTDs; d = 1 to 3 cannot point past the header
+    if (dtd_offset < 4)
+    {
+        return;
+    }
+
+    // Data block collection sits between byte 4 and the first DTD
+    if (dtd_offset > EDID_LENGTH - 1)
+    {
+        dtd_offset = EDID_LENGTH - 1;
+    }
+
+    int pos = 4;
+    while (pos < dtd_offset)
+    {
+        int tag = block[pos] >> 5;
+        int len = block[pos] & 0x1F;
+        const unsigned char *payload = block + pos + 1;
+
+        if (pos + 1 + len > dtd_offset)
+        {
+            DGB_PRINTF("CTA data block at %d overruns the collection\n", pos);
+            break;
+        }
+
+        switch (tag)
+        {
+        case CTA_TAG_AUDIO:
+            decode_audio_block(payload, len, cta);
+            break;
+        case CTA_TAG_VIDEO:
+            decode_video_block(payload, len, cta);
+            break;
+        case CTA_TAG_VENDOR:
+            decode_vendor_block(payload, len, cta);
+            break;
+        case CTA_TAG_SPEAKER:
+            if (len >= 3)
+            {
+                cta->has_speaker_allocation = 1;
+                memcpy(cta->speaker_allocation, payload, 3);
+            }
+            break;
+        case CTA_TAG_EXTENDED:
+            decode_extended_block(payload, len, cta);
+            break;
+        default:
+            break;
+        }
+        pos += 1 + len;
+    }
+
+    for (int offset = dtd_offset; offset + 18 <= EDID_LENGTH - 1 && cta->detailed_timing_count < EDID_CTA_MAX_TIMINGS; offset += 18)
+    {
+        if (!edid_decode_detailed_timing(block + offset, &cta->detailed_timings[cta->detailed_timing_count]))
+        {
+            break;
+        }
+        cta->detailed_timing_count++;
+    }
+}
+
+static void format_vic(uint8_t vic, int native, struct edid_sink *sink)
+{
+    const struct edid_cta_vic *mode = edid_cta_vic_lookup(vic);
+
+    EDID_SINK_LITERAL(sink, "   - VIC ");
+    edid_sink_putu(sink, vic);
+    if (mode)
+    {
+        EDID_SINK_LITERAL(sink, ": ");
+        edid_sink_putu(sink, mode->width);
+        edid_sink_putc(sink, 'x');
+        edid_sink_putu(sink, mode->height);
+        edid_sink_putc(sink, mode->interlaced ? 'i' : 'p');
+        edid_sink_putu(sink, mode->refresh);
+    }
+    if (native)
+    {
+        EDID_SINK_LITERAL(sink, " (native)");
+    }
+    edid_sink_putc(sink, '\n');
+}
+
+/**
+ * Formats decoded CTA-861 data as text.
+ *
+ * @param cta Decoded CTA data from parse_cta_block()
+ * @param sink Output sink receiving the text
+ */
+void format_cta_info(const struct edid_cta_info *cta, struct edid_sink *sink)
+{
+    static const char *audio_formats[] = {
+        "Reserved", "LPCM", "AC-3", "MPEG-1", "MP3", "MPEG-2", "AAC LC", "DTS", "ATRAC",
+        "One Bit Audio", "Enhanced AC-3", "DTS-HD", "MAT", "DST", "WMA Pro", "Extended"};
+    static const char *sample_rates[] = {"32", "44.1", "48", "88.2", "96", "176.4", "192"};
+
+    EDID_SINK_LITERAL(sink, "CTA-861 Extension (revision ");
+    edid_sink_putu(sink, cta->revision);
+    EDID_SINK_LITERAL(sink, "):\n");
+
+    if (cta->flags & 0x80)
+    {
+        EDID_SINK_LITERAL(sink, " - Underscans IT formats by default\n");
+    }
+    if (cta->flags & 0x40)
+    {
+        EDID_SINK_LITERAL(sink, " - Basic audio support\n");
+    }
+    if (cta->flags & 0x20)
+    {
+        EDID_SINK_LITERAL(sink, " - Supports YCbCr 4:4:4\n");
+    }
+    if (cta->flags & 0x10)
+    {
+        EDID_SINK_LITERAL(sink, " - Supports YCbCr 4:2:2\n");
+    }
+
+    if (cta->vic_count)
+    {
+        EDID_SINK_LITERAL(sink, " - Video Data Block:\n");
+        for (int i = 0; i < cta->vic_count; i++)
+        {
+            format_vic(cta->vics[i], (int)((cta->native_vics >> i) & 1), sink);
+        }
+    }
+
+    if (cta->audio_count)
+    {
+        EDID_SINK_LITERAL(sink, " - Audio Data Block:\n");
+        for (int i = 0; i < cta->audio_count; i++)
+        {
+            const struct edid_cta_audio *sad = &cta->audio[i];
+
+            EDID_SINK_LITERAL(sink, "   - ");
+            edid_sink_puts(sink, audio_formats[sad->format]);
+            EDID_SINK_LITERAL(sink, ", ");
+            edid_sink_putu(sink, sad->channels);
+            EDID_SINK_LITERAL(sink, " channels, kHz:");
+            for (int bit = 0; bit < 7; bit++)
+            {
+                if (sad->sample_rates & (1 << bit))
+                {
+                    edid_sink_putc(sink, ' ');
+                    edid_sink_puts(sink, sample_rates[bit]);
+                }
+            }
+            edid_sink_putc(sink, '\n');
+        }
+    }
+
+    if (cta->has_speaker_allocation)
+    {
+        EDID_SINK_LITERAL(sink, " - Speaker Allocation: 0x");
+        edid_sink_puthex(sink, cta->speaker_allocation[0], 2);
+        edid_sink_putc(sink, '\n');
+    }
+
+    if (cta->has_hdmi)
+    {
+        EDID_SINK_LITERAL(sink, " - HDMI Vendor Specific Data Block: physical address ");
+        edid_sink_putu(sink, (cta->physical_address >> 12) & 0x0F);
+        edid_sink_putc(sink, '.');
+        edid_sink_putu(sink, (cta->physical_address >> 8) & 0x0F);
+        edid_sink_putc(sink, '.');
+        edid_sink_putu(sink, (cta->physical_address >> 4) & 0x0F);
+        edid_sink_putc(sink, '.');
+        edid_sink_putu(sink, cta->physical_address & 0x0F);
+        if (cta->hdmi_max_tmds_mhz)
+        {
+            EDID_SINK_LITERAL(sink, ", max TMDS ");
+            edid_sink_putu(sink, cta->hdmi_max_tmds_mhz);
+            EDID_SINK_LITERAL(sink, " MHz");
+        }
+        edid_sink_putc(sink, '\n');
+    }
+
+    if (cta->has_hdmi_forum)
+    {
+        EDID_SINK_LITERAL(sink, " - HDMI Forum Vendor Specific Data Block: version ");
+        edid_sink_putu(sink, cta->hdmi_forum_version);
+        EDID_SINK_LITERAL(sink, ", max TMDS character rate ");
+        edid_sink_putu(sink, cta->hdmi_forum_max_tmds_mhz);
+        EDID_SINK_LITERAL(sink, " MHz, max FRL rate ");
+        edid_sink_putu(sink, cta->hdmi_forum_max_frl);
+        if (cta->hdmi_forum_flags & 0x80)
+        {
+            EDID_SINK_LITERAL(sink, ", SCDC present");
+        }
+        edid_sink_putc(sink, '\n');
+    }
+
+    if (cta->has_colorimetry)
+    {
+        EDID_SINK_LITERAL(sink, " - Colorimetry Data Block: 0x");
+        edid_sink_puthex(sink, cta->colorimetry, 4);
+        edid_sink_putc(sink, '\n');
+    }
+
+    if (cta->has_hdr_static)
+    {
+        EDID_SINK_LITERAL(sink, " - HDR Static Metadata: EOTFs 0x");
+        edid_sink_puthex(sink, cta->hdr_eotfs, 2);
+        EDID_SINK_LITERAL(sink, ", max luminance code ");
+        edid_sink_putu(sink, cta->hdr_max_luminance);
+        EDID_SINK_LITERAL(sink, ", max frame average code ");
+        edid_sink_putu(sink, cta->hdr_max_frame_avg);
+        EDID_SINK_LITERAL(sink, ", min luminance code ");
+        edid_sink_putu(sink, cta->hdr_min_luminance);
+        edid_sink_putc(sink, '\n');
+    }
+
+    if (cta->y420_vic_count)
+    {
+        EDID_SINK_LITERAL(sink, " - YCbCr 4:2:0 Video Data Block:\n");
+        for (int i = 0; i < cta->y420_vic_count; i++)
+        {
+            format_vic(cta->y420_vics[i], 0, sink);
+        }
+    }
+
+    if (cta->has_y420_capability_map)
+    {
+        EDID_SINK_LITERAL(sink, " - YCbCr 4:2:0 Capability Map:");
+        for (int i = 0; i < cta->vic_count; i++)
+        {
+            if ((cta->y420_capability_map >> i) & 1)
+            {
+                EDID_SINK_LITERAL(sink, " VIC ");
+                edid_sink_putu(sink, cta->vics[i]);
+            }
+        }
+        edid_sink_putc(sink, '\n');
+    }
+
+    for (int i = 0; i < cta->detailed_timing_count; i++)
+    {
+        EDID_SINK_LITERAL(sink, " - Detailed Timing: ");
+        format_timing_summary(&cta->detailed_timings[i], sink);
+        edid_sink_putc(sink, '\n');
+    }
+}
@@ -0,0 +1,415 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "parser.h"
+/**
+ * DisplayID 1.3 / 2.x extension block decoder
+ */
+
+#define DEBUG_PRINT_ENABLED 0
+#if DEBUG_PRINT_ENABLED
+#define DGB_PRINTF printf
+#else
+#define DGB_PRINTF(...) ((void)0)
+#endif
+
+// DisplayID 1.x data block tags
+#define DID_TAG_PRODUCT_ID 0x00
+#define DID_TAG_TYPE_I_TIMING 0x03
+#define DID_TAG_TILED_DISPLAY 0x12
+
+// DisplayID 2.x data block tags
+#define DID2_TAG_PRODUCT_ID 0x20
+#define DID2_TAG_TYPE_VII_TIMING 0x22
+#define DID2_TAG_TYPE_VIII_TIMING 0x23
+#define DID2_TAG_TILED_DISPLAY 0x28
+
+#define DID_SECTION_HEADER 4     // version, payload length, product type, extension count
+#define DID_BLOCK_HEADER 3       // tag, revision, payload length
+#define DID_TIMING_LENGTH 20
+#define DID_TILE_LENGTH 22
+
+static uint16_t read_le16(const unsigned char *data)
+{
+    return (uint16_t)(data[0] | (data[1] << 8));
+}
+
+static uint32_t read_le32(const unsigned char *data)
+{
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+/**
+ * Decodes a product identification block. 1.x and 2.x share the layout; only
+ * the meaning of the three vendor bytes differs. The first block seen wins.
+ */
+static void decode_product_id(const unsigned char *payload, int len, struct edid_displayid_info *displayid)
+{
+    if (len < 12 || displayid->has_product_id)
+    {
+        return;
+    }
+
+    displayid->has_product_id = 1;
+    memcpy(displayid->vendor, payload, 3);
+    displayid->product_code = read_le16(payload + 3);
+    displayid->serial_number = read_le32(payload + 5);
+    displayid->manufacture_week = payload[9];
+    displayid->manufacture_year = payload[10] + 2000;
+
+    int name_length = payload[11];
+    if (name_length > len - 12)
+    {
+        name_length = len - 12;
+    }
+    if (name_length > EDID_DISPLAYID_NAME_LENGTH)
+    {
+        name_length = EDID_DISPLAYID_NAME_LENGTH;
+    }
+    memcpy(displayid->product_name, payload + 12, name_length);
+    displayid->product_name[name_length] = '\0';
+}
+
+/**
+ * Decodes one 20-byte Type I / Type VII timing descriptor. The fields are
+ * stored minus one, and the flags are re-encoded in the DTD byte 17 layout so
+ * the timing formats like a base block one.
+ *
+ * @param desc Pointer to the descriptor
+ * @param clock_khz Pixel clock unit, 10 for Type I and 1 for Type VII
+ * @param timing Structure to fill
+ * @return 1 if the descriptor is flagged as the preferred timing, 0 otherwise
+ */
+static int decode_timing_descriptor(const unsigned char *desc, uint32_t clock_khz, struct edid_detailed_timing *timing)
+{
+    uint32_t clock = (uint32_t)desc[0] | ((uint32_t)desc[1] << 8) | ((uint32_t)desc[2] << 16);
+
+    memset(timing, 0, sizeof(*timing));
+    timing->pixel_clock_khz = (clock + 1) * clock_khz;
+    timing->horizontal_active = read_le16(desc + 4) + 1;
+    timing->horizontal_blanking = read_le16(desc + 6) + 1;
+    timing->horizontal_sync_offset = (read_le16(desc + 8) & 0x7FFF) + 1;
+    timing->horizontal_sync_width = read_le16(desc + 10) + 1;
+    timing->vertical_active = read_le16(desc + 12) + 1;
+    timing->vertical_blanking = read_le16(desc + 14) + 1;
+    timing->vertical_sync_offset = (read_le16(desc + 16) & 0x7FFF) + 1;
+    timing->vertical_sync_width = read_le16(desc + 18) + 1;
+
+    // Digital separate sync with the polarities from bit 15 of the sync offsets
+    timing->flags = 0x18;
+    if (desc[3] & 0x10)
+    {
+        timing->flags |= 0x80;
+    }
+    if (desc[17] & 0x80)
+    {
+        timing->flags |= 0x04;
+    }
+    if (desc[9] & 0x80)
+    {
+        timing->flags |= 0x02;
+    }
+
+    timing->refresh_mhz = edid_timing_refresh_mhz(timing);
+    return (desc[3] & 0x80) != 0;
+}
+
+static void decode_detailed_timings(const unsigned char *payload, int len, int size, uint32_t clock_khz,
+                                    struct edid_displayid_info *displayid)
+{
+    for (int pos = 0; pos + size <= len && displayid->detailed_timing_count < EDID_DISPLAYID_MAX_TIMINGS; pos += size)
+    {
+        uint8_t index = displayid->detailed_timing_count++;
+
+        if (decode_timing_descriptor(payload + pos, clock_khz, &displayid->detailed_timings[index]) &&
+            displayid->preferred_timing == 0xFF)
+        {
+            displayid->preferred_timing = index;
+        }
+    }
+}
+
+/**
+ * Decodes a Type VIII enumerated timing code block. Bits 7..6 of the block
+ * revision give the code type and bit 3 selects 2-byte codes.
+ */
+static void decode_timing_codes(uint8_t revision, const unsigned char *payload, int len, struct edid_displayid_info *displayid)
+{
+    uint8_t type = revision >> 6;
+    int size = (revision & 0x08) ? 2 : 1;
+
+    if (type > EDID_DISPLAYID_CODE_HDMI_VIC)
+    {
+        return;
+    }
+
+    for (int pos = 0; pos + size <= len && displayid->timing_code_count < EDID_DISPLAYID_MAX_CODES; pos += size)
+    {
+        displayid->timing_code_types[displayid->timing_code_count] = type;
+        displayid->timing_codes[displayid->timing_code_count] = size == 2 ? read_le16(payload + pos) : payload[pos];
+        displayid->timing_code_count++;
+    }
+}
+
+static void decode_tiled_display(const unsigned char *payload, int len, struct edid_displayid_info *displayid)
+{
+    struct edid_displayid_tile *tile = &displayid->tile;
+
+    if (len < DID_TILE_LENGTH || displayid->has_tile)
+    {
+        return;
+    }
+
+    displayid->has_tile = 1;
+    tile->capabilities = payload[0];
+    tile->horizontal_tiles = ((payload[1] >> 4) | ((payload[3] >> 2) & 0x30)) + 1;
+    tile->vertical_tiles = ((payload[1] & 0x0F) | (payload[3] & 0x30)) + 1;
+    tile->horizontal_location = ((payload[2] >> 4) | ((payload[3] << 2) & 0x30)) + 1;
+    tile->vertical_location = ((payload[2] & 0x0F) | ((payload[3] << 4) & 0x30)) + 1;
+    tile->tile_width = read_le16(payload + 4) + 1;
+    tile->tile_height = read_le16(payload + 6) + 1;
+    memcpy(tile->vendor, payload + 13, 3);
+    tile->product_code = read_le16(payload + 16);
+    tile->serial_number = read_le32(payload + 18);
+}
+
+/**
+ * Walks the data blocks of one checksum-verified section.
+ */
+static void decode_section(const unsigned char *section, int payload_length, struct edid_displayid_info *displayid)
+{
+    const unsigned char *data = section + DID_SECTION_HEADER;
+    int pos = 0;
+
+    while (pos + DID_BLOCK_HEADER <= payload_length)
+    {
+        uint8_t tag = data[pos];
+        uint8_t revision = data[pos + 1];
+        int len = data[pos + 2];
+        const unsigned char *payload = data + pos + DID_BLOCK_HEADER;
+
+        if (pos + DID_BLOCK_HEADER + len > payload_length)
+        {
+            DGB_PRINTF("DisplayID data block at %d overruns the section\n", pos);
+            break;
+        }
+
+        switch (tag)
+        {
+        case DID_TAG_PRODUCT_ID:
+        case DID2_TAG_PRODUCT_ID:
+            decode_product_id(payload, len, displayid);
+            break;
+        case DID_TAG_TYPE_I_TIMING:
+            decode_detailed_timings(payload, len, DID_TIMING_LENGTH, 10, displayid);
+            break;
+        case DID2_TAG_TYPE_VII_TIMING:
+            // Bits 6..4 of the revision extend each descriptor past 20 bytes
+            decode_detailed_timings(payload, len, DID_TIMING_LENGTH + ((revision >> 4) & 0x07), 1, displayid);
+            break;
+        case DID2_TAG_TYPE_VIII_TIMING:
+            decode_timing_codes(revision, payload, len, displayid);
+            break;
+        case DID_TAG_TILED_DISPLAY:
+        case DID2_TAG_TILED_DISPLAY:
+            decode_tiled_display(payload, len, displayid);
+            break;
+        default:
+            break;
+        }
+        pos += DID_BLOCK_HEADER + len;
+    }
+}
+
+/**
+ * Decodes a DisplayID extension block (tag 0x70) into displayid. Each section
+ * carries its own checksum and is skipped if it does not verify. A sink with
+ * several DisplayID blocks can call this once per block.
+ *
+ * @param block Pointer to the 128-byte extension block
+ * @param displayid Structure to merge the decoded sections into
+ */
+void parse_displayid_block(const unsigned char *block, struct edid_displayid_info *displayid)
+{
+    int offset = 1;
+
+    if (!displayid->present)
+    {
+        displayid->preferred_timing = 0xFF;
+    }
+
+    // Sections follow the tag byte; zero padding after the last one ends the walk
+    while (offset + DID_SECTION_HEADER + 1 <= EDID_LENGTH - 1 && block[offset] != 0)
+    {
+        const unsigned char *section = block + offset;
+        int payload_length = section[1];
+        int section_length = DID_SECTION_HEADER + payload_length + 1;
+        uint8_t sum = 0;
+
+        if (offset + section_length > EDID_LENGTH - 1)
+        {
+            DGB_PRINTF("DisplayID section at %d overruns the block\n", offset);
+            displayid->bad_sections++;
+            break;
+        }
+
+        for (int i = 0; i < section_length; i++)
+        {
+            sum += section[i];
+        }
+        if (sum != 0)
+        {
+            displayid->bad_sections++;
+        }
+        else
+        {
+            if (!displayid->present)
+            {
+                displayid->present = 1;
+                displayid->version = section[0];
+                displayid->product_type = section[2];
+            }
+            decode_section(section, payload_length, displayid);
+        }
+        offset += section_length;
+    }
+}
+
+static void format_vendor(uint8_t version, const uint8_t *vendor, struct edid_sink *sink)
+{
+    if (version >= 0x20)
+    {
+        EDID_SINK_LITERAL(sink, "OUI ");
+        edid_sink_puthex(sink, vendor[0], 2);
+        edid_sink_putc(sink, '-');
+        edid_sink_puthex(sink, vendor[1], 2);
+        edid_sink_putc(sink, '-');
+        edid_sink_puthex(sink, vendor[2], 2);
+    }
+    else
+    {
+        edid_sink_write(sink, (const char *)vendor, 3);
+    }
+}
+
+/**
+ * Formats decoded DisplayID data as text.
+ *
+ * @param displayid Decoded data from parse_displayid_block()
+ * @param sink Output sink receiving the text
+ */
+void format_displayid_info(const struct edid_displayid_info *displayid, struct edid_sink *sink)
+{
+    static const char *const code_names[] = {"DMT ID 0x", "VIC ", "HDMI VIC "};
+
+    EDID_SINK_LITERAL(sink, "DisplayID ");
+    if (displayid->present)
+    {
+        edid_sink_putu(sink, displayid->version >> 4);
+        edid_sink_putc(sink, '.');
+        edid_sink_putu(sink, displayid->version & 0x0F);
+        edid_sink_putc(sink, ' ');
+    }
+    EDID_SINK_LITERAL(sink, "Extension:\n");
+
+    if (displayid->bad_sections)
+    {
+        EDID_SINK_LITERAL(sink, " - Skipped ");
+        edid_sink_putu(sink, displayid->bad_sections);
+        EDID_SINK_LITERAL(sink, " section(s) with an invalid checksum\n");
+    }
+
+    if (displayid->has_product_id)
+    {
+        EDID_SINK_LITERAL(sink, " - Product ID: ");
+        format_vendor(displayid->version, displayid->vendor, sink);
+        EDID_SINK_LITERAL(sink, ", product code ");
+        edid_sink_putu(sink, displayid->product_code);
+        EDID_SINK_LITERAL(sink, ", serial ");
+        edid_sink_putu(sink, displayid->serial_number);
+        edid_sink_putc(sink, '\n');
+
+        if (displayid->manufacture_week == 0xFF)
+        {
+            EDID_SINK_LITERAL(sink, " - Model Year: ");
+        }
+        else
+        {
+            EDID_SINK_LITERAL(sink, " - Manufactured: week ");
+            edid_sink_putu(sink, displayid->manufacture_week);
+            EDID_SINK_LITERAL(sink, " of ");
+        }
+        edid_sink_putu(sink, displayid->manufacture_year);
+        edid_sink_putc(sink, '\n');
+
+        if (displayid->product_name[0])
+        {
+            EDID_SINK_LITERAL(sink, " - Product Name: ");
+            edid_sink_puts(sink, displayid->product_name);
+            edid_sink_putc(sink, '\n');
+        }
+    }
+
+    for (int i = 0; i < displayid->detailed_timing_count; i++)
+    {
+        if (i == displayid->preferred_timing)
+        {
+            EDID_SINK_LITERAL(sink, " - Preferred Timing: ");
+        }
+        else
+        {
+            EDID_SINK_LITERAL(sink, " - Detailed Timing: ");
+        }
+        format_timing_summary(&displayid->detailed_timings[i], sink);
+        edid_sink_putc(sink, '\n');
+    }
+
+    for (int i = 0; i < displayid->timing_code_count; i++)
+    {
+        uint8_t type = displayid->timing_code_types[i];
+
+        EDID_SINK_LITERAL(sink, " - Timing Code: ");
+        edid_sink_puts(sink, code_names[type]);
+        if (type == EDID_DISPLAYID_CODE_DMT)
+        {
+            edid_sink_puthex(sink, displayid->timing_codes[i], 2);
+        }
+        else
+        {
+            edid_sink_putu(sink, displayid->timing_codes[i]);
+        }
+        edid_sink_putc(sink, '\n');
+    }
+
+    if (displayid->has_tile)
+    {
+        const struct edid_displayid_tile *tile = &displayid->tile;
+
+        EDID_SINK_LITERAL(sink, " - Tiled Display: ");
+        edid_sink_putu(sink, tile->horizontal_tiles);
+        edid_sink_putc(sink, 'x');
+        edid_sink_putu(sink, tile->vertical_tiles);
+        EDID_SINK_LITERAL(sink, " tiles of ");
+        edid_sink_putu(sink, tile->tile_width);
+        edid_sink_putc(sink, 'x');
+        edid_sink_putu(sink, tile->tile_height);
+        EDID_SINK_LITERAL(sink, ", this is tile (");
+        edid_sink_putu(sink, tile->horizontal_location);
+        EDID_SINK_LITERAL(sink, ", ");
+        edid_sink_putu(sink, tile->vertical_location);
+        EDID_SINK_LITERAL(sink, ")");
+        if (tile->capabilities & 0x80)
+        {
+            EDID_SINK_LITERAL(sink, ", single enclosure");
+        }
+        edid_sink_putc(sink, '\n');
+
+        EDID_SINK_LITERAL(sink, "   Tile Group: ");
+        format_vendor(displayid->version, tile->vendor, sink);
+        EDID_SINK_LITERAL(sink, ", product code ");
+        edid_sink_putu(sink, tile->product_code);
+        EDID_SINK_LITERAL(sink, ", serial ");
+        edid_sink_putu(sink, tile->serial_number);
+        edid_sink_putc(sink, '\n');
+    }
+}
@@ -0,0 +1,180 @@
+#include <string.h>
+#include <stdint.h>
+#include "parser.h"
+#include "edid_instrument.h"
+/**
+ * Walks the extension blocks that follow the EDID base block
+ */
+
+/**
+ * Returns a pointer to extension block index (1-based) within a buffer of
+ * whole 128-byte blocks, without touching any other block.
+ *
+ * @param data Pointer to the base block followed by its extension blocks
+ * @param length Number of bytes available in data
+ * @param index Extension number, 1 for the block after the base block
+ * @return Pointer to the block, or NULL if it is not announced or not in the buffer
+ */
+const unsigned char *edid_extension_block(const unsigned char *data, size_t length, unsigned int index)
+{
+    if (index == 0 || length < EDID_LENGTH || index > data[126])
+    {
+        return NULL;
+    }
+    if ((size_t)(index + 1) * EDID_LENGTH > length)
+    {
+        return NULL;
+    }
+    return data + (size_t)index * EDID_LENGTH;
+}
+
+static void decode_extension(const unsigned char *block, struct edid_ext_info *ext)
+{
+    if (!verify_edid_checksum(block))
+    {
+        ext->bad_checksums++;
+        return;
+    }
+
+    switch (block[0])
+    {
+    case EDID_EXTENSION_CTA:
+        parse_cta_block(block, &ext->cta);
+        break;
+    case EDID_EXTENSION_DISPLAYID:
+        parse_displayid_block(block, &ext->displayid);
+        break;
+    default:
+        break;
+    }
+    ext->blocks_decoded++;
+}
+
+/**
+ * Prepares a stream for a new EDID.
+ */
+void edid_stream_init(struct edid_stream *stream)
+{
+    memset(stream, 0, sizeof(*stream));
+}
+
+/**
+ * Decodes the next 128-byte block of an EDID. Block 0 is decoded into
+ * stream->base straight away, so callers can act on it while the extension
+ * blocks are still being read.
+ *
+ * @param stream Stream from edid_stream_init()
+ * @param block Pointer to the next 128-byte block
+ * @return EDID_STREAM_MORE while blocks are outstanding, EDID_STREAM_COMPLETE
+ *         once all announced blocks are in, EDID_STREAM_ERROR if block 0 has an invalid header
+ */
+int edid_stream_push(struct edid_stream *stream, const unsigned char *block)
+{
+    if (stream->blocks_received == 0)
+    {
+        if (!parse_edid_struct(block, &stream->base))
+        {
+            return EDID_STREAM_ERROR;
+        }
+        stream->ext.block_count = block[126];
+        stream->blocks_expected = 1 + block[126];
+        stream->blocks_received = 1;
+    }
+    else if (stream->blocks_received < stream->blocks_expected)
+    {
+        decode_extension(block, &stream->ext);
+        stream->blocks_received++;
+    }
+
+    return stream->blocks_received < stream->blocks_expected ? EDID_STREAM_MORE : EDID_STREAM_COMPLETE;
+}
+
+/**
+ * Decodes every extension block present in a buffer, checksum-verifying each.
+ *
+ * @param data Pointer to the base block followed by its extension blocks
+ * @param length Number of bytes available in data
+ * @param ext Structure to fill
+ * @return Number of extension blocks decoded
+ */
+int parse_edid_extensions(const unsigned char *data, size_t length, struct edid_ext_info *ext)
+{
+    const unsigned char *block;
+
+    memset(ext, 0, sizeof(*ext));
+    if (length < EDID_LENGTH)
+    {
+        return 0;
+    }
+
+    ext->block_count = data[126];
+    for (unsigned int i = 1; (block = edid_extension_block(data, length, i)) != NULL; i++)
+    {
+        decode_extension(block, ext);
+    }
+    return ext->blocks_decoded;
+}
+
+/**
+ * Formats the decoded extension blocks as text.
+ *
+ * @param ext Decoded extensions from parse_edid_extensions() or a stream
+ * @param sink Output sink receiving the text
+ */
+void format_edid_extensions(const struct edid_ext_info *ext, struct edid_sink *sink)
+{
+    EDID_SINK_LITERAL(sink, "Extension Blocks: ");
+    edid_sink_putu(sink, ext->block_count);
+    edid_sink_putc(sink, '\n');
+
+    if (ext->bad_checksums)
+    {
+        EDID_SINK_LITERAL(sink, " - Skipped ");
+        edid_sink_putu(sink, ext->bad_checksums);
+        EDID_SINK_LITERAL(sink, " block(s) with an invalid checksum\n");
+    }
+
+    if (ext->cta.present)
+    {
+        format_cta_info(&ext->cta, sink);
+    }
+    if (ext->displayid.present || ext->displayid.bad_sections)
+    {
+        format_displayid_info(&ext->displayid, sink);
+    }
+}
+
+static void format_edid_text(const struct edid_info *info, const struct edid_ext_info *ext, struct edid_sink *sink)
+{
+    format_edid_info(info, sink);
+    if (ext)
+    {
+        EDID_PROBE(EDID_PROBE_FORMAT_EXTENSIONS, format_edid_extensions(ext, sink));
+    }
+}
+
+/**
+ * Parses a base block and the extension blocks that follow it
+ *
+ * @param data Pointer to the base block followed by its extension blocks
+ * @param length Number of bytes available in data, at least 128
+ * @param output Buffer receiving the text, or NULL to only measure it
+ * @param capacity Size of output in bytes
+ * @return Length of the full text excluding the NUL
+ */
+size_t parse_edid_blocks(const unsigned char *data, size_t length, char *output, size_t capacity)
+{
+    struct edid_info info;
+    struct edid_ext_info ext;
+    struct edid_sink sink;
+
+    edid_sink_init(&sink, output, capacity);
+    parse_edid_struct(data, &info);
+    if (info.header_valid)
+    {
+        EDID_PROBE(EDID_PROBE_EXTENSIONS, parse_edid_extensions(data, length, &ext));
+    }
+
+    EDID_PROBE(EDID_PROBE_OUTPUT, format_edid_text(&info, info.header_valid ? &ext : NULL, &sink));
+    return sink.length;
+}
@@ -0,0 +1,109 @@
+#include <stdint.h>
+#include "parser.h"
+/**
+ * Exact fixed-point formatting of the chromaticity and gamma fields, with no
+ * floating point
+ */
+
+/*
+ * Four decimals of value / 1024 for every 10-bit chromaticity value, rounded
+ * half to even. value / 1024 = value * 625 / 64 ten-thousandths, so the
+ * entry for value is value * 625 / 64 rounded, and a tie is a remainder of 32.
+ */
+static const char chromaticity_digits[1024 * 4 + 1] =
+    "0000001000200029003900490059006800780088009801070117012701370146"
+    "0156016601760186019502050215022502340244025402640273028302930303"
+    "0312032203320342035203610371038103910400041004200430043904490459"
+    "0469047904880498050805180527053705470557056605760586059606050615"
+    "0625063506450654066406740684069307030713072307320742075207620771"
+    "0781079108010811082008300840085008590869087908890898090809180928"
+    "0938094709570967097709860996100610161025103510451055106410741084"
+    "1094110411131123113311431152116211721182119112011211122112301240"
+    "1250126012701279128912991309131813281338134813571367137713871396"
+    "1406141614261436144514551465147514841494150415141523153315431553"
+    "1562157215821592160216111621163116411650166016701680168916991709"
+    "1719172917381748175817681777178717971807181618261836184618551865"
+    "1875188518951904191419241934194319531963197319821992200220122021"
+    "2031204120512061207020802090210021092119212921392148215821682178"
+    "2188219722072217222722362246225622662275228522952305231423242334"
+    "2344235423632373238323932402241224222432244124512461247124802490"
+    "2500251025202529253925492559256825782588259826072617262726372646"
+    "2656266626762686269527052715272527342744275427642773278327932803"
+    "2812282228322842285228612871288128912900291029202930293929492959"
+    "2969297929882998300830183027303730473057306630763086309631053115"
+    "3125313531453154316431743184319332033213322332323242325232623271"
+    "3281329133013311332033303340335033593369337933893398340834183428"
+    "3438344734573467347734863496350635163525353535453555356435743584"
+    "3594360436133623363336433652366236723682369137013711372137303740"
+    "3750376037703779378937993809381838283838384838573867387738873896"
+    "3906391639263936394539553965397539843994400440144023403340434053"
+    "4062407240824092410241114121413141414150416041704180418941994209"
+    "4219422942384248425842684277428742974307431643264336434643554365"
+    "4375438543954404441444244434444344534463447344824492450245124521"
+    "4531454145514561457045804590460046094619462946394648465846684678"
+    "4688469747074717472747364746475647664775478547954805481448244834"
+    "4844485448634873488348934902491249224932494149514961497149804990"
+    "5000501050205029503950495059506850785088509851075117512751375146"
+    "5156516651765186519552055215522552345244525452645273528352935303"
+    "5312532253325342535253615371538153915400541054205430543954495459"
+    "5469547954885498550855185527553755475557556655765586559656055615"
+    "5625563556455654566456745684569357035713572357325742575257625771"
+    "5781579158015811582058305840585058595869587958895898590859185928"
+    "5938594759575967597759865996600660166025603560456055606460746084"
+    "6094610461136123613361436152616261726182619162016211622162306240"
+    "6250626062706279628962996309631863286338634863576367637763876396"
+    "6406641664266436644564556465647564846494650465146523653365436553"
+    "6562657265826592660266116621663166416650666066706680668966996709"
+    "6719672967386748675867686777678767976807681668266836684668556865"
+    "6875688568956904691469246934694369536963697369826992700270127021"
+    "7031704170517061707070807090710071097119712971397148715871687178"
+    "7188719772077217722772367246725672667275728572957305731473247334"
+    "7344735473637373738373937402741274227432744174517461747174807490"
+    "7500751075207529753975497559756875787588759876077617762776377646"
+    "7656766676767686769577057715772577347744775477647773778377937803"
+    "7812782278327842785278617871788178917900791079207930793979497959"
+    "7969797979887998800880188027803780478057806680768086809681058115"
+    "8125813581458154816481748184819382038213822382328242825282628271"
+    "8281829183018311832083308340835083598369837983898398840884188428"
+    "8438844784578467847784868496850685168525853585458555856485748584"
+    "8594860486138623863386438652866286728682869187018711872187308740"
+    "8750876087708779878987998809881888288838884888578867887788878896"
+    "8906891689268936894589558965897589848994900490149023903390439053"
+    "9062907290829092910291119121913191419150916091709180918991999209"
+    "9219922992389248925892689277928792979307931693269336934693559365"
+    "9375938593959404941494249434944394539463947394829492950295129521"
+    "9531954195519561957095809590960096099619962996399648965896689678"
+    "9688969797079717972797369746975697669775978597959805981498249834"
+    "9844985498639873988398939902991299229932994199519961997199809990";
+
+/**
+ * Appends a chromaticity coordinate, value / 1024, as "0.dddd" correctly
+ * rounded to four decimals.
+ *
+ * @param sink Sink to append to
+ * @param value 10-bit coordinate from the base block
+ */
+void edid_sink_putchromaticity(struct edid_sink *sink, uint16_t value)
+{
+    const char *digits = chromaticity_digits + (value & 0x3FF) * 4;
+    char text[6] = {'0', '.', digits[0], digits[1], digits[2], digits[3]};
+
+    edid_sink_write(sink, text, sizeof(text));
+}
+
+/**
+ * Appends the display gamma, (gamma_encoded + 100) / 100, with decimals
+ * digits after the point (at most 4). The value has two decimals, so the
+ * result is exact and any further digits are zero.
+ *
+ * @param sink Sink to append to
+ * @param gamma_encoded Byte 23 of the base block
+ * @param decimals Digits after the point, 2 to 4
+ */
+void edid_sink_putgamma(struct edid_sink *sink, uint8_t gamma_encoded, int decimals)
+{
+    uint32_t hundredths = gamma_encoded + 100u;
+    char text[6] = {(char)('0' + hundredths / 100), '.', (char)('0' + hundredths / 10 % 10), (char)('0' + hundredths % 10), '0', '0'};
+
+    edid_sink_write(sink, text, 2 + (size_t)(decimals < 2 ? 2 : decimals > 4 ? 4 : decimals));
+}
@@ -0,0 +1,718 @@
+#include <string.h>
+#include <stdint.h>
+#include "parser.h"
+#include "edid_instrument.h"
+/**
+ * Machine-readable JSON and CSV formatters for the decoded EDID structures.
+ * Like the text formatters they write only through an edid_sink.
+ */
+
+static const char *const interface_names[] = {"Undefined", "DVI", "HDMIa", "HDMIb", "MDDI", "DisplayPort"};
+
+/**
+ * Selects an output format by name.
+ *
+ * @param name "text", "json" or "csv"
+ * @return EDID_FORMAT_* value, or -1 if the name is not known
+ */
+int edid_format_from_name(const char *name)
+{
+    if (strcmp(name, "text") == 0)
+    {
+        return EDID_FORMAT_TEXT;
+    }
+    if (strcmp(name, "json") == 0)
+    {
+        return EDID_FORMAT_JSON;
+    }
+    if (strcmp(name, "csv") == 0)
+    {
+        return EDID_FORMAT_CSV;
+    }
+    return -1;
+}
+
+/**
+ * Writes the bits per colour of a digital input. bit_depth 1..6 encode 6..16
+ * bits; 0 is undefined and 7 reserved, and write nothing.
+ *
+ * @return 1 if a value was written, 0 otherwise
+ */
+static int put_bits_per_colour(struct edid_sink *sink, const struct edid_info *info)
+{
+    if (info->bit_depth < 1 || info->bit_depth > 6)
+    {
+        return 0;
+    }
+    edid_sink_putu(sink, 4 + 2 * (uint32_t)info->bit_depth);
+    return 1;
+}
+
+/* JSON */
+
+static void json_string(struct edid_sink *sink, const char *text, size_t len)
+{
+    static const char hex_digits[] = "0123456789abcdef";
+    size_t start = 0;
+
+    edid_sink_putc(sink, '"');
+    for (size_t i = 0; i < len; i++)
+    {
+        unsigned char c = (unsigned char)text[i];
+
+        if (c >= 0x20 && c < 0x7F && c != '"' && c != '\\')
+        {
+            continue;
+        }
+        edid_sink_write(sink, text + start, i - start);
+        start = i + 1;
+        if (c == '"' || c == '\\')
+        {
+            char escaped[2] = {'\\', (char)c};
+            edid_sink_write(sink, escaped, 2);
+        }
+        else
+        {
+            // Control characters and code page bytes above 0x7E as \u00XX
+            char escaped[6] = {'\\', 'u', '0', '0', hex_digits[c >> 4], hex_digits[c & 0x0F]};
+            edid_sink_write(sink, escaped, 6);
+        }
+    }
+    edid_sink_write(sink, text + start, len - start);
+    edid_sink_putc(sink, '"');
+}
+
+/**
+ * Starts a member of the current object: a comma unless it is the first one,
+ * then the quoted key and colon.
+ */
+static void json_key(struct edid_sink *sink, int *first, const char *key)
+{
+    if (!*first)
+    {
+        edid_sink_putc(sink, ',');
+    }
+    *first = 0;
+    edid_sink_putc(sink, '"');
+    edid_sink_puts(sink, key);
+    EDID_SINK_LITERAL(sink, "\":");
+}
+
+static void json_bool(struct edid_sink *sink, int value)
+{
+    if (value)
+    {
+        EDID_SINK_LITERAL(sink, "true");
+    }
+    else
+    {
+        EDID_SINK_LITERAL(sink, "false");
+    }
+}
+
+static void json_pair(struct edid_sink *sink, uint32_t a, uint32_t b)
+{
+    edid_sink_putc(sink, '[');
+    edid_sink_putu(sink, a);
+    edid_sink_putc(sink, ',');
+    edid_sink_putu(sink, b);
+    edid_sink_putc(sink, ']');
+}
+
+static void json_chromaticity_point(struct edid_sink *sink, int *first, const char *key, uint16_t x, uint16_t y)
+{
+    json_key(sink, first, key);
+    edid_sink_putc(sink, '[');
+    edid_sink_putchromaticity(sink, x);
+    edid_sink_putc(sink, ',');
+    edid_sink_putchromaticity(sink, y);
+    edid_sink_putc(sink, ']');
+}
+
+static void json_timings(struct edid_sink *sink, const struct edid_detailed_timing *timings, unsigned int count)
+{
+    edid_sink_putc(sink, '[');
+    for (unsigned int i = 0; i < count; i++)
+    {
+        const struct edid_detailed_timing *t = &timings[i];
+        int first = 1;
+
+        if (i)
+        {
+            edid_sink_putc(sink, ',');
+        }
+        edid_sink_putc(sink, '{');
+        json_key(sink, &first, "width");
+        edid_sink_putu(sink, t->horizontal_active);
+        json_key(sink, &first, "height");
+        edid_sink_putu(sink, t->vertical_active);
+        json_key(sink, &first, "refresh_hz");
+        edid_sink_putfixed(sink, t->refresh_mhz, 3);
+        json_key(sink, &first, "pixel_clock_khz");
+        edid_sink_putu(sink, t->pixel_clock_khz);
+        json_key(sink, &first, "interlaced");
+        json_bool(sink, t->flags & 0x80);
+        json_key(sink, &first, "horizontal");
+        edid_sink_putc(sink, '[');
+        edid_sink_putu(sink, t->horizontal_blanking);
+        edid_sink_putc(sink, ',');
+        edid_sink_putu(sink, t->horizontal_sync_offset);
+        edid_sink_putc(sink, ',');
+        edid_sink_putu(sink, t->horizontal_sync_width);
+        edid_sink_putc(sink, ']');
+        json_key(sink, &first, "vertical");
+        edid_sink_putc(sink, '[');
+        edid_sink_putu(sink, t->vertical_blanking);
+        edid_sink_putc(sink, ',');
+        edid_sink_putu(sink, t->vertical_sync_offset);
+        edid_sink_putc(sink, ',');
+        edid_sink_putu(sink, t->vertical_sync_width);
+        edid_sink_putc(sink, ']');
+        json_key(sink, &first, "image_mm");
+        json_pair(sink, t->horizontal_image_mm, t->vertical_image_mm);
+        edid_sink_putc(sink, '}');
+    }
+    edid_sink_putc(sink, ']');
+}
+
+static void json_cta(struct edid_sink *sink, const struct edid_cta_info *cta)
+{
+    int first = 1;
+
+    edid_sink_putc(sink, '{');
+    json_key(sink, &first, "revision");
+    edid_sink_putu(sink, cta->revision);
+    json_key(sink, &first, "vics");
+    edid_sink_putc(sink, '[');
+    for (int i = 0; i < cta->vic_count; i++)
+    {
+        if (i)
+        {
+            edid_sink_putc(sink, ',');
+        }
+        edid_sink_putu(sink, cta->vics[i]);
+    }
+    edid_sink_putc(sink, ']');
+    json_key(sink, &first, "native_vics");
+    edid_sink_putc(sink, '[');
+    for (int i = 0, listed = 0; i < cta->vic_count; i++)
+    {
+        if (cta->native_vics & ((uint64_t)1 << i))
+        {
+            if (listed++)
+            {
+                edid_sink_putc(sink, ',');
+            }
+            edid_sink_putu(sink, cta->vics[i]);
+        }
+    }
+    edid_sink_putc(sink, ']');
+    json_key(sink, &first, "audio_formats");
+    edid_sink_putc(sink, '[');
+    for (int i = 0; i < cta->audio_count; i++)
+    {
+        if (i)
+        {
+            edid_sink_putc(sink, ',');
+        }
+        edid_sink_putu(sink, cta->audio[i].format);
+    }
+    edid_sink_putc(sink, ']');
+
+    if (cta->has_hdmi)
+    {
+        int hdmi_first = 1;
+
+        json_key(sink, &first, "hdmi");
+        edid_sink_putc(sink, '{');
+        json_key(sink, &hdmi_first, "physical_address");
+        edid_sink_putc(sink, '"');
+        for (int shift = 12; shift >= 0; shift -= 4)
+        {
+            edid_sink_putu(sink, (cta->physical_address >> shift) & 0x0F);
+            if (shift)
+            {
+                edid_sink_putc(sink, '.');
+            }
+        }
+        edid_sink_putc(sink, '"');
+        json_key(sink, &hdmi_first, "max_tmds_mhz");
+        edid_sink_putu(sink, cta->hdmi_max_tmds_mhz);
+        edid_sink_putc(sink, '}');
+    }
+    if (cta->has_hdmi_forum)
+    {
+        int forum_first = 1;
+
+        json_key(sink, &first, "hdmi_forum");
+        edid_sink_putc(sink, '{');
+        json_key(sink, &forum_first, "version");
+        edid_sink_putu(sink, cta->hdmi_forum_version);
+        json_key(sink, &forum_first, "max_tmds_mhz");
+        edid_sink_putu(sink, cta->hdmi_forum_max_tmds_mhz);
+        json_key(sink, &forum_first, "max_frl");
+        edid_sink_putu(sink, cta->hdmi_forum_max_frl);
+        edid_sink_putc(sink, '}');
+    }
+    if (cta->has_hdr_static)
+    {
+        int hdr_first = 1;
+
+        json_key(sink, &first, "hdr_static");
+        edid_sink_putc(sink, '{');
+        json_key(sink, &hdr_first, "eotfs");
+        edid_sink_putu(sink, cta->hdr_eotfs);
+        json_key(sink, &hdr_first, "metadata_types");
+        edid_sink_putu(sink, cta->hdr_metadata_types);
+        edid_sink_putc(sink, '}');
+    }
+    json_key(sink, &first, "detailed_timings");
+    json_timings(sink, cta->detailed_timings, cta->detailed_timing_count);
+    edid_sink_putc(sink, '}');
+}
+
+static void json_displayid(struct edid_sink *sink, const struct edid_displayid_info *displayid)
+{
+    int first = 1;
+
+    edid_sink_putc(sink, '{');
+    json_key(sink, &first, "version");
+    edid_sink_putu(sink, displayid->version >> 4);
+    edid_sink_putc(sink, '.');
+    edid_sink_putu(sink, displayid->version & 0x0F);
+    json_key(sink, &first, "product_type");
+    edid_sink_putu(sink, displayid->product_type);
+    json_key(sink, &first, "bad_sections");
+    edid_sink_putu(sink, displayid->bad_sections);
+    if (displayid->product_name[0])
+    {
+        json_key(sink, &first, "product_name");
+        json_string(sink, displayid->product_name, strlen(displayid->product_name));
+    }
+    json_key(sink, &first, "detailed_timings");
+    json_timings(sink, displayid->detailed_timings, displayid->detailed_timing_count);
+    if (displayid->preferred_timing != 0xFF)
+    {
+        json_key(sink, &first, "preferred_timing");
+        edid_sink_putu(sink, displayid->preferred_timing);
+    }
+    if (displayid->has_tile)
+    {
+        const struct edid_displayid_tile *tile = &displayid->tile;
+        int tile_first = 1;
+
+        json_key(sink, &first, "tile");
+        edid_sink_putc(sink, '{');
+        json_key(sink, &tile_first, "tiles");
+        json_pair(sink, tile->horizontal_tiles, tile->vertical_tiles);
+        json_key(sink, &tile_first, "location");
+        json_pair(sink, tile->horizontal_location, tile->vertical_location);
+        json_key(sink, &tile_first, "size");
+        json_pair(sink, tile->tile_width, tile->tile_height);
+        edid_sink_putc(sink, '}');
+    }
+    edid_sink_putc(sink, '}');
+}
+
+/**
+ * Formats one decoded EDID as a single-line JSON object followed by a newline,
+ * so a stream of EDIDs reads as JSON Lines.
+ *
+ * @param info Decoded base block
+ * @param ext Decoded extensions, or NULL if they were not parsed
+ * @param sink Output sink receiving the JSON
+ */
+void format_edid_json(const struct edid_info *info, const struct edid_ext_info *ext, struct edid_sink *sink)
+{
+    const struct edid_chromaticity *c = &info->chromaticity;
+    const char *manufacturer_name = edid_pnp_lookup(info->manufacturer_id);
+    int first = 1;
+
+    edid_sink_putc(sink, '{');
+    json_key(sink, &first, "header_valid");
+    json_bool(sink, info->header_valid);
+    json_key(sink, &first, "checksum_valid");
+    json_bool(sink, !(info->status & EDID_STATUS_BAD_CHECKSUM));
+    if (!info->header_valid)
+    {
+        // Nothing else is decoded from a block without the header
+        EDID_SINK_LITERAL(sink, "}\n");
+        return;
+    }
+    json_key(sink, &first, "manufacturer");
+    json_string(sink, info->manufacturer_id, strlen(info->manufacturer_id));
+    json_key(sink, &first, "manufacturer_name");
+    if (manufacturer_name)
+    {
+        json_string(sink, manufacturer_name, strlen(manufacturer_name));
+    }
+    else
+    {
+        EDID_SINK_LITERAL(sink, "null");
+    }
+    json_key(sink, &first, "product_code");
+    edid_sink_putu(sink, info->product_code);
+    json_key(sink, &first, "serial_number");
+    edid_sink_putu(sink, info->serial_number);
+    json_key(sink, &first, "manufacture_week");
+    edid_sink_putu(sink, info->manufacture_week);
+    json_key(sink, &first, "manufacture_year");
+    edid_sink_putu(sink, info->manufacture_year);
+    json_key(sink, &first, "version");
+    edid_sink_putc(sink, '"');
+    edid_sink_putu(sink, info->version);
+    edid_sink_putc(sink, '.');
+    edid_sink_putu(sink, info->revision);
+    edid_sink_putc(sink, '"');
+
+    json_key(sink, &first, "digital");
+    json_bool(sink, info->digital);
+    if (info->digital)
+    {
+        json_key(sink, &first, "bits_per_colour");
+        if (!put_bits_per_colour(sink, info))
+        {
+            EDID_SINK_LITERAL(sink, "null");
+        }
+        json_key(sink, &first, "interface");
+        if (info->interface < 6)
+        {
+            json_string(sink, interface_names[info->interface], strlen(interface_names[info->interface]));
+        }
+        else
+        {
+            EDID_SINK_LITERAL(sink, "null");
+        }
+    }
+    else
+    {
+        json_key(sink, &first, "signal_level");
+        edid_sink_putu(sink, info->signal_level);
+        json_key(sink, &first, "sync_types");
+        edid_sink_putu(sink, info->sync_types);
+    }
+    json_key(sink, &first, "screen_cm");
+    json_pair(sink, info->horizontal_size_cm, info->vertical_size_cm);
+    json_key(sink, &first, "gamma");
+    if (info->gamma_encoded == 0xFF)
+    {
+        EDID_SINK_LITERAL(sink, "null");
+    }
+    else
+    {
+        edid_sink_putgamma(sink, info->gamma_encoded, 2);
+    }
+    json_key(sink, &first, "features");
+    edid_sink_putu(sink, info->features);
+
+    int chroma_first = 1;
+    json_key(sink, &first, "chromaticity");
+    edid_sink_putc(sink, '{');
+    json_chromaticity_point(sink, &chroma_first, "red", c->red_x, c->red_y);
+    json_chromaticity_point(sink, &chroma_first, "green", c->green_x, c->green_y);
+    json_chromaticity_point(sink, &chroma_first, "blue", c->blue_x, c->blue_y);
+    json_chromaticity_point(sink, &chroma_first, "white", c->white_x, c->white_y);
+    edid_sink_putc(sink, '}');
+
+    json_key(sink, &first, "established_timings");
+    edid_sink_putu(sink, info->established_timings);
+    json_key(sink, &first, "standard_timings");
+    edid_sink_putc(sink, '[');
+    for (int i = 0; i < info->standard_timing_count; i++)
+    {
+        const struct edid_standard_timing *st = &info->standard_timings[i];
+        int timing_first = 1;
+
+        if (i)
+        {
+            edid_sink_putc(sink, ',');
+        }
+        edid_sink_putc(sink, '{');
+        json_key(sink, &timing_first, "width");
+        edid_sink_putu(sink, st->horizontal_resolution);
+        json_key(sink, &timing_first, "height");
+        edid_sink_putu(sink, st->vertical_resolution);
+        json_key(sink, &timing_first, "refresh_hz");
+        edid_sink_putu(sink, st->vertical_frequency);
+        edid_sink_putc(sink, '}');
+    }
+    edid_sink_putc(sink, ']');
+    json_key(sink, &first, "detailed_timings");
+    json_timings(sink, info->detailed_timings, info->detailed_timing_count);
+
+    if (info->monitor_name[0])
+    {
+        json_key(sink, &first, "monitor_name");
+        json_string(sink, info->monitor_name, strlen(info->monitor_name));
+    }
+    if (info->serial_string[0])
+    {
+        json_key(sink, &first, "serial_string");
+        json_string(sink, info->serial_string, strlen(info->serial_string));
+    }
+    if (info->unspecified_text[0])
+    {
+        json_key(sink, &first, "text");
+        json_string(sink, info->unspecified_text, strlen(info->unspecified_text));
+    }
+    if (info->has_range_limits)
+    {
+        const struct edid_range_limits *r = &info->range_limits;
+        int range_first = 1;
+
+        json_key(sink, &first, "range_limits");
+        edid_sink_putc(sink, '{');
+        json_key(sink, &range_first, "vertical_hz");
+        json_pair(sink, r->min_vertical_hz, r->max_vertical_hz);
+        json_key(sink, &range_first, "horizontal_khz");
+        json_pair(sink, r->min_horizontal_khz, r->max_horizontal_khz);
+        json_key(sink, &range_first, "max_pixel_clock_mhz");
+        edid_sink_putu(sink, r->max_pixel_clock_mhz);
+        edid_sink_putc(sink, '}');
+    }
+
+    if (ext)
+    {
+        int ext_first = 1;
+
+        json_key(sink, &first, "extensions");
+        edid_sink_putc(sink, '{');
+        json_key(sink, &ext_first, "count");
+        edid_sink_putu(sink, ext->block_count);
+        json_key(sink, &ext_first, "bad_checksums");
+        edid_sink_putu(sink, ext->bad_checksums);
+        if (ext->cta.present)
+        {
+            json_key(sink, &ext_first, "cta");
+            json_cta(sink, &ext->cta);
+        }
+        if (ext->displayid.present || ext->displayid.bad_sections)
+        {
+            json_key(sink, &ext_first, "displayid");
+            json_displayid(sink, &ext->displayid);
+        }
+        edid_sink_putc(sink, '}');
+    }
+    EDID_SINK_LITERAL(sink, "}\n");
+}
+
+/* CSV */
+
+/**
+ * Writes one CSV field, quoted (with quotes doubled) only when it holds a
+ * comma, quote or line break.
+ */
+static void csv_field(struct edid_sink *sink, const char *text)
+{
+    size_t len = strlen(text);
+
+    if (strcspn(text, ",\"\r\n") == len)
+    {
+        edid_sink_write(sink, text, len);
+        return;
+    }
+
+    edid_sink_putc(sink, '"');
+    for (const char *quote; (quote = strchr(text, '"')) != NULL; text = quote + 1)
+    {
+        edid_sink_write(sink, text, (size_t)(quote - text) + 1);
+        edid_sink_putc(sink, '"');
+    }
+    edid_sink_puts(sink, text);
+    edid_sink_putc(sink, '"');
+}
+
+/**
+ * Writes the header line naming the columns of format_edid_csv_row().
+ */
+void format_edid_csv_header(struct edid_sink *sink)
+{
+    EDID_SINK_LITERAL(sink, "manufacturer,manufacturer_name,product_code,serial_number,manufacture_week,manufacture_year,version,"
+                            "monitor_name,serial_string,header_valid,checksum_valid,digital,bits_per_colour,interface,"
+                            "width_cm,height_cm,gamma,preferred_width,preferred_height,preferred_refresh_hz,"
+                            "preferred_pixel_clock_khz,max_pixel_clock_mhz,extension_count,cta,hdmi,max_tmds_mhz,"
+                            "hdr_static,displayid,tiles\n");
+}
+
+/**
+ * Formats one decoded EDID as a CSV row matching format_edid_csv_header().
+ * Values that are absent are left empty.
+ *
+ * @param info Decoded base block
+ * @param ext Decoded extensions, or NULL if they were not parsed
+ * @param sink Output sink receiving the row and its newline
+ */
+void format_edid_csv_row(const struct edid_info *info, const struct edid_ext_info *ext, struct edid_sink *sink)
+{
+    if (!info->header_valid)
+    {
+        EDID_SINK_LITERAL(sink, ",,,,,,,,,0,");
+        edid_sink_putu(sink, !(info->status & EDID_STATUS_BAD_CHECKSUM));
+        EDID_SINK_LITERAL(sink, ",,,,,,,,,,,,,,,,,,\n");
+        return;
+    }
+
+    const char *manufacturer_name = edid_pnp_lookup(info->manufacturer_id);
+
+    csv_field(sink, info->manufacturer_id);
+    edid_sink_putc(sink, ',');
+    csv_field(sink, manufacturer_name ? manufacturer_name : "");
+    edid_sink_putc(sink, ',');
+    edid_sink_putu(sink, info->product_code);
+    edid_sink_putc(sink, ',');
+    edid_sink_putu(sink, info->serial_number);
+    edid_sink_putc(sink, ',');
+    edid_sink_putu(sink, info->manufacture_week);
+    edid_sink_putc(sink, ',');
+    edid_sink_putu(sink, info->manufacture_year);
+    edid_sink_putc(sink, ',');
+    edid_sink_putu(sink, info->version);
+    edid_sink_putc(sink, '.');
+    edid_sink_putu(sink, info->revision);
+    edid_sink_putc(sink, ',');
+    csv_field(sink, info->monitor_name);
+    edid_sink_putc(sink, ',');
+    csv_field(sink, info->serial_string);
+    edid_sink_putc(sink, ',');
+    edid_sink_putu(sink, info->header_valid);
+    edid_sink_putc(sink, ',');
+    edid_sink_putu(sink, info->checksum_valid);
+    edid_sink_putc(sink, ',');
+    edid_sink_putu(sink, info->digital);
+    edid_sink_putc(sink, ',');
+    if (info->digital)
+    {
+        put_bits_per_colour(sink, info);
+    }
+    edid_sink_putc(sink, ',');
+    if (info->digital && info->interface < 6)
+    {
+        edid_sink_puts(sink, interface_names[info->interface]);
+    }
+    edid_sink_putc(sink, ',');
+    edid_sink_putu(sink, info->horizontal_size_cm);
+    edid_sink_putc(sink, ',');
+    edid_sink_putu(sink, info->vertical_size_cm);
+    edid_sink_putc(sink, ',');
+    if (info->gamma_encoded != 0xFF)
+    {
+        edid_sink_putgamma(sink, info->gamma_encoded, 2);
+    }
+    edid_sink_putc(sink, ',');
+
+    if (info->detailed_timing_count)
+    {
+        const struct edid_detailed_timing *t = &info->detailed_timings[0];
+
+        edid_sink_putu(sink, t->horizontal_active);
+        edid_sink_putc(sink, ',');
+        edid_sink_putu(sink, t->vertical_active);
+        edid_sink_putc(sink, ',');
+        edid_sink_putfixed(sink, t->refresh_mhz, 3);
+        edid_sink_putc(sink, ',');
+        edid_sink_putu(sink, t->pixel_clock_khz);
+    }
+    else
+    {
+        EDID_SINK_LITERAL(sink, ",,,");
+    }
+    edid_sink_putc(sink, ',');
+    if (info->has_range_limits)
+    {
+        edid_sink_putu(sink, info->range_limits.max_pixel_clock_mhz);
+    }
+    edid_sink_putc(sink, ',');
+
+    if (ext)
+    {
+        const struct edid_cta_info *cta = &ext->cta;
+        uint16_t max_tmds = cta->has_hdmi_forum && cta->hdmi_forum_max_tmds_mhz > cta->hdmi_max_tmds_mhz
+                                ? cta->hdmi_forum_max_tmds_mhz
+                                : cta->hdmi_max_tmds_mhz;
+
+        edid_sink_putu(sink, ext->block_count);
+        edid_sink_putc(sink, ',');
+        edid_sink_putu(sink, cta->present);
+        edid_sink_putc(sink, ',');
+        edid_sink_putu(sink, cta->has_hdmi);
+        edid_sink_putc(sink, ',');
+        if (max_tmds)
+        {
+            edid_sink_putu(sink, max_tmds);
+        }
+        edid_sink_putc(sink, ',');
+        edid_sink_putu(sink, cta->has_hdr_static);
+        edid_sink_putc(sink, ',');
+        edid_sink_putu(sink, ext->displayid.present);
+        edid_sink_putc(sink, ',');
+        if (ext->displayid.has_tile)
+        {
+            edid_sink_putu(sink, ext->displayid.tile.horizontal_tiles);
+            edid_sink_putc(sink, 'x');
+            edid_sink_putu(sink, ext->displayid.tile.vertical_tiles);
+        }
+    }
+    else
+    {
+        EDID_SINK_LITERAL(sink, ",,,,,,");
+    }
+    edid_sink_putc(sink, '\n');
+}
+
+/**
+ * Formats decoded structures in the given format, ending with the separator
+ * for a stream of EDIDs: a blank line for text, a newline for JSON and CSV.
+ *
+ * @param info Decoded base block
+ * @param ext Decoded extensions, or NULL if the header was invalid
+ * @param format EDID_FORMAT_TEXT, EDID_FORMAT_JSON or EDID_FORMAT_CSV
+ * @param sink Output sink
+ */
+void format_edid_as(const struct edid_info *info, const struct edid_ext_info *ext, int format, struct edid_sink *sink)
+{
+    switch (format)
+    {
+    case EDID_FORMAT_JSON:
+        format_edid_json(info, ext, sink);
+        break;
+    case EDID_FORMAT_CSV:
+        format_edid_csv_row(info, ext, sink);
+        break;
+    default:
+        format_edid_info(info, sink);
+        if (ext)
+        {
+            EDID_PROBE(EDID_PROBE_FORMAT_EXTENSIONS, format_edid_extensions(ext, sink));
+        }
+        edid_sink_putc(sink, '\n');
+        break;
+    }
+}
+
+/**
+ * Parses a base block and its extension blocks and formats them with
+ * format_edid_as(). Unlike parse_edid_blocks() the result ends with the
+ * separator for a stream of EDIDs.
+ *
+ * @param data Pointer to the base block followed by its extension blocks
+ * @param length Number of bytes available in data, at least 128
+ * @param format EDID_FORMAT_TEXT, EDID_FORMAT_JSON or EDID_FORMAT_CSV
+ * @param output Buffer receiving the output, or NULL to only measure it
+ * @param capacity Size of output in bytes
+ * @return Length of the full output excluding the NUL
+ */
+size_t parse_edid_blocks_as(const unsigned char *data, size_t length, int format, char *output, size_t capacity)
+{
+    struct edid_info info;
+    struct edid_ext_info ext;
+    struct edid_sink sink;
+
+    edid_sink_init(&sink, output, capacity);
+    parse_edid_struct(data, &info);
+    if (info.header_valid)
+    {
+        EDID_PROBE(EDID_PROBE_EXTENSIONS, parse_edid_extensions(data, length, &ext));
+    }
+    EDID_PROBE(EDID_PROBE_OUTPUT, format_edid_as(&info, info.header_valid ? &ext : NULL, format, &sink));
+    return sink.length;
+}
@@ -0,0 +1,229 @@
+#include <string.h>
+#include <stdint.h>
+#include "parser.h"
+#include "edid_simd.h"
+#include "edid_instrument.h"
+/**
+ * Table driven hex text to binary decoder for EDID dumps
+ */
+
+#define HEX_SEP 0x10 // whitespace or ':' between bytes
+#define HEX_BAD 0xFF
+
+static const uint8_t hex_value[256] = {
+    HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_SEP, HEX_SEP, HEX_SEP, HEX_SEP, HEX_SEP, HEX_BAD, HEX_BAD,
+    HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD,
+    HEX_SEP, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD,
+    0x00,    0x01,    0x02,    0x03,    0x04,    0x05,    0x06,    0x07,    0x08,    0x09,    HEX_SEP, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD,
+    HEX_BAD, 0x0A,    0x0B,    0x0C,    0x0D,    0x0E,    0x0F,    HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD,
+    HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD,
+    HEX_BAD, 0x0A,    0x0B,    0x0C,    0x0D,    0x0E,    0x0F,    HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD,
+    HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD,
+    HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD,
+    HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD,
+    HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD,
+    HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD,
+    HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD,
+    HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD,
+    HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD,
+    HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD, HEX_BAD,
+};
+
+#if EDID_HAVE_SSE2
+/**
+ * Decodes 16 packed hex digits into 8 bytes.
+ *
+ * @return 1 on success, 0 if any of the 16 characters is not a hex digit
+ */
+static int decode_packed16_sse2(const char *src, unsigned char *dst)
+{
+    __m128i c = _mm_loadu_si128((const __m128i *)src);
+    __m128i lower = _mm_or_si128(c, _mm_set1_epi8(0x20));
+
+    // Signed compares are fine here: bytes >= 0x80 are negative and fail both ranges
+    __m128i is_digit = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(c, _mm_set1_epi8('9' + 1)));
+    __m128i is_alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+
+    if (_mm_movemask_epi8(_mm_or_si128(is_digit, is_alpha)) != 0xFFFF)
+    {
+        return 0;
+    }
+
+    __m128i digit = _mm_and_si128(is_digit, _mm_sub_epi8(c, _mm_set1_epi8('0')));
+    __m128i alpha = _mm_andnot_si128(is_digit, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10)));
+    __m128i nibbles = _mm_or_si128(digit, alpha);
+
+    // Each 16-bit lane holds (low nibble << 8) | high nibble
+    __m128i high = _mm_slli_epi16(_mm_and_si128(nibbles, _mm_set1_epi16(0x00FF)), 4);
+    __m128i low = _mm_srli_epi16(nibbles, 8);
+    __m128i bytes = _mm_packus_epi16(_mm_or_si128(high, low), _mm_setzero_si128());
+
+    _mm_storel_epi64((__m128i *)dst, bytes);
+    return 1;
+}
+#endif
+
+#if EDID_HAVE_AVX2
+/**
+ * Decodes 32 packed hex digits into 16 bytes.
+ *
+ * @return 1 on success, 0 if any of the 32 characters is not a hex digit
+ */
+EDID_TARGET_AVX2
+static int decode_packed32_avx2(const char *src, unsigned char *dst)
+{
+    __m256i c = _mm256_loadu_si256((const __m256i *)src);
+    __m256i lower = _mm256_or_si256(c, _mm256_set1_epi8(0x20));
+
+    __m256i is_digit = _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), c));
+    __m256i is_alpha = _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('f' + 1), lower));
+
+    if ((uint32_t)_mm256_movemask_epi8(_mm256_or_si256(is_digit, is_alpha)) != 0xFFFFFFFFu)
+    {
+        return 0;
+    }
+
+    __m256i digit = _mm256_and_si256(is_digit, _mm256_sub_epi8(c, _mm256_set1_epi8('0')));
+    __m256i alpha = _mm256_andnot_si256(is_digit, _mm256_sub_epi8(lower, _mm256_set1_epi8('a' - 10)));
+    __m256i nibbles = _mm256_or_si256(digit, alpha);
+
+    // Combine nibble pairs with one multiply-add: high * 16 + low
+    __m256i pairs = _mm256_maddubs_epi16(nibbles, _mm256_set1_epi16(0x0110));
+    __m256i bytes = _mm256_packus_epi16(pairs, _mm256_setzero_si256());
+
+    // packus works per 128-bit lane; gather qwords 0 and 2 into the low half
+    bytes = _mm256_permute4x64_epi64(bytes, 0x08);
+    _mm_storeu_si128((__m128i *)dst, _mm256_castsi256_si128(bytes));
+    return 1;
+}
+#endif
+
+/**
+ * Decodes hex text into bytes. Bytes may be packed ("00FFFF") or separated by
+ * any run of whitespace or ':' ("00 FF FF", "00:ff:ff"). Decoding stops at the
+ * end of the text, when the output is full, or at the first invalid character.
+ *
+ * @param hex Hex text, not necessarily NUL terminated
+ * @param len Number of characters in hex
+ * @param out Destination for the decoded bytes
+ * @param capacity Size of out in bytes
+ * @param error_pos Set to the index of the first invalid character, or EDID_HEX_NO_ERROR. May be NULL.
+ * @return Number of bytes written to out
+ */
+size_t edid_hex_decode(const char *hex, size_t len, unsigned char *out, size_t capacity, size_t *error_pos)
+{
+    const unsigned char *src = (const unsigned char *)hex;
+    size_t pos = 0;
+    size_t count = 0;
+#if EDID_HAVE_AVX2
+    int use_avx2 = (edid_cpu_features() & EDID_CPU_AVX2) != 0;
+#endif
+
+    if (error_pos)
+    {
+        *error_pos = EDID_HEX_NO_ERROR;
+    }
+
+    while (pos < len && count < capacity)
+    {
+        uint8_t high = hex_value[src[pos]];
+
+        if (high == HEX_SEP)
+        {
+            pos++;
+            continue;
+        }
+
+        // A hex digit right after a full byte means the text is packed; try the wide paths
+        if (high < 0x10 && pos + 2 < len && hex_value[src[pos + 2]] < 0x10)
+        {
+#if EDID_HAVE_AVX2
+            if (use_avx2)
+            {
+                while (len - pos >= 32 && capacity - count >= 16 && decode_packed32_avx2(hex + pos, out + count))
+                {
+                    pos += 32;
+                    count += 16;
+                }
+            }
+#endif
+#if EDID_HAVE_SSE2
+            while (len - pos >= 16 && capacity - count >= 8 && decode_packed16_sse2(hex + pos, out + count))
+            {
+                pos += 16;
+                count += 8;
+            }
+#endif
+            if (pos >= len || count >= capacity)
+            {
+                break;
+            }
+            high = hex_value[src[pos]];
+            if (high == HEX_SEP)
+            {
+                continue;
+            }
+        }
+
+        if (high >= 0x10)
+        {
+            if (error_pos)
+            {
+                *error_pos = pos;
+            }
+            return count;
+        }
+
+        if (pos + 1 >= len || hex_value[src[pos + 1]] >= 0x10)
+        {
+            // Lone nibble: report the character that should have completed it
+            if (error_pos)
+            {
+                *error_pos = pos + 1 < len ? pos + 1 : pos;
+            }
+            return count;
+        }
+
+        out[count++] = (unsigned char)((high << 4) | hex_value[src[pos + 1]]);
+        pos += 2;
+    }
+
+    return count;
+}
+
+/**
+ * Parses the EDID data
+ *
+ * @param edid Pointer to the EDID hex string, optionally followed by extension blocks
+ * @param output Buffer receiving the text, or NULL to only measure it
+ * @param capacity Size of output in bytes
+ * @return Length of the full text excluding the NUL
+ */
+size_t parse_edid_string(const char *hex_string, char *output, size_t capacity)
+{
+    unsigned char edid[EDID_LENGTH * EDID_MAX_BLOCKS] = {0};
+    size_t length = string_to_hex(hex_string, edid, sizeof(edid));
+
+    // Short input is parsed as one zero-padded block
+    if (length < EDID_LENGTH)
+    {
+        length = EDID_LENGTH;
+    }
+    return parse_edid_blocks(edid, length, output, capacity);
+}
+
+/**
+ * Converts the hex string to hex format
+ *
+ * @param hex_string NUL terminated EDID hex string
+ * @param edid Buffer receiving the decoded bytes
+ * @param capacity Size of edid in bytes
+ * @return Number of bytes decoded
+ */
+size_t string_to_hex(const char *hex_string, unsigned char *edid, size_t capacity)
+{
+    size_t length;
+
+    EDID_PROBE(EDID_PROBE_HEX, length = edid_hex_decode(hex_string, strlen(hex_string), edid, capacity, NULL));
+    return length;
+}
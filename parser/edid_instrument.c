@@ -0,0 +1,403 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "parser.h"
+#include "edid_instrument.h"
+/**
+ * Per-thread stage counters behind EDID_PROBE and the report summing them
+ */
+
+/**
+ * Counters of one thread. Only the owning thread writes them; blocks are
+ * linked into a list once and stay there after the thread exits, so its
+ * counts are still reported. An exited thread's block is handed to the next
+ * new thread, which keeps adding to it, so the list only grows to the most
+ * threads that recorded at once.
+ */
+struct edid_instrument_thread
+{
+    struct edid_probe_stats probes[EDID_PROBE_COUNT];
+    struct edid_instrument_thread *next;
+    _Atomic int owned;                  // 1 while a live thread records into the block
+    unsigned int threads;               // threads that have owned the block
+};
+
+static _Atomic(struct edid_instrument_thread *) instrument_threads;
+static _Thread_local struct edid_instrument_thread *instrument_local;
+static pthread_key_t instrument_key;
+static pthread_once_t instrument_key_once = PTHREAD_ONCE_INIT;
+
+/**
+ * Thread exit: gives the block back for the next thread to claim.
+ */
+static void release_thread(void *block)
+{
+    struct edid_instrument_thread *local = block;
+
+    atomic_store_explicit(&local->owned, 0, memory_order_release);
+}
+
+static void create_key(void)
+{
+    pthread_key_create(&instrument_key, release_thread);
+}
+
+/**
+ * Claims a block left by an exited thread, or links a new one into the list.
+ *
+ * @return The calling thread's block, or NULL if none is free and allocation fails
+ */
+static struct edid_instrument_thread *claim_thread(void)
+{
+    struct edid_instrument_thread *local;
+
+    pthread_once(&instrument_key_once, create_key);
+    for (local = atomic_load_explicit(&instrument_threads, memory_order_acquire); local; local = local->next)
+    {
+        int free_block = 0;
+
+        if (atomic_compare_exchange_strong_explicit(&local->owned, &free_block, 1, memory_order_acquire,
+                                                    memory_order_relaxed))
+        {
+            break;
+        }
+    }
+
+    if (!local)
+    {
+        local = calloc(1, sizeof(*local));
+        if (!local)
+        {
+            return NULL;
+        }
+        atomic_init(&local->owned, 1);
+        local->next = atomic_load_explicit(&instrument_threads, memory_order_relaxed);
+        while (!atomic_compare_exchange_weak_explicit(&instrument_threads, &local->next, local, memory_order_release,
+                                                      memory_order_relaxed))
+        {
+        }
+    }
+    local->threads++;
+    pthread_setspecific(instrument_key, local);
+    return local;
+}
+
+static const char *const probe_names[EDID_PROBE_COUNT] = {
+    "hex",
+    "header",
+    "checksum",
+    "decode manufacturer_id",
+    "decode product_code",
+    "decode serial_number",
+    "decode manufacture_date",
+    "decode edid_version",
+    "decode video_input",
+    "decode screen_size",
+    "decode display_gamma",
+    "decode supported_features",
+    "decode colour_characteristics",
+    "decode established_timings",
+    "decode standard_timings",
+    "decode descriptors",
+    "extensions",
+    "output",
+    "  format manufacturer_id",
+    "  format product_code",
+    "  format serial_number",
+    "  format manufacture_date",
+    "  format edid_version",
+    "  format video_input",
+    "  format screen_size",
+    "  format display_gamma",
+    "  format supported_features",
+    "  format colour_characteristics",
+    "  format established_timings",
+    "  format standard_timings",
+    "  format descriptors",
+    "  format extensions",
+};
+
+const char *edid_instrument_probe_name(enum edid_probe probe)
+{
+    return probe < EDID_PROBE_COUNT ? probe_names[probe] : "unknown";
+}
+
+/**
+ * Adds one measured call to the calling thread's counters. The first call
+ * on a thread claims or allocates its counters; if that fails the call is
+ * dropped.
+ *
+ * @param probe Stage measured
+ * @param duration Time spent, in EDID_INSTRUMENT_UNIT
+ */
+void edid_instrument_record(enum edid_probe probe, uint64_t duration)
+{
+    struct edid_instrument_thread *local = instrument_local;
+
+    if (!local)
+    {
+        local = claim_thread();
+        if (!local)
+        {
+            return;
+        }
+        instrument_local = local;
+    }
+
+    struct edid_probe_stats *stats = &local->probes[probe];
+    unsigned int bucket = 0;
+
+    while (bucket < EDID_INSTRUMENT_BUCKETS - 1 && (duration >> bucket) != 0)
+    {
+        bucket++;
+    }
+    if (stats->calls == 0 || duration < stats->min)
+    {
+        stats->min = duration;
+    }
+    if (duration > stats->max)
+    {
+        stats->max = duration;
+    }
+    stats->calls++;
+    stats->total += duration;
+    stats->histogram[bucket]++;
+}
+
+/**
+ * Sums the counters of every thread that recorded anything. The counters are
+ * not synchronised, so call this once the instrumented threads are joined or
+ * otherwise idle.
+ *
+ * @param totals Receives the sums, one entry per probe
+ * @return Number of threads summed
+ */
+unsigned int edid_instrument_collect(struct edid_probe_stats totals[EDID_PROBE_COUNT])
+{
+    unsigned int threads = 0;
+
+    memset(totals, 0, EDID_PROBE_COUNT * sizeof(totals[0]));
+    for (struct edid_instrument_thread *t = atomic_load_explicit(&instrument_threads, memory_order_acquire); t;
+         t = t->next)
+    {
+        for (int p = 0; p < EDID_PROBE_COUNT; p++)
+        {
+            const struct edid_probe_stats *stats = &t->probes[p];
+            struct edid_probe_stats *sum = &totals[p];
+
+            if (stats->calls == 0)
+            {
+                continue;
+            }
+            if (sum->calls == 0 || stats->min < sum->min)
+            {
+                sum->min = stats->min;
+            }
+            if (stats->max > sum->max)
+            {
+                sum->max = stats->max;
+            }
+            sum->calls += stats->calls;
+            sum->total += stats->total;
+            for (int b = 0; b < EDID_INSTRUMENT_BUCKETS; b++)
+            {
+                sum->histogram[b] += stats->histogram[b];
+            }
+        }
+        threads += t->threads;
+    }
+    return threads;
+}
+
+/**
+ * Clears the counters of every thread. Same restriction as
+ * edid_instrument_collect().
+ */
+void edid_instrument_reset(void)
+{
+    for (struct edid_instrument_thread *t = atomic_load_explicit(&instrument_threads, memory_order_acquire); t;
+         t = t->next)
+    {
+        memset(t->probes, 0, sizeof(t->probes));
+        t->threads = atomic_load_explicit(&t->owned, memory_order_relaxed);
+    }
+}
+
+static void put_u64(struct edid_sink *sink, uint64_t value)
+{
+    char digits[20];
+    int count = 0;
+
+    do
+    {
+        digits[count++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value);
+    while (count > 0)
+    {
+        edid_sink_putc(sink, digits[--count]);
+    }
+}
+
+/**
+ * Pads the text written since start with spaces to width columns.
+ */
+static void pad_from(struct edid_sink *sink, size_t start, size_t width)
+{
+    for (size_t written = sink->length - start; written < width; written++)
+    {
+        edid_sink_putc(sink, ' ');
+    }
+}
+
+/**
+ * Writes text right-aligned in a column of width characters.
+ */
+static void put_right(struct edid_sink *sink, const char *text, size_t width)
+{
+    for (size_t len = strlen(text); len < width; len++)
+    {
+        edid_sink_putc(sink, ' ');
+    }
+    edid_sink_puts(sink, text);
+}
+
+static void put_right_u64(struct edid_sink *sink, uint64_t value, size_t width)
+{
+    char text[24];
+    struct edid_sink digits;
+
+    edid_sink_init(&digits, text, sizeof(text));
+    put_u64(&digits, value);
+    text[digits.length] = '\0';
+    put_right(sink, text, width);
+}
+
+/**
+ * Upper bound of the bucket holding the given fraction of the calls, which
+ * is as close as the log2 histogram gets to that percentile.
+ */
+static uint64_t histogram_percentile(const struct edid_probe_stats *stats, uint64_t numerator, uint64_t denominator)
+{
+    uint64_t target = (stats->calls * numerator + denominator - 1) / denominator;
+    uint64_t seen = 0;
+
+    for (int b = 0; b < EDID_INSTRUMENT_BUCKETS; b++)
+    {
+        seen += stats->histogram[b];
+        if (seen >= target)
+        {
+            return b == 0 ? 0 : (b == EDID_INSTRUMENT_BUCKETS - 1 ? stats->max : ((uint64_t)1 << b) - 1);
+        }
+    }
+    return stats->max;
+}
+
+/**
+ * Writes the summed counters: one line per probe with its call count, mean,
+ * min, max and approximate median and 99th percentile, then the duration
+ * histogram of each probe. Probes that never ran are left out.
+ *
+ * @param sink Output sink receiving the report
+ */
+void edid_instrument_report(struct edid_sink *sink)
+{
+    static struct edid_probe_stats totals[EDID_PROBE_COUNT];
+    static const char *const columns[] = {"calls", "mean", "min", "max", "p50<=", "p99<="};
+    unsigned int threads = edid_instrument_collect(totals);
+
+    EDID_SINK_LITERAL(sink, "Stage timings in " EDID_INSTRUMENT_UNIT ", ");
+    edid_sink_putu(sink, threads);
+    edid_sink_puts(sink, threads == 1 ? " thread" : " threads");
+#if !EDID_INSTRUMENT
+    EDID_SINK_LITERAL(sink, " (instrumentation compiled out, build with -DEDID_INSTRUMENT=1)");
+#endif
+    EDID_SINK_LITERAL(sink, ":\n");
+    size_t start = sink->length;
+    EDID_SINK_LITERAL(sink, "  stage");
+    pad_from(sink, start, 34);
+    for (int c = 0; c < 6; c++)
+    {
+        put_right(sink, columns[c], 12);
+    }
+    edid_sink_putc(sink, '\n');
+
+    for (int p = 0; p < EDID_PROBE_COUNT; p++)
+    {
+        const struct edid_probe_stats *stats = &totals[p];
+        uint64_t values[6];
+
+        if (stats->calls == 0)
+        {
+            continue;
+        }
+        values[0] = stats->calls;
+        values[1] = stats->total / stats->calls;
+        values[2] = stats->min;
+        values[3] = stats->max;
+        values[4] = histogram_percentile(stats, 50, 100);
+        values[5] = histogram_percentile(stats, 99, 100);
+
+        start = sink->length;
+        EDID_SINK_LITERAL(sink, "  ");
+        edid_sink_puts(sink, probe_names[p]);
+        pad_from(sink, start, 34);
+        for (int c = 0; c < 6; c++)
+        {
+            put_right_u64(sink, values[c], 12);
+        }
+        edid_sink_putc(sink, '\n');
+    }
+
+    EDID_SINK_LITERAL(sink, "Duration histograms, calls per range of " EDID_INSTRUMENT_UNIT ":\n");
+    for (int p = 0; p < EDID_PROBE_COUNT; p++)
+    {
+        const struct edid_probe_stats *stats = &totals[p];
+        uint64_t peak = 0;
+
+        if (stats->calls == 0)
+        {
+            continue;
+        }
+        for (int b = 0; b < EDID_INSTRUMENT_BUCKETS; b++)
+        {
+            peak = stats->histogram[b] > peak ? stats->histogram[b] : peak;
+        }
+
+        EDID_SINK_LITERAL(sink, "  ");
+        edid_sink_puts(sink, probe_names[p] + strspn(probe_names[p], " "));
+        edid_sink_putc(sink, '\n');
+        for (int b = 0; b < EDID_INSTRUMENT_BUCKETS; b++)
+        {
+            if (stats->histogram[b] == 0)
+            {
+                continue;
+            }
+            start = sink->length;
+            EDID_SINK_LITERAL(sink, "    ");
+            if (b == 0)
+            {
+                EDID_SINK_LITERAL(sink, "0");
+            }
+            else
+            {
+                put_u64(sink, (uint64_t)1 << (b - 1));
+                edid_sink_putc(sink, b == EDID_INSTRUMENT_BUCKETS - 1 ? '+' : '-');
+                if (b < EDID_INSTRUMENT_BUCKETS - 1)
+                {
+                    put_u64(sink, ((uint64_t)1 << b) - 1);
+                }
+            }
+            pad_from(sink, start, 26);
+            put_right_u64(sink, stats->histogram[b], 12);
+            edid_sink_putc(sink, ' ');
+            for (uint64_t bar = 0; bar < (stats->histogram[b] * 40 + peak - 1) / peak; bar++)
+            {
+                edid_sink_putc(sink, '#');
+            }
+            edid_sink_putc(sink, '\n');
+        }
+    }
+}
@@ -0,0 +1,119 @@
+#ifndef EDID_INSTRUMENT_H
+#define EDID_INSTRUMENT_H
+
+#include <stdint.h>
+#include "parser.h"
+
+/*
+ * Optional hot-path instrumentation. Compiled out unless the build adds
+ * -DEDID_INSTRUMENT=1 to the gcc line. When enabled, every EDID_PROBE records
+ * its duration and call count in counters private to the calling thread, so
+ * probes take no locks.
+ *
+ * Durations are in the units of edid_instrument_clock(): TSC cycles on x86,
+ * nanoseconds elsewhere, or whatever EDID_INSTRUMENT_CLOCK() returns if the
+ * build supplies it (e.g. alt_timestamp() on a Nios II with a timestamp timer).
+ */
+
+#ifndef EDID_INSTRUMENT
+#define EDID_INSTRUMENT 0
+#endif
+
+#define EDID_INSTRUMENT_BUCKETS 32   // log2 duration histogram, bucket b holds [2^(b-1), 2^b)
+
+enum edid_probe
+{
+    EDID_PROBE_HEX,                  // hex text to bytes
+    EDID_PROBE_HEADER,
+    EDID_PROBE_CHECKSUM,
+    EDID_PROBE_DECODE_MANUFACTURER_ID,
+    EDID_PROBE_DECODE_PRODUCT_CODE,
+    EDID_PROBE_DECODE_SERIAL_NUMBER,
+    EDID_PROBE_DECODE_MANUFACTURE_DATE,
+    EDID_PROBE_DECODE_EDID_VERSION,
+    EDID_PROBE_DECODE_VIDEO_INPUT,
+    EDID_PROBE_DECODE_SCREEN_SIZE,
+    EDID_PROBE_DECODE_DISPLAY_GAMMA,
+    EDID_PROBE_DECODE_SUPPORTED_FEATURES,
+    EDID_PROBE_DECODE_COLOUR_CHARACTERISTICS,
+    EDID_PROBE_DECODE_ESTABLISHED_TIMINGS,
+    EDID_PROBE_DECODE_STANDARD_TIMINGS,
+    EDID_PROBE_DECODE_DESCRIPTORS,
+    EDID_PROBE_EXTENSIONS,           // decoding the extension blocks
+    EDID_PROBE_OUTPUT,               // all formatting, enclosing the FORMAT probes below
+    EDID_PROBE_FORMAT_MANUFACTURER_ID,
+    EDID_PROBE_FORMAT_PRODUCT_CODE,
+    EDID_PROBE_FORMAT_SERIAL_NUMBER,
+    EDID_PROBE_FORMAT_MANUFACTURE_DATE,
+    EDID_PROBE_FORMAT_EDID_VERSION,
+    EDID_PROBE_FORMAT_VIDEO_INPUT,
+    EDID_PROBE_FORMAT_SCREEN_SIZE,
+    EDID_PROBE_FORMAT_DISPLAY_GAMMA,
+    EDID_PROBE_FORMAT_SUPPORTED_FEATURES,
+    EDID_PROBE_FORMAT_COLOUR_CHARACTERISTICS,
+    EDID_PROBE_FORMAT_ESTABLISHED_TIMINGS,
+    EDID_PROBE_FORMAT_STANDARD_TIMINGS,
+    EDID_PROBE_FORMAT_DESCRIPTORS,
+    EDID_PROBE_FORMAT_EXTENSIONS,
+    EDID_PROBE_COUNT
+};
+
+/**
+ * Counters of one probe, per thread or summed over threads.
+ */
+struct edid_probe_stats
+{
+    uint64_t calls;
+    uint64_t total;
+    uint64_t min;
+    uint64_t max;
+    uint64_t histogram[EDID_INSTRUMENT_BUCKETS];
+};
+
+#if defined(EDID_INSTRUMENT_CLOCK)
+#define EDID_INSTRUMENT_UNIT "ticks"
+static inline uint64_t edid_instrument_clock(void)
+{
+    return (uint64_t)EDID_INSTRUMENT_CLOCK();
+}
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define EDID_INSTRUMENT_UNIT "cycles"
+static inline uint64_t edid_instrument_clock(void)
+{
+    return __rdtsc();
+}
+#else
+#include <time.h>
+#define EDID_INSTRUMENT_UNIT "ns"
+static inline uint64_t edid_instrument_clock(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+#endif
+
+#if EDID_INSTRUMENT
+#define EDID_PROBE(probe, statement)                                                \
+    do                                                                              \
+    {                                                                               \
+        uint64_t edid_probe_start = edid_instrument_clock();                        \
+        statement;                                                                  \
+        edid_instrument_record((probe), edid_instrument_clock() - edid_probe_start); \
+    } while (0)
+#else
+#define EDID_PROBE(probe, statement) \
+    do                               \
+    {                                \
+        statement;                   \
+    } while (0)
+#endif
+
+void edid_instrument_record(enum edid_probe probe, uint64_t duration);
+unsigned int edid_instrument_collect(struct edid_probe_stats totals[EDID_PROBE_COUNT]);
+void edid_instrument_reset(void);
+const char *edid_instrument_probe_name(enum edid_probe probe);
+void edid_instrument_report(struct edid_sink *sink);
+
+#endif
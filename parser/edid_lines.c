@@ -0,0 +1,192 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#ifdef _WIN32
+#include <io.h>
+#define read _read
+#else
+#include <unistd.h>
+#endif
+#include "parser.h"
+#include "edid_lines.h"
+#include "edid_instrument.h"
+/**
+ * Streaming reader for hex EDIDs arriving line by line on a file descriptor
+ */
+
+#define LINES_MAX_EDID (EDID_LENGTH * 256)
+
+struct lines_state
+{
+    unsigned char *line;        // the current line, decoded
+    unsigned char *edid;        // EDID being collected from a multi-line dump
+    size_t pending;             // bytes of edid collected so far
+    edid_lines_handler handler;
+    void *context;
+};
+
+/**
+ * Hands over length bytes of data, zero padded to whole blocks like
+ * parse_edid_string() does.
+ */
+static int emit_edid(struct lines_state *state, unsigned char *data, size_t length)
+{
+    size_t padded = (length + EDID_LENGTH - 1) / EDID_LENGTH * EDID_LENGTH;
+
+    memset(data + length, 0, padded - length);
+    return state->handler(data, padded, state->context);
+}
+
+static int flush_edid(struct lines_state *state)
+{
+    size_t pending = state->pending;
+
+    state->pending = 0;
+    return pending ? emit_edid(state, state->edid, pending) : 0;
+}
+
+/**
+ * Adds one line of input. A line holding at least a whole block is one EDID
+ * by itself. Shorter hex lines, as in edid-decode and xrandr --verbose dumps,
+ * are collected until the EDID holds the 1 + byte 126 blocks it announces.
+ * Blank lines are skipped, so blocks of one dump may be blank-line separated;
+ * a line starting with the EDID header begins a new EDID, and a line that is
+ * not all hex (such as "EDID:") ends the current one early.
+ */
+static int add_line(struct lines_state *state, const char *line, size_t length)
+{
+    size_t error_pos, count;
+
+    EDID_PROBE(EDID_PROBE_HEX, count = edid_hex_decode(line, length, state->line, LINES_MAX_EDID, &error_pos));
+
+    if (error_pos != EDID_HEX_NO_ERROR)
+    {
+        return flush_edid(state);
+    }
+    if (count == 0)
+    {
+        return 0;
+    }
+    if (count >= EDID_LENGTH)
+    {
+        return flush_edid(state) || emit_edid(state, state->line, count);
+    }
+    if (count >= 8 && edid_header_valid(state->line) && flush_edid(state))
+    {
+        return 1;
+    }
+
+    if (count > LINES_MAX_EDID - state->pending)
+    {
+        count = LINES_MAX_EDID - state->pending;
+    }
+    memcpy(state->edid + state->pending, state->line, count);
+    state->pending += count;
+
+    if (state->pending >= EDID_LENGTH &&
+        (state->pending >= (1 + (size_t)state->edid[126]) * EDID_LENGTH || state->pending == LINES_MAX_EDID))
+    {
+        return flush_edid(state);
+    }
+    return 0;
+}
+
+/**
+ * Reads hex EDIDs from fd until end of input. Memory use is fixed: one read
+ * buffer and two EDID buffers, allocated once per call. Lines longer than the
+ * read buffer are skipped.
+ *
+ * @param fd File descriptor to read, e.g. 0 for stdin
+ * @param handler Called with each EDID as it completes
+ * @param context Passed through to handler
+ * @return 1 at end of input or when the handler stops, 0 on a read or allocation failure
+ */
+int edid_read_hex_lines(int fd, edid_lines_handler handler, void *context)
+{
+    struct lines_state state;
+    char *buffer = malloc(EDID_LINES_BUFFER);
+    size_t used = 0;
+    int skipping = 0;           // inside a line that did not fit the buffer
+    int ok = 1;
+
+    state.line = malloc(LINES_MAX_EDID);
+    state.edid = malloc(LINES_MAX_EDID);
+    state.pending = 0;
+    state.handler = handler;
+    state.context = context;
+    if (!buffer || !state.line || !state.edid)
+    {
+        free(buffer);
+        free(state.line);
+        free(state.edid);
+        return 0;
+    }
+
+    for (;;)
+    {
+        if (handler(NULL, 0, context))
+        {
+            break;
+        }
+
+        long got = (long)read(fd, buffer + used, (unsigned int)(EDID_LINES_BUFFER - used));
+        if (got < 0 && errno == EINTR)
+        {
+            // A signal interrupted the read before any data arrived
+            continue;
+        }
+        if (got < 0)
+        {
+            ok = 0;
+            break;
+        }
+        if (got == 0)
+        {
+            // A last line without a newline still counts
+            if (skipping || !used || !add_line(&state, buffer, used))
+            {
+                flush_edid(&state);
+            }
+            break;
+        }
+        used += (size_t)got;
+
+        size_t start = 0;
+        const char *newline;
+        int stop = 0;
+        while (!stop && (newline = memchr(buffer + start, '\n', used - start)) != NULL)
+        {
+            size_t end = (size_t)(newline - buffer);
+
+            if (!skipping)
+            {
+                stop = add_line(&state, buffer + start, end - start);
+            }
+            skipping = 0;
+            start = end + 1;
+        }
+        if (stop)
+        {
+            break;
+        }
+
+        // Keep the unfinished line; if it fills the whole buffer, drop it
+        memmove(buffer, buffer + start, used - start);
+        used -= start;
+        if (used == EDID_LINES_BUFFER)
+        {
+            used = 0;
+            skipping = 1;
+            if (flush_edid(&state))
+            {
+                break;
+            }
+        }
+    }
+
+    free(buffer);
+    free(state.line);
+    free(state.edid);
+    return ok;
+}
@@ -0,0 +1,17 @@
+#ifndef EDID_LINES_H
+#define EDID_LINES_H
+
+#include <stddef.h>
+
+#define EDID_LINES_BUFFER (1 << 20) // read buffer, also the longest line accepted
+
+/**
+ * Called with each complete EDID found in the input, and with edid NULL when
+ * the reader has used up its buffer and is about to wait for more input,
+ * which is the time to flush any output. Return non-zero to stop reading.
+ */
+typedef int (*edid_lines_handler)(const unsigned char *edid, size_t length, void *context);
+
+int edid_read_hex_lines(int fd, edid_lines_handler handler, void *context);
+
+#endif
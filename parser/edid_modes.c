@@ -0,0 +1,310 @@
+#include <string.h>
+#include <stdint.h>
+#include "parser.h"
+/**
+ * Supported mode sets: every advertised timing merged into one sorted set
+ */
+
+_Static_assert(17 + EDID_STANDARD_TIMING_COUNT + EDID_DESCRIPTOR_COUNT + EDID_CTA_MAX_VICS + EDID_CTA_MAX_TIMINGS +
+                       EDID_DISPLAYID_MAX_TIMINGS + EDID_DISPLAYID_MAX_CODES <= EDID_MODE_SET_MAX,
+               "a mode set must hold every timing an EDID can advertise");
+
+/**
+ * Modes of the established timing bits, index 0 being bit 15, followed by
+ * the one manufacturer timing bit with a defined mode (byte 37 bit 7).
+ */
+static const struct edid_mode established_modes[17] = {
+    {720, 400, 70, 0, 0},   {720, 400, 88, 0, 0},   {640, 480, 60, 0, 0},   {640, 480, 67, 0, 0},
+    {640, 480, 72, 0, 0},   {640, 480, 75, 0, 0},   {800, 600, 56, 0, 0},   {800, 600, 60, 0, 0},
+    {800, 600, 72, 0, 0},   {800, 600, 75, 0, 0},   {832, 624, 75, 0, 0},   {1024, 768, 87, 1, 0},
+    {1024, 768, 60, 0, 0},  {1024, 768, 70, 0, 0},  {1024, 768, 75, 0, 0},  {1280, 1024, 75, 0, 0},
+    {1152, 870, 75, 0, 0},
+};
+
+/**
+ * Packs a mode into a key that orders modes by width, height, refresh and
+ * then progressive before interlaced.
+ */
+uint64_t edid_mode_key(uint16_t width, uint16_t height, uint16_t refresh, int interlaced)
+{
+    return ((uint64_t)width << 48) | ((uint64_t)height << 32) | ((uint64_t)refresh << 1) | (interlaced ? 1u : 0u);
+}
+
+static void add_mode(struct edid_mode_set *set, uint16_t width, uint16_t height, uint16_t refresh, int interlaced,
+                     uint8_t sources)
+{
+    if (width == 0 || height == 0 || set->count == EDID_MODE_SET_MAX)
+    {
+        return;
+    }
+    set->keys[set->count] = edid_mode_key(width, height, refresh, interlaced);
+    set->sources[set->count] = sources;
+    set->count++;
+}
+
+static void add_detailed(struct edid_mode_set *set, const struct edid_detailed_timing *timing, uint8_t sources)
+{
+    int interlaced = (timing->flags & 0x80) != 0;
+    uint32_t height = interlaced ? timing->vertical_active * 2u : timing->vertical_active;
+    uint32_t refresh = (timing->refresh_mhz + 500) / 1000;
+
+    add_mode(set, timing->horizontal_active, (uint16_t)height, (uint16_t)(refresh < 0xFFFF ? refresh : 0xFFFF),
+             interlaced, sources);
+}
+
+static void add_vic(struct edid_mode_set *set, uint8_t vic, uint8_t sources)
+{
+    const struct edid_cta_vic *format = edid_cta_vic_lookup(vic);
+
+    if (format)
+    {
+        add_mode(set, format->width, format->height, format->refresh, format->interlaced, sources);
+    }
+}
+
+/**
+ * Sorts the collected modes and merges duplicates, combining their sources.
+ * A set holds at most a couple of hundred modes, so insertion sort is enough.
+ */
+static void sort_and_merge(struct edid_mode_set *set)
+{
+    for (uint16_t i = 1; i < set->count; i++)
+    {
+        uint64_t key = set->keys[i];
+        uint8_t sources = set->sources[i];
+        int j = i - 1;
+
+        while (j >= 0 && set->keys[j] > key)
+        {
+            set->keys[j + 1] = set->keys[j];
+            set->sources[j + 1] = set->sources[j];
+            j--;
+        }
+        set->keys[j + 1] = key;
+        set->sources[j + 1] = sources;
+    }
+
+    uint16_t count = 0;
+    for (uint16_t i = 0; i < set->count; i++)
+    {
+        if (count > 0 && set->keys[count - 1] == set->keys[i])
+        {
+            set->sources[count - 1] |= set->sources[i];
+        }
+        else
+        {
+            set->keys[count] = set->keys[i];
+            set->sources[count] = set->sources[i];
+            count++;
+        }
+    }
+    set->count = count;
+}
+
+/**
+ * Collects every mode a decoded EDID advertises: established and standard
+ * timings, detailed timings, CTA-861 VICs and detailed timings, and DisplayID
+ * timings and VIC timing codes.
+ *
+ * @param info Decoded base block
+ * @param ext Decoded extension blocks, or NULL
+ * @param set Set to fill
+ */
+void edid_mode_set_build(const struct edid_info *info, const struct edid_ext_info *ext, struct edid_mode_set *set)
+{
+    set->count = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        if (info->established_timings & (0x8000u >> i))
+        {
+            const struct edid_mode *mode = &established_modes[i];
+            add_mode(set, mode->width, mode->height, mode->refresh, mode->interlaced, EDID_MODE_ESTABLISHED);
+        }
+    }
+    if (info->manufacturer_timings & 0x80)
+    {
+        const struct edid_mode *mode = &established_modes[16];
+        add_mode(set, mode->width, mode->height, mode->refresh, mode->interlaced, EDID_MODE_ESTABLISHED);
+    }
+
+    for (int i = 0; i < info->standard_timing_count; i++)
+    {
+        const struct edid_standard_timing *t = &info->standard_timings[i];
+        add_mode(set, t->horizontal_resolution, t->vertical_resolution, t->vertical_frequency, 0, EDID_MODE_STANDARD);
+    }
+
+    for (int i = 0; i < info->detailed_timing_count; i++)
+    {
+        add_detailed(set, &info->detailed_timings[i], i == 0 ? EDID_MODE_DETAILED | EDID_MODE_PREFERRED : EDID_MODE_DETAILED);
+    }
+
+    if (ext)
+    {
+        const struct edid_cta_info *cta = &ext->cta;
+        const struct edid_displayid_info *displayid = &ext->displayid;
+
+        for (int i = 0; i < cta->vic_count; i++)
+        {
+            add_vic(set, cta->vics[i], (cta->native_vics >> i) & 1 ? EDID_MODE_CTA_VIC | EDID_MODE_PREFERRED : EDID_MODE_CTA_VIC);
+        }
+        for (int i = 0; i < cta->detailed_timing_count; i++)
+        {
+            add_detailed(set, &cta->detailed_timings[i], EDID_MODE_CTA_DETAILED);
+        }
+        for (int i = 0; i < displayid->detailed_timing_count; i++)
+        {
+            add_detailed(set, &displayid->detailed_timings[i],
+                         i == displayid->preferred_timing ? EDID_MODE_DISPLAYID | EDID_MODE_PREFERRED : EDID_MODE_DISPLAYID);
+        }
+        for (int i = 0; i < displayid->timing_code_count; i++)
+        {
+            // DMT and HDMI VIC codes need tables this decoder does not carry
+            if (displayid->timing_code_types[i] == EDID_DISPLAYID_CODE_VIC && displayid->timing_codes[i] <= 0xFF)
+            {
+                add_vic(set, (uint8_t)displayid->timing_codes[i], EDID_MODE_DISPLAYID);
+            }
+        }
+    }
+
+    sort_and_merge(set);
+}
+
+/**
+ * Unpacks mode index of a set.
+ */
+void edid_mode_set_get(const struct edid_mode_set *set, size_t index, struct edid_mode *mode)
+{
+    uint64_t key = set->keys[index];
+
+    mode->width = (uint16_t)(key >> 48);
+    mode->height = (uint16_t)(key >> 32);
+    mode->refresh = (uint16_t)(key >> 1);
+    mode->interlaced = (uint8_t)(key & 1);
+    mode->sources = set->sources[index];
+}
+
+/**
+ * Binary search for a mode key.
+ *
+ * @param set Set from edid_mode_set_build()
+ * @param key Key from edid_mode_key()
+ * @return Index of the mode, or -1 if the set does not hold it
+ */
+int edid_mode_set_find(const struct edid_mode_set *set, uint64_t key)
+{
+    int low = 0;
+    int high = (int)set->count - 1;
+
+    while (low <= high)
+    {
+        int mid = (low + high) / 2;
+
+        if (set->keys[mid] == key)
+        {
+            return mid;
+        }
+        if (set->keys[mid] < key)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid - 1;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Reports whether a sink supports a mode, e.g. 1920x1080 at 60 Hz progressive.
+ *
+ * @return 1 if the set holds the mode, 0 otherwise
+ */
+int edid_mode_set_contains(const struct edid_mode_set *set, uint16_t width, uint16_t height, uint16_t refresh, int interlaced)
+{
+    return edid_mode_set_find(set, edid_mode_key(width, height, refresh, interlaced)) >= 0;
+}
+
+/**
+ * Computes the modes every one of several sinks supports. The sets are
+ * merged pairwise in linear time, so N sets of n modes cost O(N * n).
+ * Sources in the result combine those of all sets.
+ *
+ * @param sets Sets from edid_mode_set_build()
+ * @param count Number of sets; with 0 the result is empty
+ * @param out Set receiving the common modes; may not be one of sets
+ * @return Number of common modes
+ */
+size_t edid_mode_set_intersect(const struct edid_mode_set *const *sets, size_t count, struct edid_mode_set *out)
+{
+    out->count = 0;
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    memcpy(out->keys, sets[0]->keys, sets[0]->count * sizeof(out->keys[0]));
+    memcpy(out->sources, sets[0]->sources, sets[0]->count);
+    out->count = sets[0]->count;
+
+    for (size_t s = 1; s < count && out->count > 0; s++)
+    {
+        const struct edid_mode_set *other = sets[s];
+        uint16_t i = 0, j = 0, kept = 0;
+
+        while (i < out->count && j < other->count)
+        {
+            if (out->keys[i] < other->keys[j])
+            {
+                i++;
+            }
+            else if (out->keys[i] > other->keys[j])
+            {
+                j++;
+            }
+            else
+            {
+                out->keys[kept] = out->keys[i];
+                out->sources[kept] = out->sources[i] | other->sources[j];
+                kept++;
+                i++;
+                j++;
+            }
+        }
+        out->count = kept;
+    }
+    return out->count;
+}
+
+/**
+ * Picks the best mode of a set: the most pixels, then the highest refresh,
+ * progressive before interlaced.
+ *
+ * @param set Set, e.g. the result of edid_mode_set_intersect()
+ * @param mode Receives the best mode
+ * @return 1 if the set has a mode, 0 if it is empty
+ */
+int edid_mode_set_best(const struct edid_mode_set *set, struct edid_mode *mode)
+{
+    uint32_t best_pixels = 0;
+    int best = -1;
+
+    for (int i = 0; i < set->count; i++)
+    {
+        struct edid_mode candidate;
+
+        edid_mode_set_get(set, (size_t)i, &candidate);
+        uint32_t pixels = (uint32_t)candidate.width * candidate.height;
+
+        if (best < 0 || pixels > best_pixels ||
+            (pixels == best_pixels && (candidate.refresh > mode->refresh ||
+                                       (candidate.refresh == mode->refresh && candidate.interlaced < mode->interlaced))))
+        {
+            *mode = candidate;
+            best_pixels = pixels;
+            best = i;
+        }
+    }
+    return best >= 0;
+}
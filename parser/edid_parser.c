@@ -1,16 +1,18 @@
 #include <stdio.h>
 #include <io.h>
 #include <fcntl.h>
+#include <stddef.h>
 #include <string.h>
 #include <stdint.h>
 #include <ctype.h>
 #include "parser.h"
+#include "edid_regs.h"
+#include "edid_timing_tables.h"
+#include "edid_instrument.h"
 /**
  * This function is an EDID parser that can take an input of the raw EDID data
  */
 
-#define EDID_LENGTH 128
-
 #define DEBUG_PRINT_ENABLED 0
 #if DEBUG_PRINT_ENABLED
 #define DGB_PRINTF printf
@@ -18,7 +20,7 @@
 #define DGB_PRINTF(...) ((void)0)
 #endif
 
-#define DEBUG_PRINT_ALL_ENABLED 1
+#define DEBUG_PRINT_ALL_ENABLED 0
 #if DEBUG_PRINT_ALL_ENABLED
 #define DGB_PRINTF_ALL printf
 #else
@@ -42,54 +44,385 @@ void write_to_file_once(const char *filename, const char *data) {
 #endif
 }
 
-char edid_output[1500];
-
+// Per-section decoders and formatters behind parse_edid_struct() and format_edid_info()
+static void decode_manufacturer_id(const unsigned char *edid, struct edid_info *info);
+static void decode_product_code(const unsigned char *edid, struct edid_info *info);
+static void decode_serial_number(const unsigned char *edid, struct edid_info *info);
+static void decode_manufacture_date(const unsigned char *edid, struct edid_info *info);
+static void decode_edid_version(const unsigned char *edid, struct edid_info *info);
+static void decode_video_input(const unsigned char *edid, struct edid_info *info);
+static void decode_screen_size(const unsigned char *edid, struct edid_info *info);
+static void decode_display_gamma(const unsigned char *edid, struct edid_info *info);
+static void decode_supported_features(const unsigned char *edid, struct edid_info *info);
+static void decode_colour_characteristics(const unsigned char *edid, struct edid_info *info);
+static void decode_established_timings(const unsigned char *edid, struct edid_info *info);
+static void decode_standard_timings(const unsigned char *edid, struct edid_info *info);
+static void decode_descriptors(const unsigned char *edid, struct edid_info *info);
+static void format_manufacturer_id(const struct edid_info *info, struct edid_sink *sink);
+static void format_product_code(const struct edid_info *info, struct edid_sink *sink);
+static void format_serial_number(const struct edid_info *info, struct edid_sink *sink);
+static void format_manufacture_date(const struct edid_info *info, struct edid_sink *sink);
+static void format_edid_version(const struct edid_info *info, struct edid_sink *sink);
+static void format_video_input(const struct edid_info *info, struct edid_sink *sink);
+static void format_screen_size(const struct edid_info *info, struct edid_sink *sink);
+static void format_display_gamma(const struct edid_info *info, struct edid_sink *sink);
+static void format_supported_features(const struct edid_info *info, struct edid_sink *sink);
+static void format_colour_characteristics(const struct edid_info *info, struct edid_sink *sink);
+static void format_established_timings(const struct edid_info *info, struct edid_sink *sink);
+static void format_standard_timings(const struct edid_info *info, struct edid_sink *sink);
+static void format_descriptors(const struct edid_info *info, struct edid_sink *sink);
+
+static void decode_edid_fields(const unsigned char *edid, struct edid_info *info)
+{
+    EDID_PROBE(EDID_PROBE_DECODE_MANUFACTURER_ID, decode_manufacturer_id(edid, info));
+    EDID_PROBE(EDID_PROBE_DECODE_PRODUCT_CODE, decode_product_code(edid, info));
+    EDID_PROBE(EDID_PROBE_DECODE_SERIAL_NUMBER, decode_serial_number(edid, info));
+    EDID_PROBE(EDID_PROBE_DECODE_MANUFACTURE_DATE, decode_manufacture_date(edid, info));
+    EDID_PROBE(EDID_PROBE_DECODE_EDID_VERSION, decode_edid_version(edid, info));
+    EDID_PROBE(EDID_PROBE_DECODE_VIDEO_INPUT, decode_video_input(edid, info));
+    EDID_PROBE(EDID_PROBE_DECODE_SCREEN_SIZE, decode_screen_size(edid, info));
+    EDID_PROBE(EDID_PROBE_DECODE_DISPLAY_GAMMA, decode_display_gamma(edid, info));
+    EDID_PROBE(EDID_PROBE_DECODE_SUPPORTED_FEATURES, decode_supported_features(edid, info));
+    EDID_PROBE(EDID_PROBE_DECODE_COLOUR_CHARACTERISTICS, decode_colour_characteristics(edid, info));
+    EDID_PROBE(EDID_PROBE_DECODE_ESTABLISHED_TIMINGS, decode_established_timings(edid, info));
+    EDID_PROBE(EDID_PROBE_DECODE_STANDARD_TIMINGS, decode_standard_timings(edid, info));
+    EDID_PROBE(EDID_PROBE_DECODE_DESCRIPTORS, decode_descriptors(edid, info));
+}
 
 /**
- * Parses the EDID data
+ * Decodes the EDID base block into a structure without any string formatting.
  *
  * @param edid Pointer to the 128-byte EDID data array
+ * @param info Structure to fill with the decoded fields
+ * @return 1 if header is valid, 0 otherwise. Only the status is set when the header is invalid.
  */
-void parse_edid_array(const unsigned char *edid, char *output){
-    int offset = 0;
-    
-    if (!check_header(edid))
+int parse_edid_struct(const unsigned char *edid, struct edid_info *info)
+{
+    int header_valid;
+
+    memset(info, 0, sizeof(*info));
+
+    EDID_PROBE(EDID_PROBE_HEADER, header_valid = check_header(edid));
+    if (!header_valid)
     {
         DGB_PRINTF("Invalid EDID header.\n");
-        
-        int written = sprintf(output + offset, "Invalid EDID header\n");
-        offset += written;
+        info->status = EDID_STATUS_BAD_HEADER | (verify_edid_checksum(edid) ? 0 : EDID_STATUS_BAD_CHECKSUM);
+        return 0;
+    }
+    info->header_valid = 1;
+
+    decode_edid_fields(edid, info);
+    EDID_PROBE(EDID_PROBE_CHECKSUM, info->checksum_valid = (uint8_t)verify_edid_checksum(edid));
+    info->status = info->checksum_valid ? EDID_STATUS_OK : EDID_STATUS_BAD_CHECKSUM;
+
+    return 1;
+}
+
+#define EDID_BATCH_CHUNK 256
+
+/**
+ * Decodes a contiguous array of 128-byte base blocks. Headers and checksums
+ * are checked a chunk of blocks at a time before any field is decoded, and
+ * blocks with a bad header are left with only their status set.
+ *
+ * @param blocks Pointer to count blocks of EDID_LENGTH bytes each
+ * @param count Number of blocks
+ * @param out Array of count structures; out[i].status reports on block i
+ * @return Number of blocks with a valid header and checksum
+ */
+size_t parse_edid_batch(const uint8_t *blocks, size_t count, struct edid_info *out)
+{
+    uint8_t status[EDID_BATCH_CHUNK];
+    size_t valid = 0;
+
+    for (size_t base = 0; base < count; base += EDID_BATCH_CHUNK)
+    {
+        size_t chunk = count - base < EDID_BATCH_CHUNK ? count - base : EDID_BATCH_CHUNK;
+
+        edid_validate_blocks(blocks + base * EDID_LENGTH, chunk, status);
+
+        for (size_t i = 0; i < chunk; i++)
+        {
+            struct edid_info *info = &out[base + i];
+
+            memset(info, 0, sizeof(*info));
+            info->status = status[i];
+            if (status[i] & EDID_STATUS_BAD_HEADER)
+            {
+                continue;
+            }
+
+            info->header_valid = 1;
+            info->checksum_valid = (status[i] & EDID_STATUS_BAD_CHECKSUM) == 0;
+            decode_edid_fields(blocks + (base + i) * EDID_LENGTH, info);
+            valid += info->checksum_valid;
+        }
+    }
+    return valid;
+}
+
+static void decode_vendor_section(const unsigned char *edid, struct edid_info *info)
+{
+    decode_manufacturer_id(edid, info);
+    decode_product_code(edid, info);
+    decode_serial_number(edid, info);
+    decode_manufacture_date(edid, info);
+}
+
+static void decode_basic_section(const unsigned char *edid, struct edid_info *info)
+{
+    decode_video_input(edid, info);
+    decode_screen_size(edid, info);
+    decode_display_gamma(edid, info);
+    decode_supported_features(edid, info);
+}
+
+static void decode_timing_section(const unsigned char *edid, struct edid_info *info)
+{
+    decode_established_timings(edid, info);
+    decode_standard_timings(edid, info);
+}
+
+/**
+ * Base block sections: the bytes each one is decoded from and the run of
+ * struct edid_info fields it fills, which are laid out in section order.
+ */
+static const struct
+{
+    unsigned int mask;
+    uint8_t first;
+    uint8_t last;
+    size_t field_start;
+    size_t field_end;
+    void (*decode)(const unsigned char *edid, struct edid_info *info);
+} edid_sections[] = {
+    {EDID_SECTION_VENDOR, 8, 17, offsetof(struct edid_info, manufacturer_id), offsetof(struct edid_info, version),
+     decode_vendor_section},
+    {EDID_SECTION_VERSION, 18, 19, offsetof(struct edid_info, version), offsetof(struct edid_info, video_input),
+     decode_edid_version},
+    {EDID_SECTION_BASIC, 20, 24, offsetof(struct edid_info, video_input), offsetof(struct edid_info, chromaticity),
+     decode_basic_section},
+    {EDID_SECTION_CHROMATICITY, 25, 34, offsetof(struct edid_info, chromaticity),
+     offsetof(struct edid_info, established_timings), decode_colour_characteristics},
+    {EDID_SECTION_TIMINGS, 35, 53, offsetof(struct edid_info, established_timings),
+     offsetof(struct edid_info, descriptor_tags), decode_timing_section},
+    {EDID_SECTION_DESCRIPTORS, 54, 125, offsetof(struct edid_info, descriptor_tags), sizeof(struct edid_info),
+     decode_descriptors},
+};
+
+#define EDID_SECTION_COUNT (sizeof(edid_sections) / sizeof(edid_sections[0]))
+
+static unsigned int base_section_of(size_t offset)
+{
+    if (offset < 8)
+    {
+        return EDID_SECTION_HEADER;
+    }
+    if (offset == 126)
+    {
+        return EDID_SECTION_EXTENSIONS;
+    }
+    if (offset == 127)
+    {
+        return EDID_SECTION_CHECKSUM;
+    }
+    for (size_t i = 0; i < EDID_SECTION_COUNT; i++)
+    {
+        if (offset <= edid_sections[i].last)
+        {
+            return edid_sections[i].mask;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Maps the bytes that differ between two versions of an EDID to the sections
+ * that own them. Byte 126 and any extension block count as EDID_SECTION_EXTENSIONS.
+ *
+ * @param old_data Previous bytes, at least 128
+ * @param old_length Number of bytes in old_data
+ * @param data New bytes, at least 128
+ * @param length Number of bytes in data
+ * @return Mask of EDID_SECTION_* bits, 0 if the bytes are identical
+ */
+unsigned int edid_section_diff(const unsigned char *old_data, size_t old_length, const unsigned char *data, size_t length)
+{
+    unsigned int mask = 0;
+
+    for (size_t offset = 0; offset < EDID_LENGTH; offset += 8)
+    {
+        // Compare eight bytes at a time and only locate the bytes of a changed word
+        if (memcmp(old_data + offset, data + offset, 8) == 0)
+        {
+            continue;
+        }
+        for (size_t i = offset; i < offset + 8; i++)
+        {
+            if (old_data[i] != data[i])
+            {
+                mask |= base_section_of(i);
+            }
+        }
+    }
+
+    if (old_length != length || memcmp(old_data + EDID_LENGTH, data + EDID_LENGTH, length - EDID_LENGTH) != 0)
+    {
+        mask |= EDID_SECTION_EXTENSIONS;
+    }
+    return mask;
+}
+
+/**
+ * Brings a decoded result up to date after the EDID bytes changed, decoding
+ * only the sections whose bytes differ. The checksum is always checked again.
+ * A changed header, or a previous result without a valid header, falls back
+ * to a full decode. The result is identical to parse_edid_struct() and
+ * parse_edid_extensions() on the new bytes.
+ *
+ * @param old_data Bytes info and ext were decoded from, at least 128
+ * @param old_length Number of bytes in old_data
+ * @param data New bytes, at least 128
+ * @param length Number of bytes in data
+ * @param info Previous base block result, updated in place
+ * @param ext Previous extension result, updated in place, or NULL if not kept
+ * @return Mask of EDID_SECTION_* bits that were decoded again
+ */
+unsigned int edid_reparse(const unsigned char *old_data, size_t old_length, const unsigned char *data, size_t length,
+                          struct edid_info *info, struct edid_ext_info *ext)
+{
+    unsigned int changed = edid_section_diff(old_data, old_length, data, length);
+
+    if ((changed & EDID_SECTION_HEADER) || !info->header_valid)
+    {
+        parse_edid_struct(data, info);
+        if (ext)
+        {
+            parse_edid_extensions(data, length, ext);
+        }
+        return EDID_SECTION_ALL;
+    }
+
+    for (size_t i = 0; i < EDID_SECTION_COUNT; i++)
+    {
+        if (changed & edid_sections[i].mask)
+        {
+            // Clear the section first so it matches a decode into a zeroed structure
+            memset((char *)info + edid_sections[i].field_start, 0, edid_sections[i].field_end - edid_sections[i].field_start);
+            edid_sections[i].decode(data, info);
+        }
+    }
+
+    info->checksum_valid = (uint8_t)verify_edid_checksum(data);
+    info->status = info->checksum_valid ? EDID_STATUS_OK : EDID_STATUS_BAD_CHECKSUM;
+
+    if (ext && (changed & EDID_SECTION_EXTENSIONS))
+    {
+        parse_edid_extensions(data, length, ext);
+    }
+    return changed | EDID_SECTION_CHECKSUM;
+}
+
+/**
+ * Compares two decoded results section by section.
+ *
+ * @param a First base block result
+ * @param a_ext Extensions decoded with a, or NULL to skip comparing them
+ * @param b Second base block result
+ * @param b_ext Extensions decoded with b, or NULL to skip comparing them
+ * @return Mask of EDID_SECTION_* bits whose decoded fields differ
+ */
+unsigned int edid_info_diff(const struct edid_info *a, const struct edid_ext_info *a_ext, const struct edid_info *b,
+                            const struct edid_ext_info *b_ext)
+{
+    unsigned int mask = 0;
+
+    if (a->header_valid != b->header_valid)
+    {
+        mask |= EDID_SECTION_HEADER;
+    }
+    if (a->status != b->status || a->checksum_valid != b->checksum_valid)
+    {
+        mask |= EDID_SECTION_CHECKSUM;
+    }
+    for (size_t i = 0; i < EDID_SECTION_COUNT; i++)
+    {
+        size_t start = edid_sections[i].field_start;
+
+        if (memcmp((const char *)a + start, (const char *)b + start, edid_sections[i].field_end - start) != 0)
+        {
+            mask |= edid_sections[i].mask;
+        }
+    }
+    if (a_ext && b_ext && memcmp(a_ext, b_ext, sizeof(*a_ext)) != 0)
+    {
+        mask |= EDID_SECTION_EXTENSIONS;
+    }
+    return mask;
+}
+
+/**
+ * Formats a decoded EDID into the human-readable report
+ *
+ * @param info Decoded EDID from parse_edid_struct()
+ * @param sink Output sink receiving the text
+ */
+void format_edid_info(const struct edid_info *info, struct edid_sink *sink)
+{
+    if (!info->header_valid)
+    {
+        EDID_SINK_LITERAL(sink, "Invalid EDID header\n");
         return;
     }
 
     DGB_PRINTF("Valid EDID header.\n");
-    int written = sprintf(output + offset, "Valid EDID header\n");
-    offset += written;
-    
-    parse_manufacturer_id(edid, output, &offset);
-    parse_product_code(edid, output, &offset);
-    parse_serial_number(edid, output, &offset);
-    parse_manufacture_date(edid, output, &offset);
-    parse_edid_version(edid, output, &offset);
-    parse_video_input(edid, output, &offset);
-    parse_screen_size(edid, output, &offset);
-    parse_display_gamma(edid, output, &offset);
-    parse_supported_features(edid, output, &offset);
-    parse_colour_characteristics(edid, output, &offset);
-    parse_established_timings(edid, output, &offset);
-    parse_standard_timings(edid, output, &offset);
-
-    if (verify_edid_checksum(edid)) {
+    EDID_SINK_LITERAL(sink, "Valid EDID header\n");
+
+    EDID_PROBE(EDID_PROBE_FORMAT_MANUFACTURER_ID, format_manufacturer_id(info, sink));
+    EDID_PROBE(EDID_PROBE_FORMAT_PRODUCT_CODE, format_product_code(info, sink));
+    EDID_PROBE(EDID_PROBE_FORMAT_SERIAL_NUMBER, format_serial_number(info, sink));
+    EDID_PROBE(EDID_PROBE_FORMAT_MANUFACTURE_DATE, format_manufacture_date(info, sink));
+    EDID_PROBE(EDID_PROBE_FORMAT_EDID_VERSION, format_edid_version(info, sink));
+    EDID_PROBE(EDID_PROBE_FORMAT_VIDEO_INPUT, format_video_input(info, sink));
+    EDID_PROBE(EDID_PROBE_FORMAT_SCREEN_SIZE, format_screen_size(info, sink));
+    EDID_PROBE(EDID_PROBE_FORMAT_DISPLAY_GAMMA, format_display_gamma(info, sink));
+    EDID_PROBE(EDID_PROBE_FORMAT_SUPPORTED_FEATURES, format_supported_features(info, sink));
+    EDID_PROBE(EDID_PROBE_FORMAT_COLOUR_CHARACTERISTICS, format_colour_characteristics(info, sink));
+    EDID_PROBE(EDID_PROBE_FORMAT_ESTABLISHED_TIMINGS, format_established_timings(info, sink));
+    EDID_PROBE(EDID_PROBE_FORMAT_STANDARD_TIMINGS, format_standard_timings(info, sink));
+    EDID_PROBE(EDID_PROBE_FORMAT_DESCRIPTORS, format_descriptors(info, sink));
+
+    if (info->checksum_valid) {
         DGB_PRINTF("Checksum is valid.\n");
-        written = sprintf(output + offset, "Checksum is valid\n");
-        offset += written;
+        EDID_SINK_LITERAL(sink, "Checksum is valid\n");
     } else {
         DGB_PRINTF("Checksum is invalid.\n");
-        written = sprintf(output + offset, "Checksum is invalid\n");
-        offset += written;
+        EDID_SINK_LITERAL(sink, "Checksum is invalid\n");
     }
+}
 
-    DGB_PRINTF_ALL("%s", edid_output);
+/**
+ * Parses the EDID data
+ *
+ * @param edid Pointer to the 128-byte EDID data array
+ * @param output Buffer receiving the text, or NULL to only measure it
+ * @param capacity Size of output in bytes
+ * @return Length of the full text excluding the NUL; the output was truncated if this is >= capacity
+ */
+size_t parse_edid_array(const unsigned char *edid, char *output, size_t capacity){
+    struct edid_info info;
+    struct edid_sink sink;
+    int header_valid = parse_edid_struct(edid, &info);
+
+    edid_sink_init(&sink, output, capacity);
+    EDID_PROBE(EDID_PROBE_OUTPUT, format_edid_info(&info, &sink));
+    if (!header_valid || !output)
+    {
+        return sink.length;
+    }
+
+    DGB_PRINTF_ALL("%s", output);
+    return sink.length;
 }
 
 /**
@@ -100,12 +433,310 @@ void parse_edid_array(const unsigned char *edid, char *output){
  */
 int check_header(const unsigned char *edid)
 {
-    if (edid[0] != 0x00 || edid[1] != 0xFF || edid[2] != 0xFF || edid[3] != 0xFF || edid[4] != 0xFF || edid[5] != 0xFF ||
-        edid[6] != 0xFF || edid[7] != 0x00)
+    return edid_header_valid(edid);
+}
+
+/**
+ * Wraps a validated view around an EDID: the header and checksum of the base
+ * block are checked here once, so the accessors below do no checking of their
+ * own. Accessors may be used on any view of at least EDID_LENGTH bytes, also
+ * one with a bad checksum, the way parse_edid_struct() still decodes it.
+ *
+ * @param view View to initialise
+ * @param data Raw EDID, base block first; not copied, so it must outlive the view
+ * @param length Number of bytes in data
+ * @return 1 if the base block has a valid header and checksum, 0 otherwise (see view->status)
+ */
+int edid_view_init(struct edid_view *view, const unsigned char *data, size_t length)
+{
+    view->data = data;
+    view->length = length;
+
+    if (!data || length < EDID_LENGTH)
     {
-        return 0; // Invalid header
+        view->status = EDID_STATUS_TRUNCATED;
+        return 0;
     }
-    return 1; // Valid header
+    view->status = (check_header(data) ? 0 : EDID_STATUS_BAD_HEADER) |
+                   (verify_edid_checksum(data) ? 0 : EDID_STATUS_BAD_CHECKSUM);
+    return view->status == EDID_STATUS_OK;
+}
+
+/**
+ * View over a base block the caller has already checked, or, for the
+ * parse_* functions, never checks. The status is not computed.
+ */
+static inline struct edid_view raw_view(const unsigned char *edid)
+{
+    struct edid_view view = {edid, EDID_LENGTH, EDID_STATUS_OK};
+    return view;
+}
+
+/**
+ * Three-letter PNP manufacturer ID from bytes 8-9, NUL terminated.
+ */
+void edid_vendor(const struct edid_view *view, char id[4])
+{
+    uint16_t manufacturer = (view->data[8] << 8) | view->data[9]; // Combine bytes 8 and 9
+
+    id[0] = ((manufacturer >> 10) & 0x1F) + 'A' - 1; // ASCII
+    id[1] = ((manufacturer >> 5) & 0x1F) + 'A' - 1;
+    id[2] = (manufacturer & 0x1F) + 'A' - 1;
+    id[3] = '\0';
+}
+
+uint16_t edid_product(const struct edid_view *view)
+{
+    return view->data[10] | (view->data[11] << 8);
+}
+
+uint32_t edid_serial(const struct edid_view *view)
+{
+    const unsigned char *edid = view->data;
+
+    return edid[12] | (edid[13] << 8) | (edid[14] << 16) | ((uint32_t)edid[15] << 24);
+}
+
+uint8_t edid_manufacture_week(const struct edid_view *view)
+{
+    return view->data[16];
+}
+
+uint16_t edid_manufacture_year(const struct edid_view *view)
+{
+    return 1990 + view->data[17];
+}
+
+uint8_t edid_version(const struct edid_view *view)
+{
+    return view->data[0x12];
+}
+
+uint8_t edid_revision(const struct edid_view *view)
+{
+    return view->data[0x13];
+}
+
+uint8_t edid_video_input(const struct edid_view *view)
+{
+    return view->data[20];
+}
+
+uint8_t edid_screen_width_cm(const struct edid_view *view)
+{
+    return view->data[21];
+}
+
+uint8_t edid_screen_height_cm(const struct edid_view *view)
+{
+    return view->data[22];
+}
+
+/**
+ * Encoded gamma from byte 23: (gamma * 100) - 100, 0xFF if not given.
+ */
+uint8_t edid_gamma(const struct edid_view *view)
+{
+    return view->data[23];
+}
+
+uint8_t edid_features(const struct edid_view *view)
+{
+    return view->data[24];
+}
+
+/**
+ * Raw 10-bit chromaticity coordinates from bytes 25-34.
+ */
+void edid_chromaticity_points(const struct edid_view *view, struct edid_chromaticity *points)
+{
+    const unsigned char *edid = view->data;
+    uint8_t red_green_lo = edid[25];
+    uint8_t blue_white_lo = edid[26];
+
+    points->red_x   = (edid[27] << 2) | ((red_green_lo >> 6) & 0x03);
+    points->red_y   = (edid[28] << 2) | ((red_green_lo >> 4) & 0x03);
+    points->green_x = (edid[29] << 2) | ((red_green_lo >> 2) & 0x03);
+    points->green_y = (edid[30] << 2) | (red_green_lo & 0x03);
+
+    points->blue_x  = (edid[31] << 2) | ((blue_white_lo >> 6) & 0x03);
+    points->blue_y  = (edid[32] << 2) | ((blue_white_lo >> 4) & 0x03);
+    points->white_x = (edid[33] << 2) | ((blue_white_lo >> 2) & 0x03);
+    points->white_y = (edid[34] << 2) | (blue_white_lo & 0x03);
+}
+
+/**
+ * Established timing bits, byte 35 in the high byte and byte 36 in the low.
+ */
+uint16_t edid_established(const struct edid_view *view)
+{
+    return (view->data[35] << 8) | view->data[36];
+}
+
+uint8_t edid_manufacturer_timings(const struct edid_view *view)
+{
+    return view->data[37];
+}
+
+/**
+ * Decodes one standard timing slot.
+ *
+ * @param view View from edid_view_init()
+ * @param index Slot, 0 to EDID_STANDARD_TIMING_COUNT - 1
+ * @param timing Filled when the slot is used
+ * @return 1 if the slot holds a timing, 0 if it is unused (0x01 0x01)
+ */
+int edid_std_timing(const struct edid_view *view, int index, struct edid_standard_timing *timing)
+{
+    uint8_t byte1 = view->data[38 + index * 2];
+    uint8_t byte2 = view->data[39 + index * 2];
+
+    if (byte1 == 0x01 && byte2 == 0x01)
+    {
+        return 0;
+    }
+
+    const struct edid_standard_timing_entry *entry = &standard_timing_table[byte2 >> 6][byte1];
+    timing->horizontal_resolution = entry->width;
+    timing->vertical_resolution = entry->height;
+    timing->aspect = byte2 >> 6;
+    timing->vertical_frequency = (byte2 & 0x3F) + 60;
+    return 1;
+}
+
+/**
+ * Type of descriptor slot index, 0 to EDID_DESCRIPTOR_COUNT - 1.
+ *
+ * @return EDID_DESCRIPTOR_TIMING for a detailed timing, otherwise the display descriptor tag (byte 3)
+ */
+uint8_t edid_descriptor_tag(const struct edid_view *view, int index)
+{
+    const unsigned char *desc = view->data + 54 + index * 18;
+
+    return (desc[0] | desc[1]) ? EDID_DESCRIPTOR_TIMING : desc[3];
+}
+
+/**
+ * Decodes descriptor slot index as a detailed timing. Slot 0 holds the
+ * preferred timing.
+ *
+ * @return 1 if the slot holds a timing, 0 if it is a display descriptor
+ */
+int edid_detailed_timing(const struct edid_view *view, int index, struct edid_detailed_timing *timing)
+{
+    return edid_decode_detailed_timing(view->data + 54 + index * 18, timing);
+}
+
+/**
+ * Copies a descriptor text field, which ends at 0x0A and is padded with spaces.
+ */
+static void decode_descriptor_text(const unsigned char *data, char *text)
+{
+    int len = 0;
+
+    while (len < EDID_DESCRIPTOR_TEXT_LENGTH && data[len] != 0x0A)
+    {
+        text[len] = (char)data[len];
+        len++;
+    }
+    while (len > 0 && text[len - 1] == ' ')
+    {
+        len--;
+    }
+    text[len] = '\0';
+}
+
+/**
+ * Copies the text of descriptor slot index if it is a monitor name, serial
+ * number or unspecified text descriptor.
+ *
+ * @return 1 if the slot holds text, 0 otherwise (text is left untouched)
+ */
+int edid_descriptor_text(const struct edid_view *view, int index, char text[EDID_DESCRIPTOR_TEXT_LENGTH + 1])
+{
+    const unsigned char *desc = view->data + 54 + index * 18;
+
+    switch (edid_descriptor_tag(view, index))
+    {
+    case EDID_DESCRIPTOR_SERIAL:
+    case EDID_DESCRIPTOR_TEXT:
+    case EDID_DESCRIPTOR_NAME:
+        decode_descriptor_text(desc + 5, text);
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+/**
+ * Decodes descriptor slot index as display range limits.
+ *
+ * @return 1 if the slot is a range limits descriptor, 0 otherwise
+ */
+int edid_descriptor_range_limits(const struct edid_view *view, int index, struct edid_range_limits *range)
+{
+    const unsigned char *desc = view->data + 54 + index * 18;
+    uint8_t offsets = desc[4]; // EDID 1.4 rate offsets
+
+    if (edid_descriptor_tag(view, index) != EDID_DESCRIPTOR_RANGE_LIMITS)
+    {
+        return 0;
+    }
+
+    range->min_vertical_hz = desc[5] + ((offsets & 0x03) == 0x03 ? 255 : 0);
+    range->max_vertical_hz = desc[6] + ((offsets & 0x02) ? 255 : 0);
+    range->min_horizontal_khz = desc[7] + ((offsets & 0x0C) == 0x0C ? 255 : 0);
+    range->max_horizontal_khz = desc[8] + ((offsets & 0x08) ? 255 : 0);
+    range->max_pixel_clock_mhz = desc[9] * 10;
+    range->timing_support = desc[10];
+    return 1;
+}
+
+/**
+ * Finds the monitor name descriptor. With several, the last one wins, as in
+ * parse_edid_struct().
+ *
+ * @return 1 if a name was found, 0 otherwise (name is set to "")
+ */
+int edid_monitor_name(const struct edid_view *view, char name[EDID_DESCRIPTOR_TEXT_LENGTH + 1])
+{
+    int found = 0;
+
+    name[0] = '\0';
+    for (int i = 0; i < EDID_DESCRIPTOR_COUNT; i++)
+    {
+        if (edid_descriptor_tag(view, i) == EDID_DESCRIPTOR_NAME)
+        {
+            found = edid_descriptor_text(view, i, name);
+        }
+    }
+    return found;
+}
+
+/**
+ * Number of extension blocks announced in byte 126.
+ */
+uint8_t edid_extension_count(const struct edid_view *view)
+{
+    return view->data[126];
+}
+
+static void decode_edid_version(const unsigned char *edid, struct edid_info *info)
+{
+    const struct edid_view view = raw_view(edid);
+
+    info->version = edid_version(&view);
+    info->revision = edid_revision(&view);
+}
+
+static void format_edid_version(const struct edid_info *info, struct edid_sink *sink)
+{
+    DGB_PRINTF("EDID Version: %d.%d\n", info->version, info->revision);
+    EDID_SINK_LITERAL(sink, "EDID Version: ");
+    edid_sink_putu(sink, info->version);
+    edid_sink_putc(sink, '.');
+    edid_sink_putu(sink, info->revision);
+    edid_sink_putc(sink, '\n');
 }
 
 /**
@@ -113,14 +744,34 @@ int check_header(const unsigned char *edid)
  *
  * @param edid Pointer to the 128-byte EDID data array.
  */
-void parse_edid_version(const unsigned char *edid, char *output, int *offset)
+void parse_edid_version(const unsigned char *edid, struct edid_sink *sink)
+{
+    struct edid_info info;
+    decode_edid_version(edid, &info);
+    format_edid_version(&info, sink);
+}
+
+static void decode_manufacturer_id(const unsigned char *edid, struct edid_info *info)
 {
-    uint8_t version = edid[0x12];  // EDID version byte
-    uint8_t revision = edid[0x13]; // EDID revision byte
-    DGB_PRINTF("EDID Version: %d.%d\n", version, revision);
-    int written = sprintf(output + *offset, "EDID Version: %d.%d\n", version, revision);
-    *offset += written;
+    const struct edid_view view = raw_view(edid);
 
+    edid_vendor(&view, info->manufacturer_id);
+}
+
+static void format_manufacturer_id(const struct edid_info *info, struct edid_sink *sink)
+{
+    DGB_PRINTF("Manufacturer ID: %s\n", info->manufacturer_id);
+    const char *name = edid_pnp_lookup(info->manufacturer_id);
+
+    EDID_SINK_LITERAL(sink, "Manufacturer ID: ");
+    edid_sink_write(sink, info->manufacturer_id, 3);
+    if (name)
+    {
+        EDID_SINK_LITERAL(sink, " (");
+        edid_sink_puts(sink, name);
+        edid_sink_putc(sink, ')');
+    }
+    edid_sink_putc(sink, '\n');
 }
 
 /**
@@ -128,20 +779,28 @@ void parse_edid_version(const unsigned char *edid, char *output, int *offset)
  *
  * @param edid Pointer to the 128-byte EDID data array
  */
-void parse_manufacturer_id(const unsigned char *edid, char *output, int *offset)
+void parse_manufacturer_id(const unsigned char *edid, struct edid_sink *sink)
 {
-    uint16_t manufacturer = (edid[8] << 8) | edid[9]; // Combine bytes 8 and 9
+    struct edid_info info;
+    decode_manufacturer_id(edid, &info);
+    format_manufacturer_id(&info, sink);
+}
 
-    char manufacturer_id[4];
+static void decode_product_code(const unsigned char *edid, struct edid_info *info)
+{
+    const struct edid_view view = raw_view(edid);
 
-    manufacturer_id[0] = ((manufacturer >> 10) & 0x1F) + 'A' - 1; // ASCII
-    manufacturer_id[1] = ((manufacturer >> 5) & 0x1F) + 'A' - 1;
-    manufacturer_id[2] = (manufacturer & 0x1F) + 'A' - 1;
-    manufacturer_id[3] = '\0';
+    info->product_code = edid_product(&view);
+}
 
-    DGB_PRINTF("Manufacturer ID: %s\n", manufacturer_id);
-    int written = sprintf(output + *offset, "Manufacturer ID: %s\n", manufacturer_id);
-    *offset += written;
+static void format_product_code(const struct edid_info *info, struct edid_sink *sink)
+{
+    DGB_PRINTF("Product Code: %u (0x%04X)\n", info->product_code, info->product_code);
+    EDID_SINK_LITERAL(sink, "Product Code: ");
+    edid_sink_putu(sink, info->product_code);
+    EDID_SINK_LITERAL(sink, " (0x");
+    edid_sink_puthex(sink, info->product_code, 4);
+    EDID_SINK_LITERAL(sink, ")\n");
 }
 
 /**
@@ -149,13 +808,28 @@ void parse_manufacturer_id(const unsigned char *edid, char *output, int *offset)
  *
  * @param edid Pointer to the 128-byte EDID data array
  */
-void parse_product_code(const unsigned char *edid, char *output, int *offset)
+void parse_product_code(const unsigned char *edid, struct edid_sink *sink)
 {
-    // Combine the two bytes
-    uint16_t product_code = edid[10] | (edid[11] << 8);
-    DGB_PRINTF("Product Code: %u (0x%04X)\n", product_code, product_code);
-    int written = sprintf(output + *offset, "Product Code: %u (0x%04X)\n", product_code, product_code);
-    *offset += written;
+    struct edid_info info;
+    decode_product_code(edid, &info);
+    format_product_code(&info, sink);
+}
+
+static void decode_serial_number(const unsigned char *edid, struct edid_info *info)
+{
+    const struct edid_view view = raw_view(edid);
+
+    info->serial_number = edid_serial(&view);
+}
+
+static void format_serial_number(const struct edid_info *info, struct edid_sink *sink)
+{
+    EDID_SINK_LITERAL(sink, "Serial Number: ");
+    edid_sink_putu(sink, info->serial_number);
+    EDID_SINK_LITERAL(sink, " (0x");
+    edid_sink_puthex(sink, info->serial_number, 8);
+    EDID_SINK_LITERAL(sink, ")\n");
+    DGB_PRINTF("Serial Number: %u (0x%08X)\n", info->serial_number, info->serial_number);
 }
 
 /**
@@ -163,13 +837,29 @@ void parse_product_code(const unsigned char *edid, char *output, int *offset)
  *
  * @param edid Pointer to the 128-byte EDID data array
  */
-void parse_serial_number(const unsigned char *edid, char *output, int *offset)
+void parse_serial_number(const unsigned char *edid, struct edid_sink *sink)
+{
+    struct edid_info info;
+    decode_serial_number(edid, &info);
+    format_serial_number(&info, sink);
+}
+
+static void decode_manufacture_date(const unsigned char *edid, struct edid_info *info)
+{
+    const struct edid_view view = raw_view(edid);
+
+    info->manufacture_week = edid_manufacture_week(&view);
+    info->manufacture_year = edid_manufacture_year(&view);
+}
+
+static void format_manufacture_date(const struct edid_info *info, struct edid_sink *sink)
 {
-    // Combine 4 bytes
-    uint32_t serial = edid[12] | (edid[13] << 8) | (edid[14] << 16) | (edid[15] << 24);
-    int written = sprintf(output + *offset, "Serial Number: %u (0x%08X)\n", serial, serial);
-    *offset += written;
-    DGB_PRINTF("Serial Number: %u (0x%08X)\n", serial, serial);
+    DGB_PRINTF("Manufacture Date: Year %u, Week %u\n", info->manufacture_year, info->manufacture_week);
+    EDID_SINK_LITERAL(sink, "Manufacture Date: Year ");
+    edid_sink_putu(sink, info->manufacture_year);
+    EDID_SINK_LITERAL(sink, ", Week ");
+    edid_sink_putu(sink, info->manufacture_week);
+    edid_sink_putc(sink, '\n');
 }
 
 /**
@@ -177,65 +867,69 @@ void parse_serial_number(const unsigned char *edid, char *output, int *offset)
  *
  * @param edid Pointer to the 128-byte EDID data array.
  */
-void parse_manufacture_date(const unsigned char *edid, char *output, int *offset)
+void parse_manufacture_date(const unsigned char *edid, struct edid_sink *sink)
 {
-    uint8_t week = edid[16];
-    uint8_t year_offset = edid[17];
-    uint16_t year = 1990 + year_offset;
-
-    DGB_PRINTF("Manufacture Date: Year %u, Week %u\n", year, week);
-    int written = sprintf(output + *offset, "Manufacture Date: Year %u, Week %u\n", year, week);
-    *offset += written;
+    struct edid_info info;
+    decode_manufacture_date(edid, &info);
+    format_manufacture_date(&info, sink);
 }
 
-/**
- * Prints the video input type and other details details
- *
- * @param edid Pointer to the 128-byte EDID data array
- */
-void parse_video_input(const unsigned char *edid, char *output, int *offset)
+static void decode_video_input(const unsigned char *edid, struct edid_info *info)
 {
-    uint8_t input = edid[20];
+    const struct edid_view view = raw_view(edid);
+    uint8_t input = edid_video_input(&view);
 
-    if (input & 0x80)
+    info->video_input = input;
+    info->digital = (input & 0x80) ? 1 : 0;
+
+    if (info->digital)
     {
-        DGB_PRINTF("Video Input Type: Digital\n");
-        int written = sprintf(output + *offset, "Video Input Type: Digital\n");
-        *offset += written;
+        info->bit_depth = (input >> 4) & 0x07;
+        info->interface = input & 0x0F;
+    }
+    else
+    {
+        info->signal_level = (input >> 5) & 0x03;
+        info->video_setup = (input >> 4) & 0x01;
+        info->sync_types = input & 0x0F;
+    }
+}
 
-        uint8_t bit = (input >> 4) & 0x07;
-        uint8_t interface = input & 0x0F;
+static void format_video_input(const struct edid_info *info, struct edid_sink *sink)
+{
+    if (info->digital)
+    {
+        DGB_PRINTF("Video Input Type: Digital\n");
+        EDID_SINK_LITERAL(sink, "Video Input Type: Digital\n");
 
         const char *bits[] = {"Undefined", "6", "8", "10", "12", "14", "16", "Reserved"};
 
         const char *interfaces[] = {"Undefined", "DVI", "HDMIa", "HDMIb", "MDDI", "DisplayPort"};
 
-        DGB_PRINTF("   Bits per colour: %s\n", bits[bit]);
-        written = sprintf(output + *offset, "   Bits per colour: %s\n", bits[bit]);
-        *offset += written;
+        DGB_PRINTF("   Bits per colour: %s\n", bits[info->bit_depth]);
+        EDID_SINK_LITERAL(sink, "   Bits per colour: ");
+        edid_sink_puts(sink, bits[info->bit_depth]);
+        edid_sink_putc(sink, '\n');
 
-        if (interface < 6)
+        if (info->interface < 6)
         {
-            DGB_PRINTF("   Interface: %s\n", interfaces[interface]);
-            int written = sprintf(output + *offset, "   Interface: %s\n", interfaces[interface]);
-            *offset += written;
+            DGB_PRINTF("   Interface: %s\n", interfaces[info->interface]);
+            EDID_SINK_LITERAL(sink, "   Interface: ");
+            edid_sink_puts(sink, interfaces[info->interface]);
+            edid_sink_putc(sink, '\n');
         }
         else
         {
             DGB_PRINTF("   Interface: Reserved or Unknown\n");
-            int written = sprintf(output + *offset, "   Interface: Reserved or Unknown\n");
-            *offset += written;
+            EDID_SINK_LITERAL(sink, "   Interface: Reserved or Unknown\n");
         }
     }
     else
     {
         DGB_PRINTF("Video Input Type: Analog\n");
-        int written = sprintf(output + *offset, "Video Input Type: Analog\n");
-        *offset += written;
+        EDID_SINK_LITERAL(sink, "Video Input Type: Analog\n");
 
-        uint8_t level = (input >> 5) & 0x03;
-        uint8_t setup = (input >> 4) & 0x01;
-        uint8_t sync = input & 0x0F;
+        uint8_t sync = info->sync_types;
 
         const char *video_levels[] = {
             "0.700, 0.300 (1.0 V p-p)",
@@ -244,66 +938,103 @@ void parse_video_input(const unsigned char *edid, char *output, int *offset)
             "0.700, 0.000 (0.7 V p-p)",
         };
 
-        DGB_PRINTF("   Signal Level: %s\n", video_levels[level]);
-        written = sprintf(output + *offset, "   Signal Level: %s\n", video_levels[level]);
-        *offset += written;
+        DGB_PRINTF("   Signal Level: %s\n", video_levels[info->signal_level]);
+        EDID_SINK_LITERAL(sink, "   Signal Level: ");
+        edid_sink_puts(sink, video_levels[info->signal_level]);
+        edid_sink_putc(sink, '\n');
 
-        if (setup)
+        if (info->video_setup)
         {
             DGB_PRINTF("Video setup: Blank-to-Black setup or pedestal\n");
-            written = sprintf(output + *offset, "Video setup: Blank-to-Black setup or pedestal\n");
-            *offset += written;
+            EDID_SINK_LITERAL(sink, "Video setup: Blank-to-Black setup or pedestal\n");
         }
         else
         {
             DGB_PRINTF("Video setup: Blank level = Black level\n");
-            written = sprintf(output + *offset, "Video setup: Blank level = Black level\n");
-            *offset += written;
+            EDID_SINK_LITERAL(sink, "Video setup: Blank level = Black level\n");
         }
 
         DGB_PRINTF("   Sync Types Supported:\n");
-        written = sprintf(output + *offset, "   Sync Types Supported:\n");
-        *offset += written;
+        EDID_SINK_LITERAL(sink, "   Sync Types Supported:\n");
 
         if (sync & 0x08)
         {
             DGB_PRINTF("   -Separate Sync H & V Signals\n");
-            written = sprintf(output + *offset, "   -Separate Sync H & V Signals\n");
-            *offset += written;
+            EDID_SINK_LITERAL(sink, "   -Separate Sync H & V Signals\n");
         }
         if (sync & 0x04)
         {
             DGB_PRINTF("   -Composite Sync H & V Signals\n");
-            written = sprintf(output + *offset, "   -Composite Sync H & V Signals\n");
-            *offset += written;
+            EDID_SINK_LITERAL(sink, "   -Composite Sync H & V Signals\n");
         }
         if (sync & 0x02)
         {
             DGB_PRINTF("   -Composite Sync Signal on Green Video\n");
-            written = sprintf(output + *offset, "   -Composite Sync Signal on Green Video\n");
-            *offset += written;
+            EDID_SINK_LITERAL(sink, "   -Composite Sync Signal on Green Video\n");
         }
         if (sync & 0x01)
         {
             DGB_PRINTF("   -Serration on Vertical Sync\n");
-            written = sprintf(output + *offset, "   -Serration on Vertical Sync\n");
-            *offset += written;
+            EDID_SINK_LITERAL(sink, "   -Serration on Vertical Sync\n");
         }
     }
 }
 
+/**
+ * Prints the video input type and other details details
+ *
+ * @param edid Pointer to the 128-byte EDID data array
+ */
+void parse_video_input(const unsigned char *edid, struct edid_sink *sink)
+{
+    struct edid_info info;
+    decode_video_input(edid, &info);
+    format_video_input(&info, sink);
+}
+
+static void decode_screen_size(const unsigned char *edid, struct edid_info *info)
+{
+    const struct edid_view view = raw_view(edid);
+
+    info->horizontal_size_cm = edid_screen_width_cm(&view);
+    info->vertical_size_cm = edid_screen_height_cm(&view);
+}
+
+static void format_screen_size(const struct edid_info *info, struct edid_sink *sink)
+{
+    DGB_PRINTF("Screen Size: %d cm x %d cm\n", info->horizontal_size_cm, info->vertical_size_cm);
+    EDID_SINK_LITERAL(sink, "Screen Size: ");
+    edid_sink_putu(sink, info->horizontal_size_cm);
+    EDID_SINK_LITERAL(sink, " cm x ");
+    edid_sink_putu(sink, info->vertical_size_cm);
+    EDID_SINK_LITERAL(sink, " cm\n");
+}
+
 /*
  * Prints the screen size in centimetres in the format of horizontal size x vertical size
  *
  * @param edid Pointer to the 128-byte EDID data array
  */
-void parse_screen_size(const unsigned char *edid, char *output, int *offset)
+void parse_screen_size(const unsigned char *edid, struct edid_sink *sink)
+{
+    struct edid_info info;
+    decode_screen_size(edid, &info);
+    format_screen_size(&info, sink);
+}
+
+static void decode_display_gamma(const unsigned char *edid, struct edid_info *info)
 {
-    uint8_t horizontal_size = edid[21];
-    uint8_t vertical_size = edid[22];
-    DGB_PRINTF("Screen Size: %d cm x %d cm\n", horizontal_size, vertical_size);
-    int written = sprintf(output + *offset, "Screen Size: %d cm x %d cm\n", horizontal_size, vertical_size);
-    *offset += written;
+    const struct edid_view view = raw_view(edid);
+
+    info->gamma_encoded = edid_gamma(&view);
+}
+
+static void format_display_gamma(const struct edid_info *info, struct edid_sink *sink) {
+    DGB_PRINTF("Display Gamma: %d.%02d\n", (info->gamma_encoded + 100) / 100, (info->gamma_encoded + 100) % 100);
+
+    EDID_SINK_LITERAL(sink, "Display Gamma: ");
+    edid_sink_putgamma(sink, info->gamma_encoded, 4);
+    EDID_SINK_LITERAL(sink, " \n");
 }
 
 /*
@@ -311,317 +1042,492 @@ void parse_screen_size(const unsigned char *edid, char *output, int *offset)
  *
  * @param edid Pointer to the 128-byte EDID data array
  */
-void parse_display_gamma(const unsigned char *edid, char *output, int *offset) {
-    uint8_t gamma_encoded = edid[23];
-    float gamma = (gamma_encoded + 100) / 100.0f;
+void parse_display_gamma(const unsigned char *edid, struct edid_sink *sink) {
+    struct edid_info info;
+    decode_display_gamma(edid, &info);
+    format_display_gamma(&info, sink);
+}
 
-    char gamma_str[10];
-    float_to_string(gamma, gamma_str);
-    DGB_PRINTF("Display Gamma: %s\n", gamma_str);
+static void decode_supported_features(const unsigned char *edid, struct edid_info *info)
+{
+    const struct edid_view view = raw_view(edid);
 
-    int written = sprintf(output + *offset, "Display Gamma: %s \n", gamma_str);
-    *offset += written;
+    info->features = edid_features(&view);
+    info->display_type = (info->features >> 3) & 0x03;
 }
 
-/**
- * Parses and prints supported display features
- *
- * @param edid Pointer to the 128-byte EDID data array 
-*/
-void parse_supported_features(const unsigned char *edid, char *output, int *offset)
+static void format_supported_features(const struct edid_info *info, struct edid_sink *sink)
 {
-    uint8_t features = edid[24];
-    uint8_t input = edid[20];
+    uint8_t features = info->features;
 
     uint8_t power = (features >> 5) & 0x03;
 
     DGB_PRINTF("Supported Features:\n");
-    int written = sprintf(output + *offset, "Supported Features:\n");
-    *offset += written;
+    EDID_SINK_LITERAL(sink, "Supported Features:\n");
 
     if (power & 0x04)
     {
         DGB_PRINTF(" - Standby Supported\n");
-        written = sprintf(output + *offset, " - Standby Supported\n");
-        *offset += written;
+        EDID_SINK_LITERAL(sink, " - Standby Supported\n");
 
     }
     if (features & 0x02)
     {
         DGB_PRINTF(" - Suspend Supported\n");
-        written = sprintf(output + *offset, " - Suspend Supported\n");
-        *offset += written;
+        EDID_SINK_LITERAL(sink, " - Suspend Supported\n");
 
     }
     if (features & 0x01)
     {
         DGB_PRINTF(" - Active-Off Supported\n");
-        written = sprintf(output + *offset, " - Active-Off Supported\n");
-        *offset += written;
+        EDID_SINK_LITERAL(sink, " - Active-Off Supported\n");
 
     }
 
     // Display type
-    uint8_t display_type = (features >> 3) & 0x03;
     const char *display_types_digital[] = {
         "RGB 4:4:4", "RGB 4:4:4 & YCrCb 4:4:4", "RGB 4:4:4 & YCrCb 4:2:2", "RGB 4:4:4 & YCrCb 4:4:4 & YCrCb 4:2:2"};
     const char *display_types_analog[] = {
         "Monochrome or Grayscale", "RGB Color", "Non-RGB Color", "Undefined"};
-    if (input & 0x80)
+    if (info->digital)
     {
-        DGB_PRINTF(" - Display Type: %s\n", display_types_digital[display_type]);
-        written = sprintf(output + *offset, " - Display Type: %s\n", display_types_digital[display_type]);
-        *offset += written;
+        DGB_PRINTF(" - Display Type: %s\n", display_types_digital[info->display_type]);
+        EDID_SINK_LITERAL(sink, " - Display Type: ");
+        edid_sink_puts(sink, display_types_digital[info->display_type]);
+        edid_sink_putc(sink, '\n');
     }
     else
     {
-        DGB_PRINTF(" - Display Type: %s\n", display_types_analog[display_type]);
-        written = sprintf(output + *offset, " - Display Type: %s\n", display_types_analog[display_type]);
-        *offset += written;
+        DGB_PRINTF(" - Display Type: %s\n", display_types_analog[info->display_type]);
+        EDID_SINK_LITERAL(sink, " - Display Type: ");
+        edid_sink_puts(sink, display_types_analog[info->display_type]);
+        edid_sink_putc(sink, '\n');
     }
 
     // sRGB color space
     if (features & 0x04)
     {
         DGB_PRINTF(" - sRGB Color Space Default\n");
-        written = sprintf(output + *offset, " - sRGB Color Space Default\n");
-        *offset += written;
+        EDID_SINK_LITERAL(sink, " - sRGB Color Space Default\n");
     }
 
     // Preferred timing mode
     if (features & 0x02)
     {
         DGB_PRINTF(" - Preferred Timing Mode\n");
-        written = sprintf(output + *offset, " - Preferred Timing Mode\n");
-        *offset += written;
+        EDID_SINK_LITERAL(sink, " - Preferred Timing Mode\n");
     }
 
     // Continuous timings
     if (features & 0x01)
     {
         DGB_PRINTF(" - Continuous Timing Support\n");
-        written = sprintf(output + *offset, " - Continuous Timing Support\n");
-        *offset += written;
+        EDID_SINK_LITERAL(sink, " - Continuous Timing Support\n");
     }
 }
 
+/**
+ * Parses and prints supported display features
+ *
+ * @param edid Pointer to the 128-byte EDID data array 
+*/
+void parse_supported_features(const unsigned char *edid, struct edid_sink *sink)
+{
+    struct edid_info info;
+    decode_video_input(edid, &info);
+    decode_supported_features(edid, &info);
+    format_supported_features(&info, sink);
+}
+
+static void decode_colour_characteristics(const unsigned char *edid, struct edid_info *info)
+{
+    const struct edid_view view = raw_view(edid);
+
+    edid_chromaticity_points(&view, &info->chromaticity);
+}
+
+static void format_chromaticity_point(const char *label, uint16_t x, uint16_t y, struct edid_sink *sink)
+{
+    DGB_PRINTF("%s(X = %d/1024, Y = %d/1024)\n", label, x, y);
+    edid_sink_puts(sink, label);
+    EDID_SINK_LITERAL(sink, "(X = ");
+    edid_sink_putchromaticity(sink, x);
+    EDID_SINK_LITERAL(sink, ", Y = ");
+    edid_sink_putchromaticity(sink, y);
+    EDID_SINK_LITERAL(sink, ")\n");
+}
+
+static void format_colour_characteristics(const struct edid_info *info, struct edid_sink *sink)
+{
+    const struct edid_chromaticity *c = &info->chromaticity;
+
+    DGB_PRINTF("Color Characteristics (Chromaticity Coordinates):\n");
+    EDID_SINK_LITERAL(sink, "Color Characteristics (Chromaticity Coordinates):\n");
+
+    format_chromaticity_point("  Red   : ", c->red_x, c->red_y, sink);
+    format_chromaticity_point("  Green : ", c->green_x, c->green_y, sink);
+    format_chromaticity_point("  Blue  : ", c->blue_x, c->blue_y, sink);
+    format_chromaticity_point("  White : ", c->white_x, c->white_y, sink);
+}
+
 /**
  * Parses and prints the chromaticity coordinates (color characteristics)
  *
  * @param edid Pointer to the 128-byte EDID data array.
  */
-void parse_colour_characteristics(const unsigned char *edid, char *output, int *offset)
+void parse_colour_characteristics(const unsigned char *edid, struct edid_sink *sink)
 {
-    uint8_t red_green_lo = edid[25];
-    uint8_t blue_white_lo = edid[26];
+    struct edid_info info;
+    decode_colour_characteristics(edid, &info);
+    format_colour_characteristics(&info, sink);
+}
 
-    uint16_t red_x   = (edid[27] << 2) | ((red_green_lo >> 6) & 0x03);
-    uint16_t red_y   = (edid[28] << 2) | ((red_green_lo >> 4) & 0x03);
-    uint16_t green_x = (edid[29] << 2) | ((red_green_lo >> 2) & 0x03);
-    uint16_t green_y = (edid[30] << 2) | (red_green_lo & 0x03);
-
-    uint16_t blue_x  = (edid[31] << 2) | ((blue_white_lo >> 6) & 0x03);
-    uint16_t blue_y  = (edid[32] << 2) | ((blue_white_lo >> 4) & 0x03);
-    uint16_t white_x = (edid[33] << 2) | ((blue_white_lo >> 2) & 0x03);
-    uint16_t white_y = (edid[34] << 2) | (blue_white_lo & 0x03);
-
-    float red_x_f   = red_x / 1024.0f;
-    char red_x_s[10];
-    float_to_string(red_x_f, red_x_s);
-    float red_y_f   = red_y / 1024.0f;
-    char red_y_s[10];
-    float_to_string(red_y_f, red_y_s);
-    float green_x_f = green_x / 1024.0f;
-    char green_x_s[10];
-    float_to_string(green_x_f, green_x_s);
-    float green_y_f = green_y / 1024.0f;
-    char green_y_s[10];
-    float_to_string(green_y_f, green_y_s);
-    float blue_x_f  = blue_x / 1024.0f;
-    char blue_x_s[10];
-    float_to_string(blue_x_f, blue_x_s);
-    float blue_y_f  = blue_y / 1024.0f;
-    char blue_y_s[10];
-    float_to_string(blue_y_f, blue_y_s);
-    float white_x_f = white_x / 1024.0f;
-    char white_x_s[10];
-    float_to_string(white_x_f, white_x_s);
-    float white_y_f = white_y / 1024.0f;
-    char white_y_s[10];
-    float_to_string(white_y_f, white_y_s);
+static void decode_established_timings(const unsigned char *edid, struct edid_info *info)
+{
+    const struct edid_view view = raw_view(edid);
 
-    DGB_PRINTF("Color Characteristics (Chromaticity Coordinates):\n");
-    int written = sprintf(output + *offset, "Color Characteristics (Chromaticity Coordinates):\n");
-    *offset += written;
+    info->established_timings = edid_established(&view);
+    info->manufacturer_timings = edid_manufacturer_timings(&view);
+}
 
-    DGB_PRINTF("  Red   : (X = %s, Y = %s)\n", red_x_s, red_y_s);
-    written = sprintf(output + *offset, "  Red   : (X = %s, Y = %s)\n", red_x_s, red_y_s);
-    *offset += written;
+static void format_established_timings(const struct edid_info *info, struct edid_sink *sink)
+{
+    DGB_PRINTF("Established Timings:\n");
+    EDID_SINK_LITERAL(sink, "Established Timings:\n");
 
-    DGB_PRINTF("  Green : (X = %s, Y = %s)\n", green_x_s, green_y_s);
-    written = sprintf(output + *offset, "  Green : (X = %s, Y = %s)\n", green_x_s, green_y_s);
-    *offset += written;
+    // Visit only the set bits, highest first
+    uint16_t bits = info->established_timings;
 
-    DGB_PRINTF("  Blue  : (X = %s, Y = %s)\n", blue_x_s, blue_y_s);
-    written = sprintf(output + *offset, "  Blue  : (X = %s, Y = %s)\n", blue_x_s, blue_y_s);
-    *offset += written;
+    while (bits)
+    {
+        int i = (bits >> 8) ? leading_zeros8[bits >> 8] : 8 + leading_zeros8[bits & 0xFF];
+        const struct edid_timing_line *line = &established_timing_lines[i];
 
-    DGB_PRINTF("  White : (X = %s, Y = %s)\n", white_x_s, white_y_s);
-    written = sprintf(output + *offset, "  White : (X = %s, Y = %s)\n", white_x_s, white_y_s);
-    *offset += written;
-}
+        DGB_PRINTF("%s", line->text);
+        edid_sink_write(sink, line->text, line->length);
+        bits &= (uint16_t)~(0x8000u >> i);
+    }
 
+    // manufacturer timing
+    if (info->manufacturer_timings != 0x00)
+    {
+        DGB_PRINTF(" - Manufacturer reserved timings: 0x%02X\n", info->manufacturer_timings);
+        EDID_SINK_LITERAL(sink, " - Manufacturer reserved timings: 0x");
+        edid_sink_puthex(sink, info->manufacturer_timings, 2);
+        edid_sink_putc(sink, '\n');
+    }
+}
 
 /**
  * Parses and prints all established display timings supported by the monitor.
  *
  * @param edid Pointer to the 128-byte EDID data array.
  */
-void parse_established_timings(const unsigned char *edid, char *output, int *offset)
+void parse_established_timings(const unsigned char *edid, struct edid_sink *sink)
 {
-    uint8_t timing1 = edid[35];
-    uint8_t timing2 = edid[36];
-    uint8_t timing3 = edid[37];
-
-    const char *established_timings[] = {
-        "720x400 @ 70Hz", "720x400 @ 88Hz", "640x480 @ 60Hz", "640x480 @ 67Hz", "640x480 @ 72Hz", "640x480 @ 75Hz", "800x600 @ 56Hz", "800x600 @ 60Hz",
-
-        "800x600 @ 72Hz", "800x600 @ 75Hz", "832x624 @ 75Hz", "1024x768 @ 87Hz (interlaced)", "1024x768 @ 60Hz", "1024x768 @ 70Hz", "1024x768 @ 75Hz", "1280x1024 @ 75Hz"};
+    struct edid_info info;
+    decode_established_timings(edid, &info);
+    format_established_timings(&info, sink);
+}
 
-    DGB_PRINTF("Established Timings:\n");
-    int written = sprintf(output + *offset, "Established Timings:\n");
-    *offset += written;
+static void decode_standard_timings(const unsigned char *edid, struct edid_info *info)
+{
+    const struct edid_view view = raw_view(edid);
 
-    uint8_t mask = 0x80;
+    info->standard_timing_count = 0;
 
-    for (int i = 0; i < 8; i++)
+    for (int i = 0; i < EDID_STANDARD_TIMING_COUNT; i++)
     {
-        if (timing1 & mask)
+        if (edid_std_timing(&view, i, &info->standard_timings[info->standard_timing_count]))
         {
-            DGB_PRINTF(" - %s\n", established_timings[i]);
-            written = sprintf(output + *offset, " - %s\n", established_timings[i]);
-            *offset += written;
+            info->standard_timing_count++;
         }
-        mask >>= 1;
     }
+}
+
+static void format_standard_timings(const struct edid_info *info, struct edid_sink *sink)
+{
+    const char *aspect_ratios[] = {"16:10", "4:3", "5:4", "16:9"};
 
-    mask = 0x80;
+    DGB_PRINTF("Standard Timings:\n");
+    EDID_SINK_LITERAL(sink, "Standard Timings:\n");
 
-    for (int i = 0; i < 8; i++)
+    for (int i = 0; i < info->standard_timing_count; i++)
     {
-        if (timing2 & mask)
+        const struct edid_standard_timing *t = &info->standard_timings[i];
+        unsigned int byte1 = t->horizontal_resolution / 8 - 31;
+
+        DGB_PRINTF(" - %d x %d (%s) @ %dHz\n", t->horizontal_resolution, t->vertical_resolution, aspect_ratios[t->aspect], t->vertical_frequency);
+        EDID_SINK_LITERAL(sink, " - ");
+
+        // Timings decoded from an EDID have their text in the table; others, e.g. read from a record, are built up
+        if (t->aspect < 4 && t->horizontal_resolution % 8 == 0 && byte1 < 256 &&
+            standard_timing_table[t->aspect][byte1].height == t->vertical_resolution)
         {
-            DGB_PRINTF(" - %s\n", established_timings[8 + i]);
-            written = sprintf(output + *offset, " - %s\n", established_timings[8 + i]);
-            *offset += written;
+            const struct edid_standard_timing_entry *entry = &standard_timing_table[t->aspect][byte1];
+            edid_sink_write(sink, entry->text, entry->length);
         }
-        mask >>= 1;
+        else
+        {
+            edid_sink_putu(sink, t->horizontal_resolution);
+            EDID_SINK_LITERAL(sink, " x ");
+            edid_sink_putu(sink, t->vertical_resolution);
+            EDID_SINK_LITERAL(sink, " (");
+            edid_sink_puts(sink, aspect_ratios[t->aspect]);
+            edid_sink_putc(sink, ')');
+        }
+        EDID_SINK_LITERAL(sink, " @ ");
+        edid_sink_putu(sink, t->vertical_frequency);
+        EDID_SINK_LITERAL(sink, "Hz\n");
     }
+}
 
-    // manufacturer timing
-    if (timing3 != 0x00)
+/**
+ * Parses and prints the standard display timings encoded in the EDID.
+ *
+ * @param edid Pointer to the 128-byte EDID data array.
+ */
+void parse_standard_timings(const unsigned char *edid, struct edid_sink *sink)
+{
+    struct edid_info info;
+    decode_standard_timings(edid, &info);
+    format_standard_timings(&info, sink);
+}
+
+/**
+ * Decodes an 18-byte Detailed Timing Descriptor.
+ *
+ * @param dtd Pointer to the first byte of the descriptor
+ * @param timing Structure to fill
+ * @return 1 if the descriptor holds a timing, 0 if it is a display descriptor (pixel clock 0)
+ */
+int edid_decode_detailed_timing(const unsigned char *dtd, struct edid_detailed_timing *timing)
+{
+    uint16_t pixel_clock = dtd[0] | (dtd[1] << 8); // 10 kHz units
+
+    if (pixel_clock == 0)
     {
-        DGB_PRINTF(" - Manufacturer reserved timings: 0x%02X\n", timing3);
-        written = sprintf(output + *offset, " - Manufacturer reserved timings: 0x%02X\n", timing3);
-        *offset += written;
+        return 0;
     }
+
+    timing->pixel_clock_khz = pixel_clock * 10u;
+    timing->horizontal_active = dtd[2] | ((dtd[4] & 0xF0) << 4);
+    timing->horizontal_blanking = dtd[3] | ((dtd[4] & 0x0F) << 8);
+    timing->vertical_active = dtd[5] | ((dtd[7] & 0xF0) << 4);
+    timing->vertical_blanking = dtd[6] | ((dtd[7] & 0x0F) << 8);
+    timing->horizontal_sync_offset = dtd[8] | ((dtd[11] & 0xC0) << 2);
+    timing->horizontal_sync_width = dtd[9] | ((dtd[11] & 0x30) << 4);
+    timing->vertical_sync_offset = (dtd[10] >> 4) | ((dtd[11] & 0x0C) << 2);
+    timing->vertical_sync_width = (dtd[10] & 0x0F) | ((dtd[11] & 0x03) << 4);
+    timing->horizontal_image_mm = dtd[12] | ((dtd[14] & 0xF0) << 4);
+    timing->vertical_image_mm = dtd[13] | ((dtd[14] & 0x0F) << 8);
+    timing->horizontal_border = dtd[15];
+    timing->vertical_border = dtd[16];
+    timing->flags = dtd[17];
+
+    timing->refresh_mhz = edid_timing_refresh_mhz(timing);
+
+    return 1;
 }
 
 /**
- * Parses and prints the standard display timings encoded in the EDID.
+ * Computes the vertical refresh of a timing, pixel clock / (htotal * vtotal).
  *
- * @param edid Pointer to the 128-byte EDID data array.
+ * @param timing Timing with its clock, active and blanking fields filled in
+ * @return Refresh in millihertz, rounded, or 0 if the totals are zero
  */
-void parse_standard_timings(const unsigned char *edid, char *output, int *offset)
+uint32_t edid_timing_refresh_mhz(const struct edid_detailed_timing *timing)
 {
-    DGB_PRINTF("Standard Timings:\n");
-    int written = sprintf(output + *offset, "Standard Timings:\n");
-    *offset += written;
+    uint32_t total = (uint32_t)(timing->horizontal_active + timing->horizontal_blanking) *
+                     (timing->vertical_active + timing->vertical_blanking);
 
-    for (int i = 0; i < 8; i++)
+    return total ? (uint32_t)(((uint64_t)timing->pixel_clock_khz * 1000000u + total / 2) / total) : 0;
+}
+
+/**
+ * Formats a timing on one line, e.g. "3840x2160 @ 59.997Hz, pixel clock 533.25 MHz".
+ *
+ * @param timing Decoded timing
+ * @param sink Output sink receiving the text, without a trailing newline
+ */
+void format_timing_summary(const struct edid_detailed_timing *timing, struct edid_sink *sink)
+{
+    edid_sink_putu(sink, timing->horizontal_active);
+    edid_sink_putc(sink, 'x');
+    edid_sink_putu(sink, timing->vertical_active);
+    if (timing->flags & 0x80)
     {
-        uint8_t byte1 = edid[38 + i * 2];
-        uint8_t byte2 = edid[39 + i * 2];
+        edid_sink_putc(sink, 'i');
+    }
+    EDID_SINK_LITERAL(sink, " @ ");
+    edid_sink_putfixed(sink, timing->refresh_mhz, 3);
+    EDID_SINK_LITERAL(sink, "Hz, pixel clock ");
+    edid_sink_putfixed(sink, timing->pixel_clock_khz / 10, 2);
+    EDID_SINK_LITERAL(sink, " MHz");
+}
 
-        if (byte1 == 0x01 && byte2 == 0x01)
-        {
-            continue;
-        }
+static void decode_descriptors(const unsigned char *edid, struct edid_info *info)
+{
+    const struct edid_view view = raw_view(edid);
 
-        int horizontal_resolution = (byte1 + 31) * 8;
-        uint8_t aspect = (byte2 >> 6) & 0x03;
-        int vertical_frequency = (byte2 & 0x3F) + 60;
+    info->detailed_timing_count = 0;
+    info->has_range_limits = 0;
+    info->monitor_name[0] = '\0';
+    info->serial_string[0] = '\0';
+    info->unspecified_text[0] = '\0';
 
-        const char *aspect_ratios[] = {"16:10", "4:3", "5:4", "16:9"};
+    for (int i = 0; i < EDID_DESCRIPTOR_COUNT; i++)
+    {
+        uint8_t tag = edid_descriptor_tag(&view, i);
 
-        int vertical_resolution;
-        switch (aspect)
+        info->descriptor_tags[i] = tag;
+        switch (tag)
         {
-        case 0:
-            vertical_resolution = horizontal_resolution * 10 / 16;
-            break; // 16:10
-        case 1:
-            vertical_resolution = horizontal_resolution * 3 / 4;
-            break; // 4:3
-        case 2:
-            vertical_resolution = horizontal_resolution * 4 / 5;
-            break; // 5:4
-        case 3:
-            vertical_resolution = horizontal_resolution * 9 / 16;
-            break; // 16:9
+        case EDID_DESCRIPTOR_TIMING:
+            // Also the tag of a manufacturer descriptor 0x00, which holds no timing
+            info->detailed_timing_count += edid_detailed_timing(&view, i, &info->detailed_timings[info->detailed_timing_count]);
+            break;
+        case EDID_DESCRIPTOR_SERIAL:
+            edid_descriptor_text(&view, i, info->serial_string);
+            break;
+        case EDID_DESCRIPTOR_TEXT:
+            edid_descriptor_text(&view, i, info->unspecified_text);
+            break;
+        case EDID_DESCRIPTOR_NAME:
+            edid_descriptor_text(&view, i, info->monitor_name);
+            break;
+        case EDID_DESCRIPTOR_RANGE_LIMITS:
+            info->has_range_limits = (uint8_t)edid_descriptor_range_limits(&view, i, &info->range_limits);
+            break;
         default:
-            vertical_resolution = 0;
+            break;
         }
-
-        DGB_PRINTF(" - %d x %d (%s) @ %dHz\n", horizontal_resolution, vertical_resolution, aspect_ratios[aspect], vertical_frequency);
-        written = sprintf(output + *offset, " - %d x %d (%s) @ %dHz\n", horizontal_resolution, vertical_resolution, aspect_ratios[aspect], vertical_frequency);
-        *offset += written;
     }
 }
 
-void write_parsed_edid_data(unsigned int tx_id, const char *parsed_output)
+static void format_detailed_timing(const struct edid_detailed_timing *t, struct edid_sink *sink)
 {
-    /*unsigned int parsed_base_address = calculate_address(
-        FPGA_STS_EDID_MEM_BASE_ADDRESS,
-        PARSED_EDID_0_REGISTER + (tx_id * 0x180),
-        FPGA_STS_EDID_MEM_BASE_OFFSET);
+    format_timing_summary(t, sink);
+    edid_sink_putc(sink, '\n');
+
+    EDID_SINK_LITERAL(sink, "     Horizontal: blanking ");
+    edid_sink_putu(sink, t->horizontal_blanking);
+    EDID_SINK_LITERAL(sink, ", sync offset ");
+    edid_sink_putu(sink, t->horizontal_sync_offset);
+    EDID_SINK_LITERAL(sink, ", sync width ");
+    edid_sink_putu(sink, t->horizontal_sync_width);
+    EDID_SINK_LITERAL(sink, ", border ");
+    edid_sink_putu(sink, t->horizontal_border);
+    edid_sink_putc(sink, '\n');
+
+    EDID_SINK_LITERAL(sink, "     Vertical: blanking ");
+    edid_sink_putu(sink, t->vertical_blanking);
+    EDID_SINK_LITERAL(sink, ", sync offset ");
+    edid_sink_putu(sink, t->vertical_sync_offset);
+    EDID_SINK_LITERAL(sink, ", sync width ");
+    edid_sink_putu(sink, t->vertical_sync_width);
+    EDID_SINK_LITERAL(sink, ", border ");
+    edid_sink_putu(sink, t->vertical_border);
+    edid_sink_putc(sink, '\n');
+
+    EDID_SINK_LITERAL(sink, "     Image size: ");
+    edid_sink_putu(sink, t->horizontal_image_mm);
+    EDID_SINK_LITERAL(sink, " mm x ");
+    edid_sink_putu(sink, t->vertical_image_mm);
+    EDID_SINK_LITERAL(sink, " mm, flags 0x");
+    edid_sink_puthex(sink, t->flags, 2);
+    edid_sink_putc(sink, '\n');
+}
 
-    size_t len = strlen(parsed_output);
+static void format_descriptors(const struct edid_info *info, struct edid_sink *sink)
+{
+    DGB_PRINTF("Detailed Timing Descriptors:\n");
+    EDID_SINK_LITERAL(sink, "Detailed Timing Descriptors:\n");
 
-    for (size_t i = 0; i < len; i += 4)
+    for (int i = 0; i < info->detailed_timing_count; i++)
     {
-        uint32_t value = 0;
-
-        if (i < len) value |= (uint8_t)parsed_output[i];
-        if (i + 1 < len) value |= ((uint8_t)parsed_output[i + 1]) << 8;
-        if (i + 2 < len) value |= ((uint8_t)parsed_output[i + 2]) << 16;
-        if (i + 3 < len) value |= ((uint8_t)parsed_output[i + 3]) << 24;
+        if (i == 0)
+        {
+            EDID_SINK_LITERAL(sink, " - Preferred: ");
+        }
+        else
+        {
+            EDID_SINK_LITERAL(sink, " - ");
+        }
+        format_detailed_timing(&info->detailed_timings[i], sink);
+    }
 
-        unsigned int current_address = parsed_base_address + i;
-        IOWR(current_address, 0x0, value);
+    if (info->monitor_name[0])
+    {
+        EDID_SINK_LITERAL(sink, " - Monitor Name: ");
+        edid_sink_puts(sink, info->monitor_name);
+        edid_sink_putc(sink, '\n');
     }
+    if (info->serial_string[0])
+    {
+        EDID_SINK_LITERAL(sink, " - Serial Number String: ");
+        edid_sink_puts(sink, info->serial_string);
+        edid_sink_putc(sink, '\n');
+    }
+    if (info->unspecified_text[0])
+    {
+        EDID_SINK_LITERAL(sink, " - Text: ");
+        edid_sink_puts(sink, info->unspecified_text);
+        edid_sink_putc(sink, '\n');
+    }
+    if (info->has_range_limits)
+    {
+        const struct edid_range_limits *r = &info->range_limits;
+
+        EDID_SINK_LITERAL(sink, " - Range Limits: ");
+        edid_sink_putu(sink, r->min_vertical_hz);
+        edid_sink_putc(sink, '-');
+        edid_sink_putu(sink, r->max_vertical_hz);
+        EDID_SINK_LITERAL(sink, " Hz vertical, ");
+        edid_sink_putu(sink, r->min_horizontal_khz);
+        edid_sink_putc(sink, '-');
+        edid_sink_putu(sink, r->max_horizontal_khz);
+        EDID_SINK_LITERAL(sink, " kHz horizontal, max pixel clock ");
+        edid_sink_putu(sink, r->max_pixel_clock_mhz);
+        EDID_SINK_LITERAL(sink, " MHz\n");
+    }
+}
 
-    DGB_PRINTF("Parsed EDID written to memory starting at 0x%x\n", parsed_base_address);*/
-    DGB_PRINTF("Parsed output: %s", parsed_output);
+/**
+ * Parses and prints the four 18-byte descriptors: detailed timings, monitor
+ * name, serial number string, free text and range limits.
+ *
+ * @param edid Pointer to the 128-byte EDID data array.
+ */
+void parse_descriptors(const unsigned char *edid, struct edid_sink *sink)
+{
+    struct edid_info info;
+    decode_descriptors(edid, &info);
+    format_descriptors(&info, sink);
 }
 
-void float_to_string(float value, char* float_string) {
-    int int_part = (int)value;
-    int frac_part = (int)((value - int_part) * 10000);
+/**
+ * Publishes a decoded EDID to the FPGA as a binary record in the transmitter's
+ * parsed EDID window, in bursts of up to EDID_REG_BURST_WORDS registers.
+ *
+ * @param tx_id Transmitter the EDID was read from
+ * @param info Decoded base block
+ * @param ext Decoded extension blocks, or NULL
+ * @return 1 on success, 0 if the record could not be written
+ */
+int write_parsed_edid_data(unsigned int tx_id, const struct edid_info *info, const struct edid_ext_info *ext)
+{
+    struct edid_reg_sink sink;
+
+    edid_reg_sink_init(&sink, edid_reg_iowr_burst, NULL, EDID_REG_MEM_BASE, tx_id);
+    size_t length = edid_reg_write_record(&sink, info, ext);
 
-    sprintf(float_string, "%d.%04d", int_part, frac_part);
+    DGB_PRINTF("Parsed EDID record of %u bytes written to 0x%x in %u bursts\n", (unsigned int)length,
+               (unsigned int)sink.base, (unsigned int)sink.bursts);
+    return length != 0;
 }
 
 int verify_edid_checksum(const unsigned char *edid)
 {
-    uint8_t sum = 0;
-    for (int i = 0; i < EDID_LENGTH; ++i) {
-        sum += edid[i];
-    }
-
-    if (sum % 256 == 0) {
-        return 1; // Valid
-    } else {
-        return 0; // Invalid
-    }
+    return edid_block_sum(edid) == 0;
 }
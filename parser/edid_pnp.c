@@ -0,0 +1,45 @@
+#include <stdint.h>
+#include "parser.h"
+#include "edid_pnp_table.h"
+/**
+ * Manufacturer names of PNP IDs, looked up in the generated direct-indexed table
+ */
+
+/**
+ * Looks up the company a packed PNP ID is assigned to: one table load, no
+ * string compares.
+ *
+ * @param id ID as stored in bytes 8-9, byte 8 in the high byte; bit 15 is ignored
+ * @return Company name, or NULL if the ID is not in data/pnp_ids.txt
+ */
+const char *edid_pnp_name(uint16_t id)
+{
+    edid_pnp_offset offset = pnp_name_offsets[id & 0x7FFF];
+
+    return offset ? pnp_names + offset : NULL;
+}
+
+/**
+ * Looks up the company of a three-letter ID as decoded into
+ * edid_info.manufacturer_id.
+ *
+ * @return Company name, or NULL if the ID is unknown
+ */
+const char *edid_pnp_lookup(const char *manufacturer_id)
+{
+    // Decoded letters are the 5-bit codes offset by '@', so this packs them back
+    uint16_t id = (uint16_t)((((manufacturer_id[0] - '@') & 0x1F) << 10) | (((manufacturer_id[1] - '@') & 0x1F) << 5) |
+                             ((manufacturer_id[2] - '@') & 0x1F));
+
+    return edid_pnp_name(id);
+}
+
+/**
+ * Company name of the manufacturer of a viewed EDID.
+ *
+ * @return Company name, or NULL if the ID is unknown
+ */
+const char *edid_vendor_name(const struct edid_view *view)
+{
+    return edid_pnp_name((uint16_t)((view->data[8] << 8) | view->data[9]));
+}
@@ -0,0 +1,152 @@
+#ifndef EDID_PNP_TABLE_H
+#define EDID_PNP_TABLE_H
+
+/*
+ * Generated by tools/gen_pnp_table.c from data/pnp_ids.txt; do not edit.
+ */
+
+#include <stdint.h>
+
+typedef uint16_t edid_pnp_offset;
+
+// 66 manufacturer names, NUL separated; offset 0 is the empty name
+static const char pnp_names[1343] =
+    "\0"
+    "AcerView\0"
+    "Ancor Communications Inc\0"
+    "Acer Technologies\0"
+    "AOC\0"
+    "A Plus Info Corporation\0"
+    "Apple Computer Inc\0"
+    "AU Optronics\0"
+    "ASUSTek COMPUTER INC\0"
+    "BenQ Corporation\0"
+    "BOE\0"
+    "Chimei Innolux Corporation\0"
+    "Chi Mei Optoelectronics corp.\0"
+    "Compaq Computer Company\0"
+    "Digital Equipment Corporation\0"
+    "Dell Inc.\0"
+    "DENON, Ltd.\0"
+    "Daewoo Electronics Company Ltd\0"
+    "Elitegroup Computer Systems Company Ltd\0"
+    "Elo TouchSystems Inc\0"
+    "Eizo Nanao Corporation\0"
+    "Envision Peripherals, Inc\0"
+    "Fujitsu Siemens Computers GmbH\0"
+    "GIGA-BYTE TECHNOLOGY CO., LTD.\0"
+    "LG Electronics\0"
+    "Gateway 2000\0"
+    "Hyundai Electronics Industries Co., Ltd.\0"
+    "Hitachi America Ltd\0"
+    "HP Inc.\0"
+    "HannStar Display Corp\0"
+    "Hewlett Packard\0"
+    "Fujitsu ICL\0"
+    "InnoLux Display\0"
+    "Iiyama North America\0"
+    "Lenovo Group Limited\0"
+    "LG Display\0"
+    "The Linux Foundation\0"
+    "LG Philips\0"
+    "Panasonic Industry Company\0"
+    "Mitsubishi Electric Corporation\0"
+    "Microstep\0"
+    "NEC Corporation\0"
+    "Nokia Display Products\0"
+    "Nvidia\0"
+    "ONKYO Corporation\0"
+    "Philips Consumer Electronics Company\0"
+    "Pioneer Electronic Corporation\0"
+    "Planar Systems, Inc.\0"
+    "Quanta Display Inc.\0"
+    "Red Hat, Inc.\0"
+    "Samsung Electric Company\0"
+    "Samsung Display Corp\0"
+    "Seiko Epson Corporation\0"
+    "Sharp Corporation\0"
+    "Silicon Image, Inc.\0"
+    "Sony\0"
+    "Sceptre Tech Inc\0"
+    "Samsung Electronics America\0"
+    "Synaptics Inc\0"
+    "Toshiba Corporation\0"
+    "Toshiba America Info Systems Inc\0"
+    "Vestel Elektronik Sanayi ve Ticaret A. S.\0"
+    "VIZIO, Inc\0"
+    "ViewSonic Corporation\0"
+    "Wacom Tech\0"
+    "Xerox Corporation\0"
+    "Yamaha Corporation";
+
+// Offset into pnp_names of each packed ID (bytes 8-9, bit 15 clear)
+static const edid_pnp_offset pnp_name_offsets[32768] = {
+    [0x0423] = 1, // AAC
+    [0x0469] = 10, // ACI
+    [0x0472] = 35, // ACR
+    [0x05E3] = 53, // AOC
+    [0x0609] = 57, // API
+    [0x0610] = 81, // APP
+    [0x06AF] = 100, // AUO
+    [0x06B3] = 113, // AUS
+    [0x09D1] = 134, // BNQ
+    [0x09E5] = 151, // BOE
+    [0x0DAE] = 155, // CMN
+    [0x0DAF] = 182, // CMO
+    [0x0E11] = 212, // CPQ
+    [0x10A3] = 236, // DEC
+    [0x10AC] = 266, // DEL
+    [0x11EE] = 276, // DON
+    [0x12E5] = 288, // DWE
+    [0x1473] = 319, // ECS
+    [0x158F] = 359, // ELO
+    [0x15C3] = 380, // ENC
+    [0x1609] = 403, // EPI
+    [0x1AB3] = 429, // FUS
+    [0x1C54] = 460, // GBT
+    [0x1E6D] = 491, // GSM
+    [0x1EF9] = 506, // GWY
+    [0x20A9] = 519, // HEI
+    [0x2134] = 560, // HIT
+    [0x220E] = 580, // HPN
+    [0x2264] = 588, // HSD
+    [0x22F0] = 610, // HWP
+    [0x246C] = 626, // ICL
+    [0x25CC] = 638, // INL
+    [0x26CD] = 654, // IVM
+    [0x30AE] = 675, // LEN
+    [0x30E4] = 696, // LGD
+    [0x31D8] = 707, // LNX
+    [0x320C] = 728, // LPL
+    [0x34A9] = 739, // MEI
+    [0x34AC] = 766, // MEL
+    [0x3669] = 798, // MSI
+    [0x38A3] = 808, // NEC
+    [0x39EB] = 824, // NOK
+    [0x3AC4] = 847, // NVD
+    [0x3DCB] = 854, // ONK
+    [0x410C] = 872, // PHL
+    [0x412F] = 909, // PIO
+    [0x41D2] = 940, // PNR
+    [0x4493] = 961, // QDS
+    [0x4914] = 981, // RHT
+    [0x4C2D] = 995, // SAM
+    [0x4C83] = 1020, // SDC
+    [0x4CA3] = 1041, // SEC
+    [0x4D10] = 1065, // SHP
+    [0x4D29] = 1083, // SII
+    [0x4DD9] = 1103, // SNY
+    [0x4E14] = 1108, // SPT
+    [0x4E8E] = 1125, // STN
+    [0x4F2E] = 1153, // SYN
+    [0x51F3] = 1167, // TOS
+    [0x5262] = 1187, // TSB
+    [0x58B3] = 1220, // VES
+    [0x593A] = 1262, // VIZ
+    [0x5A63] = 1273, // VSC
+    [0x5C23] = 1295, // WAC
+    [0x6258] = 1306, // XRX
+    [0x65A8] = 1324, // YMH
+};
+
+#endif
@@ -0,0 +1,467 @@
+#include <string.h>
+#include <stdint.h>
+#include "parser.h"
+/**
+ * Compact binary records of decoded EDIDs
+ */
+
+_Static_assert(sizeof(struct edid_record) == 136, "edid_record layout changed");
+_Static_assert(sizeof(struct edid_record_ext) == 152, "edid_record_ext layout changed");
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define RECORD_SWAP 1
+
+static uint16_t swap16(uint16_t value)
+{
+    return (uint16_t)((value >> 8) | (value << 8));
+}
+
+static uint32_t swap32(uint32_t value)
+{
+    return ((uint32_t)swap16((uint16_t)value) << 16) | swap16((uint16_t)(value >> 16));
+}
+
+/**
+ * Converts the multi-byte fields between host and little-endian order. The
+ * conversion is its own inverse, so reading and writing share it.
+ */
+static void swap_record(struct edid_record *record)
+{
+    record->magic = swap32(record->magic);
+    record->length = swap16(record->length);
+    record->serial_number = swap32(record->serial_number);
+    record->product_code = swap16(record->product_code);
+    record->manufacture_year = swap16(record->manufacture_year);
+    record->established_timings = swap16(record->established_timings);
+}
+
+static void swap_record_ext(struct edid_record_ext *record)
+{
+    record->physical_address = swap16(record->physical_address);
+    record->hdmi_max_tmds_mhz = swap16(record->hdmi_max_tmds_mhz);
+    record->hdmi_forum_max_tmds_mhz = swap16(record->hdmi_forum_max_tmds_mhz);
+    record->native_vics = ((uint64_t)swap32((uint32_t)record->native_vics) << 32) | swap32((uint32_t)(record->native_vics >> 32));
+    record->tile_width = swap16(record->tile_width);
+    record->tile_height = swap16(record->tile_height);
+}
+#else
+#define RECORD_SWAP 0
+#endif
+
+/**
+ * Packs the 10-bit coordinates back into the layout of EDID bytes 25-34.
+ */
+static void pack_chromaticity(const struct edid_chromaticity *c, uint8_t out[10])
+{
+    out[0] = (uint8_t)(((c->red_x & 0x03) << 6) | ((c->red_y & 0x03) << 4) | ((c->green_x & 0x03) << 2) | (c->green_y & 0x03));
+    out[1] = (uint8_t)(((c->blue_x & 0x03) << 6) | ((c->blue_y & 0x03) << 4) | ((c->white_x & 0x03) << 2) | (c->white_y & 0x03));
+    out[2] = (uint8_t)(c->red_x >> 2);
+    out[3] = (uint8_t)(c->red_y >> 2);
+    out[4] = (uint8_t)(c->green_x >> 2);
+    out[5] = (uint8_t)(c->green_y >> 2);
+    out[6] = (uint8_t)(c->blue_x >> 2);
+    out[7] = (uint8_t)(c->blue_y >> 2);
+    out[8] = (uint8_t)(c->white_x >> 2);
+    out[9] = (uint8_t)(c->white_y >> 2);
+}
+
+/**
+ * Packs a detailed timing into an 18-byte Detailed Timing Descriptor. Base
+ * block timings always come from one, so every field fits.
+ */
+static void pack_timing(const struct edid_detailed_timing *t, uint8_t out[18])
+{
+    uint16_t pixel_clock = (uint16_t)(t->pixel_clock_khz / 10);
+
+    out[0] = (uint8_t)pixel_clock;
+    out[1] = (uint8_t)(pixel_clock >> 8);
+    out[2] = (uint8_t)t->horizontal_active;
+    out[3] = (uint8_t)t->horizontal_blanking;
+    out[4] = (uint8_t)(((t->horizontal_active >> 4) & 0xF0) | ((t->horizontal_blanking >> 8) & 0x0F));
+    out[5] = (uint8_t)t->vertical_active;
+    out[6] = (uint8_t)t->vertical_blanking;
+    out[7] = (uint8_t)(((t->vertical_active >> 4) & 0xF0) | ((t->vertical_blanking >> 8) & 0x0F));
+    out[8] = (uint8_t)t->horizontal_sync_offset;
+    out[9] = (uint8_t)t->horizontal_sync_width;
+    out[10] = (uint8_t)(((t->vertical_sync_offset & 0x0F) << 4) | (t->vertical_sync_width & 0x0F));
+    out[11] = (uint8_t)(((t->horizontal_sync_offset >> 2) & 0xC0) | ((t->horizontal_sync_width >> 4) & 0x30) |
+                        ((t->vertical_sync_offset >> 2) & 0x0C) | ((t->vertical_sync_width >> 4) & 0x03));
+    out[12] = (uint8_t)t->horizontal_image_mm;
+    out[13] = (uint8_t)t->vertical_image_mm;
+    out[14] = (uint8_t)(((t->horizontal_image_mm >> 4) & 0xF0) | ((t->vertical_image_mm >> 8) & 0x0F));
+    out[15] = t->horizontal_border;
+    out[16] = t->vertical_border;
+    out[17] = t->flags;
+}
+
+/**
+ * Packs a display descriptor text field: the text, then 0x0A and space padding.
+ */
+static void pack_text(uint8_t tag, const char *text, uint8_t out[18])
+{
+    size_t len = strnlen(text, EDID_DESCRIPTOR_TEXT_LENGTH);
+
+    out[3] = tag;
+    memcpy(out + 5, text, len);
+    if (len < EDID_DESCRIPTOR_TEXT_LENGTH)
+    {
+        out[5 + len] = 0x0A;
+        memset(out + 6 + len, ' ', EDID_DESCRIPTOR_TEXT_LENGTH - 1 - len);
+    }
+}
+
+static void pack_range_limits(const struct edid_range_limits *range, uint8_t out[18])
+{
+    // Rates above 255 use the EDID 1.4 offsets; a minimum offset implies the maximum one
+    out[3] = EDID_DESCRIPTOR_RANGE_LIMITS;
+    out[4] = (uint8_t)((range->min_vertical_hz > 255 ? 0x03 : range->max_vertical_hz > 255 ? 0x02 : 0) |
+                       (range->min_horizontal_khz > 255 ? 0x0C : range->max_horizontal_khz > 255 ? 0x08 : 0));
+    out[5] = (uint8_t)(range->min_vertical_hz - (range->min_vertical_hz > 255 ? 255 : 0));
+    out[6] = (uint8_t)(range->max_vertical_hz - (range->max_vertical_hz > 255 ? 255 : 0));
+    out[7] = (uint8_t)(range->min_horizontal_khz - (range->min_horizontal_khz > 255 ? 255 : 0));
+    out[8] = (uint8_t)(range->max_horizontal_khz - (range->max_horizontal_khz > 255 ? 255 : 0));
+    out[9] = (uint8_t)(range->max_pixel_clock_mhz / 10);
+    out[10] = range->timing_support;
+}
+
+/**
+ * Rebuilds the descriptor slots from the decoded fields. Timings fill the
+ * slots tagged as timings in order; a slot of a text or range limits type
+ * gets the value decoding kept for that type, so decoding the slots again
+ * gives the same fields.
+ */
+static void pack_descriptors(const struct edid_info *info, uint8_t out[EDID_DESCRIPTOR_COUNT][18])
+{
+    int timing = 0;
+
+    for (int i = 0; i < EDID_DESCRIPTOR_COUNT; i++)
+    {
+        switch (info->descriptor_tags[i])
+        {
+        case EDID_DESCRIPTOR_TIMING:
+            if (timing < info->detailed_timing_count)
+            {
+                pack_timing(&info->detailed_timings[timing++], out[i]);
+            }
+            break;
+        case EDID_DESCRIPTOR_SERIAL:
+            pack_text(EDID_DESCRIPTOR_SERIAL, info->serial_string, out[i]);
+            break;
+        case EDID_DESCRIPTOR_TEXT:
+            pack_text(EDID_DESCRIPTOR_TEXT, info->unspecified_text, out[i]);
+            break;
+        case EDID_DESCRIPTOR_NAME:
+            pack_text(EDID_DESCRIPTOR_NAME, info->monitor_name, out[i]);
+            break;
+        case EDID_DESCRIPTOR_RANGE_LIMITS:
+            pack_range_limits(&info->range_limits, out[i]);
+            break;
+        default:
+            out[i][3] = info->descriptor_tags[i];
+            break;
+        }
+    }
+}
+
+/**
+ * Decodes the chromaticity, standard timing and descriptor bytes of a record
+ * with the base block accessors, the same way parse_edid_struct() does.
+ */
+static void unpack_raw_fields(const struct edid_record *record, struct edid_info *info)
+{
+    unsigned char block[EDID_LENGTH] = {0};
+    const struct edid_view view = {block, EDID_LENGTH, EDID_STATUS_OK};
+
+    memcpy(block + 25, record->chromaticity, sizeof(record->chromaticity));
+    memcpy(block + 38, record->standard_timings, sizeof(record->standard_timings));
+    memcpy(block + 54, record->descriptors, sizeof(record->descriptors));
+
+    edid_chromaticity_points(&view, &info->chromaticity);
+    for (int i = 0; i < EDID_STANDARD_TIMING_COUNT; i++)
+    {
+        info->standard_timing_count += edid_std_timing(&view, i, &info->standard_timings[info->standard_timing_count]);
+    }
+
+    for (int i = 0; i < EDID_DESCRIPTOR_COUNT; i++)
+    {
+        uint8_t tag = edid_descriptor_tag(&view, i);
+
+        info->descriptor_tags[i] = tag;
+        switch (tag)
+        {
+        case EDID_DESCRIPTOR_TIMING:
+            info->detailed_timing_count += edid_detailed_timing(&view, i, &info->detailed_timings[info->detailed_timing_count]);
+            break;
+        case EDID_DESCRIPTOR_SERIAL:
+            edid_descriptor_text(&view, i, info->serial_string);
+            break;
+        case EDID_DESCRIPTOR_TEXT:
+            edid_descriptor_text(&view, i, info->unspecified_text);
+            break;
+        case EDID_DESCRIPTOR_NAME:
+            edid_descriptor_text(&view, i, info->monitor_name);
+            break;
+        case EDID_DESCRIPTOR_RANGE_LIMITS:
+            edid_descriptor_range_limits(&view, i, &info->range_limits);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+static void pack_ext(const struct edid_ext_info *ext, struct edid_record_ext *record)
+{
+    const struct edid_cta_info *cta = &ext->cta;
+    const struct edid_displayid_info *displayid = &ext->displayid;
+
+    record->block_count = ext->block_count;
+    record->blocks_decoded = ext->blocks_decoded;
+    record->bad_checksums = ext->bad_checksums;
+    record->flags = (cta->present ? EDID_RECORD_CTA : 0) | (cta->has_hdmi ? EDID_RECORD_HDMI : 0) |
+                    (cta->has_hdmi_forum ? EDID_RECORD_HDMI_FORUM : 0) | (cta->has_hdr_static ? EDID_RECORD_HDR_STATIC : 0) |
+                    (displayid->present ? EDID_RECORD_DISPLAYID : 0) | (displayid->has_tile ? EDID_RECORD_TILE : 0);
+
+    record->cta_revision = cta->revision;
+    record->cta_flags = cta->flags;
+    record->vic_count = cta->vic_count;
+    record->audio_count = cta->audio_count;
+    record->physical_address = cta->physical_address;
+    record->hdmi_max_tmds_mhz = cta->hdmi_max_tmds_mhz;
+    record->hdmi_forum_max_tmds_mhz = cta->hdmi_forum_max_tmds_mhz;
+    record->hdr_eotfs = cta->hdr_eotfs;
+    record->hdr_metadata_types = cta->hdr_metadata_types;
+    record->native_vics = cta->native_vics;
+    memcpy(record->vics, cta->vics, sizeof(record->vics));
+    for (int i = 0; i < cta->audio_count && i < EDID_CTA_MAX_AUDIO; i++)
+    {
+        const struct edid_cta_audio *sad = &cta->audio[i];
+
+        record->audio[i][0] = (uint8_t)(((sad->format & 0x0F) << 3) | ((sad->channels - 1) & 0x07));
+        record->audio[i][1] = sad->sample_rates;
+        record->audio[i][2] = sad->detail;
+    }
+
+    record->displayid_version = displayid->version;
+    record->horizontal_tiles = displayid->tile.horizontal_tiles;
+    record->vertical_tiles = displayid->tile.vertical_tiles;
+    record->horizontal_tile_location = displayid->tile.horizontal_location;
+    record->vertical_tile_location = displayid->tile.vertical_location;
+    record->tile_width = displayid->tile.tile_width;
+    record->tile_height = displayid->tile.tile_height;
+}
+
+static void unpack_ext(const struct edid_record_ext *record, struct edid_ext_info *ext)
+{
+    struct edid_cta_info *cta = &ext->cta;
+    struct edid_displayid_info *displayid = &ext->displayid;
+
+    ext->block_count = record->block_count;
+    ext->blocks_decoded = record->blocks_decoded;
+    ext->bad_checksums = record->bad_checksums;
+
+    cta->present = (record->flags & EDID_RECORD_CTA) != 0;
+    cta->has_hdmi = (record->flags & EDID_RECORD_HDMI) != 0;
+    cta->has_hdmi_forum = (record->flags & EDID_RECORD_HDMI_FORUM) != 0;
+    cta->has_hdr_static = (record->flags & EDID_RECORD_HDR_STATIC) != 0;
+    cta->revision = record->cta_revision;
+    cta->flags = record->cta_flags;
+    cta->vic_count = record->vic_count;
+    cta->audio_count = record->audio_count;
+    cta->physical_address = record->physical_address;
+    cta->hdmi_max_tmds_mhz = record->hdmi_max_tmds_mhz;
+    cta->hdmi_forum_max_tmds_mhz = record->hdmi_forum_max_tmds_mhz;
+    cta->hdr_eotfs = record->hdr_eotfs;
+    cta->hdr_metadata_types = record->hdr_metadata_types;
+    cta->native_vics = record->native_vics;
+    memcpy(cta->vics, record->vics, sizeof(cta->vics));
+    for (int i = 0; i < record->audio_count; i++)
+    {
+        struct edid_cta_audio *sad = &cta->audio[i];
+
+        sad->format = (record->audio[i][0] >> 3) & 0x0F;
+        sad->channels = (record->audio[i][0] & 0x07) + 1;
+        sad->sample_rates = record->audio[i][1];
+        sad->detail = record->audio[i][2];
+    }
+
+    displayid->present = (record->flags & EDID_RECORD_DISPLAYID) != 0;
+    displayid->has_tile = (record->flags & EDID_RECORD_TILE) != 0;
+    displayid->version = record->displayid_version;
+    displayid->tile.horizontal_tiles = record->horizontal_tiles;
+    displayid->tile.vertical_tiles = record->vertical_tiles;
+    displayid->tile.horizontal_location = record->horizontal_tile_location;
+    displayid->tile.vertical_location = record->vertical_tile_location;
+    displayid->tile.tile_width = record->tile_width;
+    displayid->tile.tile_height = record->tile_height;
+}
+
+/**
+ * Writes the binary record for a decoded EDID.
+ *
+ * @param info Decoded base block
+ * @param ext Decoded extensions, or NULL to write the base record only
+ * @param out Destination buffer
+ * @param capacity Size of out; EDID_RECORD_MAX_SIZE always suffices
+ * @return Bytes written, or 0 if out is too small
+ */
+size_t edid_record_write(const struct edid_info *info, const struct edid_ext_info *ext, unsigned char *out, size_t capacity)
+{
+    struct edid_record record;
+    size_t length = sizeof(record) + (ext ? sizeof(struct edid_record_ext) : 0);
+
+    if (capacity < length)
+    {
+        return 0;
+    }
+
+    memset(&record, 0, sizeof(record));
+    record.magic = EDID_RECORD_MAGIC;
+    record.version = EDID_RECORD_VERSION;
+    record.flags = (info->header_valid ? EDID_RECORD_HEADER_VALID : 0) | (info->checksum_valid ? EDID_RECORD_CHECKSUM_VALID : 0) |
+                   (info->has_range_limits ? EDID_RECORD_RANGE_LIMITS : 0) | (ext ? EDID_RECORD_EXTENSIONS : 0);
+    record.length = (uint16_t)length;
+
+    record.serial_number = info->serial_number;
+    record.product_code = info->product_code;
+    record.manufacture_year = info->manufacture_year;
+    record.established_timings = info->established_timings;
+    record.status = info->status;
+    record.manufacture_week = info->manufacture_week;
+    memcpy(record.manufacturer_id, info->manufacturer_id, sizeof(record.manufacturer_id));
+    record.edid_version = info->version;
+    record.edid_revision = info->revision;
+    record.video_input = info->video_input;
+    record.digital = info->digital;
+    record.bit_depth = info->bit_depth;
+    record.interface = info->interface;
+    record.signal_level = info->signal_level;
+    record.video_setup = info->video_setup;
+    record.sync_types = info->sync_types;
+    record.horizontal_size_cm = info->horizontal_size_cm;
+    record.vertical_size_cm = info->vertical_size_cm;
+    record.gamma_encoded = info->gamma_encoded;
+    record.features = info->features;
+    record.display_type = info->display_type;
+    record.manufacturer_timings = info->manufacturer_timings;
+    if (info->header_valid)
+    {
+        pack_chromaticity(&info->chromaticity, record.chromaticity);
+
+        // Unused standard timing slots are 0x01 0x01
+        memset(record.standard_timings, 0x01, sizeof(record.standard_timings));
+        for (int i = 0; i < info->standard_timing_count && i < EDID_STANDARD_TIMING_COUNT; i++)
+        {
+            const struct edid_standard_timing *t = &info->standard_timings[i];
+
+            record.standard_timings[i][0] = (uint8_t)(t->horizontal_resolution / 8 - 31);
+            record.standard_timings[i][1] = (uint8_t)((t->aspect << 6) | ((t->vertical_frequency - 60) & 0x3F));
+        }
+        pack_descriptors(info, record.descriptors);
+    }
+
+#if RECORD_SWAP
+    swap_record(&record);
+#endif
+    memcpy(out, &record, sizeof(record));
+
+    if (ext)
+    {
+        struct edid_record_ext ext_record;
+
+        memset(&ext_record, 0, sizeof(ext_record));
+        pack_ext(ext, &ext_record);
+#if RECORD_SWAP
+        swap_record_ext(&ext_record);
+#endif
+        memcpy(out + sizeof(record), &ext_record, sizeof(ext_record));
+    }
+    return length;
+}
+
+/**
+ * Reads a binary record back into the decoded structures. Fields the record
+ * does not carry are left zero.
+ *
+ * @param data Record bytes
+ * @param length Bytes available in data
+ * @param info Structure to fill with the base block
+ * @param ext Structure to fill from the extension section, or NULL to skip it.
+ *            Zeroed if the record has no extension section.
+ * @return Length of the record, or 0 if it is truncated, not a version 1 record
+ *         or holds more VICs or audio descriptors than the structures do
+ */
+size_t edid_record_read(const unsigned char *data, size_t length, struct edid_info *info, struct edid_ext_info *ext)
+{
+    struct edid_record record;
+    struct edid_record_ext ext_record;
+
+    if (length < sizeof(record))
+    {
+        return 0;
+    }
+    memcpy(&record, data, sizeof(record));
+#if RECORD_SWAP
+    swap_record(&record);
+#endif
+
+    size_t record_length = sizeof(record) + ((record.flags & EDID_RECORD_EXTENSIONS) ? sizeof(struct edid_record_ext) : 0);
+    if (record.magic != EDID_RECORD_MAGIC || record.version != EDID_RECORD_VERSION || record.length != record_length ||
+        length < record_length)
+    {
+        return 0;
+    }
+    if (record.flags & EDID_RECORD_EXTENSIONS)
+    {
+        memcpy(&ext_record, data + sizeof(record), sizeof(ext_record));
+#if RECORD_SWAP
+        swap_record_ext(&ext_record);
+#endif
+        if (ext_record.vic_count > EDID_CTA_MAX_VICS || ext_record.audio_count > EDID_CTA_MAX_AUDIO)
+        {
+            return 0;
+        }
+    }
+
+    memset(info, 0, sizeof(*info));
+    info->header_valid = (record.flags & EDID_RECORD_HEADER_VALID) != 0;
+    info->checksum_valid = (record.flags & EDID_RECORD_CHECKSUM_VALID) != 0;
+    info->has_range_limits = (record.flags & EDID_RECORD_RANGE_LIMITS) != 0;
+
+    info->serial_number = record.serial_number;
+    info->product_code = record.product_code;
+    info->manufacture_year = record.manufacture_year;
+    info->established_timings = record.established_timings;
+    info->status = record.status;
+    info->manufacture_week = record.manufacture_week;
+    memcpy(info->manufacturer_id, record.manufacturer_id, sizeof(record.manufacturer_id));
+    info->version = record.edid_version;
+    info->revision = record.edid_revision;
+    info->video_input = record.video_input;
+    info->digital = record.digital;
+    info->bit_depth = record.bit_depth;
+    info->interface = record.interface;
+    info->signal_level = record.signal_level;
+    info->video_setup = record.video_setup;
+    info->sync_types = record.sync_types;
+    info->horizontal_size_cm = record.horizontal_size_cm;
+    info->vertical_size_cm = record.vertical_size_cm;
+    info->gamma_encoded = record.gamma_encoded;
+    info->features = record.features;
+    info->display_type = record.display_type;
+    info->manufacturer_timings = record.manufacturer_timings;
+    if (info->header_valid)
+    {
+        unpack_raw_fields(&record, info);
+    }
+
+    if (ext)
+    {
+        memset(ext, 0, sizeof(*ext));
+        if (record.flags & EDID_RECORD_EXTENSIONS)
+        {
+            unpack_ext(&ext_record, ext);
+        }
+    }
+    return record_length;
+}
@@ -0,0 +1,135 @@
+#include <string.h>
+#include <stdint.h>
+#include <io.h>
+#include "parser.h"
+#include "edid_regs.h"
+/**
+ * Burst writer placing decoded EDID records in the per-transmitter register windows
+ */
+
+_Static_assert(EDID_RECORD_MAX_SIZE <= EDID_REG_STRIDE, "a record with its extension section must fit one transmitter window");
+
+/**
+ * Backend for the Nios II HAL: one IOWR per word, addressed relative to the
+ * start of the burst so the bus sees consecutive registers.
+ */
+void edid_reg_iowr_burst(void *context, uint32_t address, const uint32_t *words, size_t count)
+{
+    (void)context;
+    for (size_t i = 0; i < count; i++)
+    {
+        IOWR(address, i, words[i]);
+    }
+}
+
+/**
+ * Backend writing into a struct edid_reg_region. Words outside the region are
+ * counted and dropped rather than written.
+ */
+void edid_reg_region_burst(void *context, uint32_t address, const uint32_t *words, size_t count)
+{
+    struct edid_reg_region *region = context;
+
+    if (address < region->origin || address - region->origin > region->size ||
+        count > (region->size - (address - region->origin)) / 4)
+    {
+        region->rejected += count;
+        return;
+    }
+
+    volatile uint32_t *dest = region->words + (address - region->origin) / 4;
+    for (size_t i = 0; i < count; i++)
+    {
+        dest[i] = words[i];
+    }
+}
+
+/**
+ * Prepares a sink for one transmitter's window.
+ *
+ * @param sink Sink to initialise
+ * @param burst Backend, e.g. edid_reg_iowr_burst or edid_reg_region_burst
+ * @param context Passed through to burst
+ * @param mem_base Address the register offsets are relative to, normally EDID_REG_MEM_BASE
+ * @param tx_id Transmitter whose window to write
+ */
+void edid_reg_sink_init(struct edid_reg_sink *sink, edid_reg_burst_fn burst, void *context, uint32_t mem_base,
+                        unsigned int tx_id)
+{
+    sink->burst = burst;
+    sink->context = context;
+    sink->base = mem_base + EDID_REG_WINDOW(tx_id);
+    sink->window = EDID_REG_STRIDE;
+    sink->words = 0;
+    sink->bursts = 0;
+}
+
+/**
+ * Copies bytes into the window as little-endian words, grouped into bursts
+ * that end on EDID_REG_BURST_BYTES boundaries. A trailing partial word is
+ * zero padded.
+ *
+ * @param sink Sink from edid_reg_sink_init()
+ * @param offset Byte offset in the window, a multiple of 4
+ * @param data Bytes to write
+ * @param length Number of bytes
+ * @return 1 on success, 0 if the write is misaligned or would leave the window
+ */
+int edid_reg_write(struct edid_reg_sink *sink, size_t offset, const void *data, size_t length)
+{
+    const unsigned char *bytes = data;
+    uint32_t burst[EDID_REG_BURST_WORDS];
+    size_t count = 0;
+    uint32_t start = sink->base + (uint32_t)offset;
+
+    if (offset % 4 != 0 || sink->base % 4 != 0 || offset > sink->window || length > sink->window - offset)
+    {
+        return 0;
+    }
+
+    for (size_t i = 0; i < length; i += 4)
+    {
+        uint32_t value = bytes[i];
+
+        if (i + 1 < length) value |= (uint32_t)bytes[i + 1] << 8;
+        if (i + 2 < length) value |= (uint32_t)bytes[i + 2] << 16;
+        if (i + 3 < length) value |= (uint32_t)bytes[i + 3] << 24;
+        burst[count++] = value;
+
+        uint32_t next = start + (uint32_t)count * 4;
+        if (count == EDID_REG_BURST_WORDS || next % EDID_REG_BURST_BYTES == 0 || i + 4 >= length)
+        {
+            sink->burst(sink->context, start, burst, count);
+            sink->words += count;
+            sink->bursts++;
+            start = next;
+            count = 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * Writes the binary record of a decoded EDID into the window. The first word,
+ * holding the record magic, is cleared before and written after the rest, so
+ * a reader that checks the magic never sees a half-written record. A record
+ * with its extension section always fits the window.
+ *
+ * @param sink Sink from edid_reg_sink_init()
+ * @param info Decoded base block
+ * @param ext Decoded extension blocks, or NULL to write the base record only
+ * @return Record length written, or 0 if nothing was written
+ */
+size_t edid_reg_write_record(struct edid_reg_sink *sink, const struct edid_info *info, const struct edid_ext_info *ext)
+{
+    unsigned char record[EDID_RECORD_MAX_SIZE];
+    static const unsigned char cleared[4] = {0};
+    size_t length = edid_record_write(info, ext, record, sizeof(record));
+
+    if (length == 0 || !edid_reg_write(sink, 0, cleared, sizeof(cleared)) ||
+        !edid_reg_write(sink, 4, record + 4, length - 4) || !edid_reg_write(sink, 0, record, 4))
+    {
+        return 0;
+    }
+    return length;
+}
@@ -0,0 +1,57 @@
+#ifndef EDID_REGS_H
+#define EDID_REGS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "parser.h"
+
+#define EDID_REG_STRIDE 0x180           // bytes between the parsed EDID windows of two transmitters
+#define EDID_REG_WINDOW(tx_id) (PARSED_EDID_0_REGISTER + (uint32_t)(tx_id) * EDID_REG_STRIDE)
+#define EDID_REG_BURST_WORDS 8          // longest burst, never crossing a burst-aligned boundary
+#define EDID_REG_BURST_BYTES (EDID_REG_BURST_WORDS * 4)
+
+#ifndef EDID_REG_MEM_BASE
+#define EDID_REG_MEM_BASE 0             // address the register offsets are relative to
+#endif
+
+/**
+ * Writes count 32-bit words to consecutive registers starting at address.
+ * address is 4-byte aligned and the words never cross an
+ * EDID_REG_BURST_BYTES boundary.
+ */
+typedef void (*edid_reg_burst_fn)(void *context, uint32_t address, const uint32_t *words, size_t count);
+
+/**
+ * Word-addressed memory standing in for the register space: a mapped device
+ * region, or a plain array when testing without the FPGA. Covers size bytes
+ * starting at register address origin.
+ */
+struct edid_reg_region
+{
+    volatile uint32_t *words;
+    uint32_t origin;
+    size_t size;
+    uint64_t rejected;                  // words that fell outside the region
+};
+
+/**
+ * Writer for one transmitter's parsed EDID window.
+ */
+struct edid_reg_sink
+{
+    edid_reg_burst_fn burst;
+    void *context;
+    uint32_t base;                      // register address of the window
+    size_t window;                      // bytes the window holds
+    uint64_t words;                     // words and bursts issued so far
+    uint64_t bursts;
+};
+
+void edid_reg_iowr_burst(void *context, uint32_t address, const uint32_t *words, size_t count);
+void edid_reg_region_burst(void *context, uint32_t address, const uint32_t *words, size_t count);
+void edid_reg_sink_init(struct edid_reg_sink *sink, edid_reg_burst_fn burst, void *context, uint32_t mem_base,
+                        unsigned int tx_id);
+int edid_reg_write(struct edid_reg_sink *sink, size_t offset, const void *data, size_t length);
+size_t edid_reg_write_record(struct edid_reg_sink *sink, const struct edid_info *info, const struct edid_ext_info *ext);
+
+#endif
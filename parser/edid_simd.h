@@ -0,0 +1,29 @@
+#ifndef EDID_SIMD_H
+#define EDID_SIMD_H
+
+/*
+ * Compile-time availability of the x86 vector paths. SSE2 is part of the
+ * x86-64 baseline; AVX2 code is compiled per function and only called after
+ * edid_cpu_features() reports EDID_CPU_AVX2.
+ */
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define EDID_HAVE_SSE2 1
+#include <emmintrin.h>
+#else
+#define EDID_HAVE_SSE2 0
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define EDID_HAVE_AVX2 1
+#define EDID_TARGET_AVX2 __attribute__((target("avx2")))
+#include <immintrin.h>
+#elif defined(_MSC_VER) && defined(_M_X64)
+#define EDID_HAVE_AVX2 1
+#define EDID_TARGET_AVX2
+#include <immintrin.h>
+#else
+#define EDID_HAVE_AVX2 0
+#endif
+
+#endif
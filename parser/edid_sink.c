@@ -0,0 +1,141 @@
+#include <string.h>
+#include <stdint.h>
+#include "parser.h"
+/**
+ * Bounded output writer used by all of the EDID text formatters
+ */
+
+/**
+ * Prepares a sink for writing.
+ *
+ * @param sink Sink to initialise
+ * @param buffer Destination buffer, or NULL to only measure the output
+ * @param capacity Size of buffer in bytes, including room for the terminating NUL
+ */
+void edid_sink_init(struct edid_sink *sink, char *buffer, size_t capacity)
+{
+    sink->buffer = buffer;
+    sink->capacity = buffer ? capacity : 0;
+    sink->length = 0;
+    sink->truncated = 0;
+
+    if (sink->capacity > 0)
+    {
+        sink->buffer[0] = '\0';
+    }
+}
+
+/**
+ * Appends len bytes to the sink. Bytes that do not fit are counted but dropped,
+ * and the buffer is always left NUL terminated.
+ *
+ * @param sink Sink to append to
+ * @param data Bytes to append
+ * @param len Number of bytes to append
+ */
+void edid_sink_write(struct edid_sink *sink, const char *data, size_t len)
+{
+    if (sink->capacity > 0)
+    {
+        size_t stored = sink->length < sink->capacity - 1 ? sink->length : sink->capacity - 1;
+        size_t room = sink->capacity - 1 - stored;
+        size_t copy = len < room ? len : room;
+
+        memcpy(sink->buffer + stored, data, copy);
+        sink->buffer[stored + copy] = '\0';
+        if (copy < len)
+        {
+            sink->truncated = 1;
+        }
+    }
+    else if (sink->buffer)
+    {
+        sink->truncated = 1;
+    }
+    sink->length += len;
+}
+
+/**
+ * Appends a NUL terminated string to the sink.
+ */
+void edid_sink_puts(struct edid_sink *sink, const char *str)
+{
+    edid_sink_write(sink, str, strlen(str));
+}
+
+/**
+ * Appends a single character to the sink.
+ */
+void edid_sink_putc(struct edid_sink *sink, char c)
+{
+    edid_sink_write(sink, &c, 1);
+}
+
+/**
+ * Appends an unsigned integer in decimal.
+ */
+void edid_sink_putu(struct edid_sink *sink, uint32_t value)
+{
+    char digits[10];
+    int pos = sizeof(digits);
+
+    do
+    {
+        digits[--pos] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+
+    edid_sink_write(sink, digits + pos, sizeof(digits) - pos);
+}
+
+/**
+ * Appends an unsigned integer as upper case hex, zero padded to width digits.
+ */
+void edid_sink_puthex(struct edid_sink *sink, uint32_t value, int width)
+{
+    static const char hex_digits[] = "0123456789ABCDEF";
+    char digits[8];
+    int pos = sizeof(digits);
+
+    do
+    {
+        digits[--pos] = hex_digits[value & 0x0F];
+        value >>= 4;
+    } while (value != 0 && pos > 0);
+
+    while (pos > (int)sizeof(digits) - width && pos > 0)
+    {
+        digits[--pos] = '0';
+    }
+
+    edid_sink_write(sink, digits + pos, sizeof(digits) - pos);
+}
+
+/**
+ * Appends a fixed-point value with up to 9 decimals, e.g. 59997 with 3 decimals as "59.997".
+ */
+void edid_sink_putfixed(struct edid_sink *sink, uint32_t value, int decimals)
+{
+    uint32_t scale = 1;
+    char digits[9];
+
+    for (int i = 0; i < decimals; i++)
+    {
+        scale *= 10;
+    }
+
+    edid_sink_putu(sink, value / scale);
+    if (decimals <= 0)
+    {
+        return;
+    }
+
+    uint32_t frac = value % scale;
+    for (int i = decimals - 1; i >= 0; i--)
+    {
+        digits[i] = (char)('0' + frac % 10);
+        frac /= 10;
+    }
+    edid_sink_putc(sink, '.');
+    edid_sink_write(sink, digits, decimals);
+}
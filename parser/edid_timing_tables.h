@@ -0,0 +1,1092 @@
+#ifndef EDID_TIMING_TABLES_H
+#define EDID_TIMING_TABLES_H
+
+/*
+ * Generated by tools/gen_timing_tables.c; do not edit.
+ */
+
+#include <stdint.h>
+
+struct edid_timing_line
+{
+    uint8_t length;
+    char text[34];
+};
+
+struct edid_standard_timing_entry
+{
+    uint16_t width;
+    uint16_t height;
+    uint8_t length;
+    char text[20];
+};
+
+// Report lines for the established timing bits, index 0 being bit 15
+static const struct edid_timing_line established_timing_lines[16] = {
+    {18, " - 720x400 @ 70Hz\n"},
+    {18, " - 720x400 @ 88Hz\n"},
+    {18, " - 640x480 @ 60Hz\n"},
+    {18, " - 640x480 @ 67Hz\n"},
+    {18, " - 640x480 @ 72Hz\n"},
+    {18, " - 640x480 @ 75Hz\n"},
+    {18, " - 800x600 @ 56Hz\n"},
+    {18, " - 800x600 @ 60Hz\n"},
+    {18, " - 800x600 @ 72Hz\n"},
+    {18, " - 800x600 @ 75Hz\n"},
+    {18, " - 832x624 @ 75Hz\n"},
+    {32, " - 1024x768 @ 87Hz (interlaced)\n"},
+    {19, " - 1024x768 @ 60Hz\n"},
+    {19, " - 1024x768 @ 70Hz\n"},
+    {19, " - 1024x768 @ 75Hz\n"},
+    {20, " - 1280x1024 @ 75Hz\n"},
+};
+
+// Number of leading zero bits of each byte value; 8 for zero
+static const uint8_t leading_zeros8[256] = {
+    8, 7, 6, 6, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+// Standard timings by [aspect bits][byte 1]: resolution and "W x H (aspect)"
+static const struct edid_standard_timing_entry standard_timing_table[4][256] = {
+    {
+        {248, 155, 17, "248 x 155 (16:10)"},
+        {256, 160, 17, "256 x 160 (16:10)"},
+        {264, 165, 17, "264 x 165 (16:10)"},
+        {272, 170, 17, "272 x 170 (16:10)"},
+        {280, 175, 17, "280 x 175 (16:10)"},
+        {288, 180, 17, "288 x 180 (16:10)"},
+        {296, 185, 17, "296 x 185 (16:10)"},
+        {304, 190, 17, "304 x 190 (16:10)"},
+        {312, 195, 17, "312 x 195 (16:10)"},
+        {320, 200, 17, "320 x 200 (16:10)"},
+        {328, 205, 17, "328 x 205 (16:10)"},
+        {336, 210, 17, "336 x 210 (16:10)"},
+        {344, 215, 17, "344 x 215 (16:10)"},
+        {352, 220, 17, "352 x 220 (16:10)"},
+        {360, 225, 17, "360 x 225 (16:10)"},
+        {368, 230, 17, "368 x 230 (16:10)"},
+        {376, 235, 17, "376 x 235 (16:10)"},
+        {384, 240, 17, "384 x 240 (16:10)"},
+        {392, 245, 17, "392 x 245 (16:10)"},
+        {400, 250, 17, "400 x 250 (16:10)"},
+        {408, 255, 17, "408 x 255 (16:10)"},
+        {416, 260, 17, "416 x 260 (16:10)"},
+        {424, 265, 17, "424 x 265 (16:10)"},
+        {432, 270, 17, "432 x 270 (16:10)"},
+        {440, 275, 17, "440 x 275 (16:10)"},
+        {448, 280, 17, "448 x 280 (16:10)"},
+        {456, 285, 17, "456 x 285 (16:10)"},
+        {464, 290, 17, "464 x 290 (16:10)"},
+        {472, 295, 17, "472 x 295 (16:10)"},
+        {480, 300, 17, "480 x 300 (16:10)"},
+        {488, 305, 17, "488 x 305 (16:10)"},
+        {496, 310, 17, "496 x 310 (16:10)"},
+        {504, 315, 17, "504 x 315 (16:10)"},
+        {512, 320, 17, "512 x 320 (16:10)"},
+        {520, 325, 17, "520 x 325 (16:10)"},
+        {528, 330, 17, "528 x 330 (16:10)"},
+        {536, 335, 17, "536 x 335 (16:10)"},
+        {544, 340, 17, "544 x 340 (16:10)"},
+        {552, 345, 17, "552 x 345 (16:10)"},
+        {560, 350, 17, "560 x 350 (16:10)"},
+        {568, 355, 17, "568 x 355 (16:10)"},
+        {576, 360, 17, "576 x 360 (16:10)"},
+        {584, 365, 17, "584 x 365 (16:10)"},
+        {592, 370, 17, "592 x 370 (16:10)"},
+        {600, 375, 17, "600 x 375 (16:10)"},
+        {608, 380, 17, "608 x 380 (16:10)"},
+        {616, 385, 17, "616 x 385 (16:10)"},
+        {624, 390, 17, "624 x 390 (16:10)"},
+        {632, 395, 17, "632 x 395 (16:10)"},
+        {640, 400, 17, "640 x 400 (16:10)"},
+        {648, 405, 17, "648 x 405 (16:10)"},
+        {656, 410, 17, "656 x 410 (16:10)"},
+        {664, 415, 17, "664 x 415 (16:10)"},
+        {672, 420, 17, "672 x 420 (16:10)"},
+        {680, 425, 17, "680 x 425 (16:10)"},
+        {688, 430, 17, "688 x 430 (16:10)"},
+        {696, 435, 17, "696 x 435 (16:10)"},
+        {704, 440, 17, "704 x 440 (16:10)"},
+        {712, 445, 17, "712 x 445 (16:10)"},
+        {720, 450, 17, "720 x 450 (16:10)"},
+        {728, 455, 17, "728 x 455 (16:10)"},
+        {736, 460, 17, "736 x 460 (16:10)"},
+        {744, 465, 17, "744 x 465 (16:10)"},
+        {752, 470, 17, "752 x 470 (16:10)"},
+        {760, 475, 17, "760 x 475 (16:10)"},
+        {768, 480, 17, "768 x 480 (16:10)"},
+        {776, 485, 17, "776 x 485 (16:10)"},
+        {784, 490, 17, "784 x 490 (16:10)"},
+        {792, 495, 17, "792 x 495 (16:10)"},
+        {800, 500, 17, "800 x 500 (16:10)"},
+        {808, 505, 17, "808 x 505 (16:10)"},
+        {816, 510, 17, "816 x 510 (16:10)"},
+        {824, 515, 17, "824 x 515 (16:10)"},
+        {832, 520, 17, "832 x 520 (16:10)"},
+        {840, 525, 17, "840 x 525 (16:10)"},
+        {848, 530, 17, "848 x 530 (16:10)"},
+        {856, 535, 17, "856 x 535 (16:10)"},
+        {864, 540, 17, "864 x 540 (16:10)"},
+        {872, 545, 17, "872 x 545 (16:10)"},
+        {880, 550, 17, "880 x 550 (16:10)"},
+        {888, 555, 17, "888 x 555 (16:10)"},
+        {896, 560, 17, "896 x 560 (16:10)"},
+        {904, 565, 17, "904 x 565 (16:10)"},
+        {912, 570, 17, "912 x 570 (16:10)"},
+        {920, 575, 17, "920 x 575 (16:10)"},
+        {928, 580, 17, "928 x 580 (16:10)"},
+        {936, 585, 17, "936 x 585 (16:10)"},
+        {944, 590, 17, "944 x 590 (16:10)"},
+        {952, 595, 17, "952 x 595 (16:10)"},
+        {960, 600, 17, "960 x 600 (16:10)"},
+        {968, 605, 17, "968 x 605 (16:10)"},
+        {976, 610, 17, "976 x 610 (16:10)"},
+        {984, 615, 17, "984 x 615 (16:10)"},
+        {992, 620, 17, "992 x 620 (16:10)"},
+        {1000, 625, 18, "1000 x 625 (16:10)"},
+        {1008, 630, 18, "1008 x 630 (16:10)"},
+        {1016, 635, 18, "1016 x 635 (16:10)"},
+        {1024, 640, 18, "1024 x 640 (16:10)"},
+        {1032, 645, 18, "1032 x 645 (16:10)"},
+        {1040, 650, 18, "1040 x 650 (16:10)"},
+        {1048, 655, 18, "1048 x 655 (16:10)"},
+        {1056, 660, 18, "1056 x 660 (16:10)"},
+        {1064, 665, 18, "1064 x 665 (16:10)"},
+        {1072, 670, 18, "1072 x 670 (16:10)"},
+        {1080, 675, 18, "1080 x 675 (16:10)"},
+        {1088, 680, 18, "1088 x 680 (16:10)"},
+        {1096, 685, 18, "1096 x 685 (16:10)"},
+        {1104, 690, 18, "1104 x 690 (16:10)"},
+        {1112, 695, 18, "1112 x 695 (16:10)"},
+        {1120, 700, 18, "1120 x 700 (16:10)"},
+        {1128, 705, 18, "1128 x 705 (16:10)"},
+        {1136, 710, 18, "1136 x 710 (16:10)"},
+        {1144, 715, 18, "1144 x 715 (16:10)"},
+        {1152, 720, 18, "1152 x 720 (16:10)"},
+        {1160, 725, 18, "1160 x 725 (16:10)"},
+        {1168, 730, 18, "1168 x 730 (16:10)"},
+        {1176, 735, 18, "1176 x 735 (16:10)"},
+        {1184, 740, 18, "1184 x 740 (16:10)"},
+        {1192, 745, 18, "1192 x 745 (16:10)"},
+        {1200, 750, 18, "1200 x 750 (16:10)"},
+        {1208, 755, 18, "1208 x 755 (16:10)"},
+        {1216, 760, 18, "1216 x 760 (16:10)"},
+        {1224, 765, 18, "1224 x 765 (16:10)"},
+        {1232, 770, 18, "1232 x 770 (16:10)"},
+        {1240, 775, 18, "1240 x 775 (16:10)"},
+        {1248, 780, 18, "1248 x 780 (16:10)"},
+        {1256, 785, 18, "1256 x 785 (16:10)"},
+        {1264, 790, 18, "1264 x 790 (16:10)"},
+        {1272, 795, 18, "1272 x 795 (16:10)"},
+        {1280, 800, 18, "1280 x 800 (16:10)"},
+        {1288, 805, 18, "1288 x 805 (16:10)"},
+        {1296, 810, 18, "1296 x 810 (16:10)"},
+        {1304, 815, 18, "1304 x 815 (16:10)"},
+        {1312, 820, 18, "1312 x 820 (16:10)"},
+        {1320, 825, 18, "1320 x 825 (16:10)"},
+        {1328, 830, 18, "1328 x 830 (16:10)"},
+        {1336, 835, 18, "1336 x 835 (16:10)"},
+        {1344, 840, 18, "1344 x 840 (16:10)"},
+        {1352, 845, 18, "1352 x 845 (16:10)"},
+        {1360, 850, 18, "1360 x 850 (16:10)"},
+        {1368, 855, 18, "1368 x 855 (16:10)"},
+        {1376, 860, 18, "1376 x 860 (16:10)"},
+        {1384, 865, 18, "1384 x 865 (16:10)"},
+        {1392, 870, 18, "1392 x 870 (16:10)"},
+        {1400, 875, 18, "1400 x 875 (16:10)"},
+        {1408, 880, 18, "1408 x 880 (16:10)"},
+        {1416, 885, 18, "1416 x 885 (16:10)"},
+        {1424, 890, 18, "1424 x 890 (16:10)"},
+        {1432, 895, 18, "1432 x 895 (16:10)"},
+        {1440, 900, 18, "1440 x 900 (16:10)"},
+        {1448, 905, 18, "1448 x 905 (16:10)"},
+        {1456, 910, 18, "1456 x 910 (16:10)"},
+        {1464, 915, 18, "1464 x 915 (16:10)"},
+        {1472, 920, 18, "1472 x 920 (16:10)"},
+        {1480, 925, 18, "1480 x 925 (16:10)"},
+        {1488, 930, 18, "1488 x 930 (16:10)"},
+        {1496, 935, 18, "1496 x 935 (16:10)"},
+        {1504, 940, 18, "1504 x 940 (16:10)"},
+        {1512, 945, 18, "1512 x 945 (16:10)"},
+        {1520, 950, 18, "1520 x 950 (16:10)"},
+        {1528, 955, 18, "1528 x 955 (16:10)"},
+        {1536, 960, 18, "1536 x 960 (16:10)"},
+        {1544, 965, 18, "1544 x 965 (16:10)"},
+        {1552, 970, 18, "1552 x 970 (16:10)"},
+        {1560, 975, 18, "1560 x 975 (16:10)"},
+        {1568, 980, 18, "1568 x 980 (16:10)"},
+        {1576, 985, 18, "1576 x 985 (16:10)"},
+        {1584, 990, 18, "1584 x 990 (16:10)"},
+        {1592, 995, 18, "1592 x 995 (16:10)"},
+        {1600, 1000, 19, "1600 x 1000 (16:10)"},
+        {1608, 1005, 19, "1608 x 1005 (16:10)"},
+        {1616, 1010, 19, "1616 x 1010 (16:10)"},
+        {1624, 1015, 19, "1624 x 1015 (16:10)"},
+        {1632, 1020, 19, "1632 x 1020 (16:10)"},
+        {1640, 1025, 19, "1640 x 1025 (16:10)"},
+        {1648, 1030, 19, "1648 x 1030 (16:10)"},
+        {1656, 1035, 19, "1656 x 1035 (16:10)"},
+        {1664, 1040, 19, "1664 x 1040 (16:10)"},
+        {1672, 1045, 19, "1672 x 1045 (16:10)"},
+        {1680, 1050, 19, "1680 x 1050 (16:10)"},
+        {1688, 1055, 19, "1688 x 1055 (16:10)"},
+        {1696, 1060, 19, "1696 x 1060 (16:10)"},
+        {1704, 1065, 19, "1704 x 1065 (16:10)"},
+        {1712, 1070, 19, "1712 x 1070 (16:10)"},
+        {1720, 1075, 19, "1720 x 1075 (16:10)"},
+        {1728, 1080, 19, "1728 x 1080 (16:10)"},
+        {1736, 1085, 19, "1736 x 1085 (16:10)"},
+        {1744, 1090, 19, "1744 x 1090 (16:10)"},
+        {1752, 1095, 19, "1752 x 1095 (16:10)"},
+        {1760, 1100, 19, "1760 x 1100 (16:10)"},
+        {1768, 1105, 19, "1768 x 1105 (16:10)"},
+        {1776, 1110, 19, "1776 x 1110 (16:10)"},
+        {1784, 1115, 19, "1784 x 1115 (16:10)"},
+        {1792, 1120, 19, "1792 x 1120 (16:10)"},
+        {1800, 1125, 19, "1800 x 1125 (16:10)"},
+        {1808, 1130, 19, "1808 x 1130 (16:10)"},
+        {1816, 1135, 19, "1816 x 1135 (16:10)"},
+        {1824, 1140, 19, "1824 x 1140 (16:10)"},
+        {1832, 1145, 19, "1832 x 1145 (16:10)"},
+        {1840, 1150, 19, "1840 x 1150 (16:10)"},
+        {1848, 1155, 19, "1848 x 1155 (16:10)"},
+        {1856, 1160, 19, "1856 x 1160 (16:10)"},
+        {1864, 1165, 19, "1864 x 1165 (16:10)"},
+        {1872, 1170, 19, "1872 x 1170 (16:10)"},
+        {1880, 1175, 19, "1880 x 1175 (16:10)"},
+        {1888, 1180, 19, "1888 x 1180 (16:10)"},
+        {1896, 1185, 19, "1896 x 1185 (16:10)"},
+        {1904, 1190, 19, "1904 x 1190 (16:10)"},
+        {1912, 1195, 19, "1912 x 1195 (16:10)"},
+        {1920, 1200, 19, "1920 x 1200 (16:10)"},
+        {1928, 1205, 19, "1928 x 1205 (16:10)"},
+        {1936, 1210, 19, "1936 x 1210 (16:10)"},
+        {1944, 1215, 19, "1944 x 1215 (16:10)"},
+        {1952, 1220, 19, "1952 x 1220 (16:10)"},
+        {1960, 1225, 19, "1960 x 1225 (16:10)"},
+        {1968, 1230, 19, "1968 x 1230 (16:10)"},
+        {1976, 1235, 19, "1976 x 1235 (16:10)"},
+        {1984, 1240, 19, "1984 x 1240 (16:10)"},
+        {1992, 1245, 19, "1992 x 1245 (16:10)"},
+        {2000, 1250, 19, "2000 x 1250 (16:10)"},
+        {2008, 1255, 19, "2008 x 1255 (16:10)"},
+        {2016, 1260, 19, "2016 x 1260 (16:10)"},
+        {2024, 1265, 19, "2024 x 1265 (16:10)"},
+        {2032, 1270, 19, "2032 x 1270 (16:10)"},
+        {2040, 1275, 19, "2040 x 1275 (16:10)"},
+        {2048, 1280, 19, "2048 x 1280 (16:10)"},
+        {2056, 1285, 19, "2056 x 1285 (16:10)"},
+        {2064, 1290, 19, "2064 x 1290 (16:10)"},
+        {2072, 1295, 19, "2072 x 1295 (16:10)"},
+        {2080, 1300, 19, "2080 x 1300 (16:10)"},
+        {2088, 1305, 19, "2088 x 1305 (16:10)"},
+        {2096, 1310, 19, "2096 x 1310 (16:10)"},
+        {2104, 1315, 19, "2104 x 1315 (16:10)"},
+        {2112, 1320, 19, "2112 x 1320 (16:10)"},
+        {2120, 1325, 19, "2120 x 1325 (16:10)"},
+        {2128, 1330, 19, "2128 x 1330 (16:10)"},
+        {2136, 1335, 19, "2136 x 1335 (16:10)"},
+        {2144, 1340, 19, "2144 x 1340 (16:10)"},
+        {2152, 1345, 19, "2152 x 1345 (16:10)"},
+        {2160, 1350, 19, "2160 x 1350 (16:10)"},
+        {2168, 1355, 19, "2168 x 1355 (16:10)"},
+        {2176, 1360, 19, "2176 x 1360 (16:10)"},
+        {2184, 1365, 19, "2184 x 1365 (16:10)"},
+        {2192, 1370, 19, "2192 x 1370 (16:10)"},
+        {2200, 1375, 19, "2200 x 1375 (16:10)"},
+        {2208, 1380, 19, "2208 x 1380 (16:10)"},
+        {2216, 1385, 19, "2216 x 1385 (16:10)"},
+        {2224, 1390, 19, "2224 x 1390 (16:10)"},
+        {2232, 1395, 19, "2232 x 1395 (16:10)"},
+        {2240, 1400, 19, "2240 x 1400 (16:10)"},
+        {2248, 1405, 19, "2248 x 1405 (16:10)"},
+        {2256, 1410, 19, "2256 x 1410 (16:10)"},
+        {2264, 1415, 19, "2264 x 1415 (16:10)"},
+        {2272, 1420, 19, "2272 x 1420 (16:10)"},
+        {2280, 1425, 19, "2280 x 1425 (16:10)"},
+        {2288, 1430, 19, "2288 x 1430 (16:10)"},
+    },
+    {
+        {248, 186, 15, "248 x 186 (4:3)"},
+        {256, 192, 15, "256 x 192 (4:3)"},
+        {264, 198, 15, "264 x 198 (4:3)"},
+        {272, 204, 15, "272 x 204 (4:3)"},
+        {280, 210, 15, "280 x 210 (4:3)"},
+        {288, 216, 15, "288 x 216 (4:3)"},
+        {296, 222, 15, "296 x 222 (4:3)"},
+        {304, 228, 15, "304 x 228 (4:3)"},
+        {312, 234, 15, "312 x 234 (4:3)"},
+        {320, 240, 15, "320 x 240 (4:3)"},
+        {328, 246, 15, "328 x 246 (4:3)"},
+        {336, 252, 15, "336 x 252 (4:3)"},
+        {344, 258, 15, "344 x 258 (4:3)"},
+        {352, 264, 15, "352 x 264 (4:3)"},
+        {360, 270, 15, "360 x 270 (4:3)"},
+        {368, 276, 15, "368 x 276 (4:3)"},
+        {376, 282, 15, "376 x 282 (4:3)"},
+        {384, 288, 15, "384 x 288 (4:3)"},
+        {392, 294, 15, "392 x 294 (4:3)"},
+        {400, 300, 15, "400 x 300 (4:3)"},
+        {408, 306, 15, "408 x 306 (4:3)"},
+        {416, 312, 15, "416 x 312 (4:3)"},
+        {424, 318, 15, "424 x 318 (4:3)"},
+        {432, 324, 15, "432 x 324 (4:3)"},
+        {440, 330, 15, "440 x 330 (4:3)"},
+        {448, 336, 15, "448 x 336 (4:3)"},
+        {456, 342, 15, "456 x 342 (4:3)"},
+        {464, 348, 15, "464 x 348 (4:3)"},
+        {472, 354, 15, "472 x 354 (4:3)"},
+        {480, 360, 15, "480 x 360 (4:3)"},
+        {488, 366, 15, "488 x 366 (4:3)"},
+        {496, 372, 15, "496 x 372 (4:3)"},
+        {504, 378, 15, "504 x 378 (4:3)"},
+        {512, 384, 15, "512 x 384 (4:3)"},
+        {520, 390, 15, "520 x 390 (4:3)"},
+        {528, 396, 15, "528 x 396 (4:3)"},
+        {536, 402, 15, "536 x 402 (4:3)"},
+        {544, 408, 15, "544 x 408 (4:3)"},
+        {552, 414, 15, "552 x 414 (4:3)"},
+        {560, 420, 15, "560 x 420 (4:3)"},
+        {568, 426, 15, "568 x 426 (4:3)"},
+        {576, 432, 15, "576 x 432 (4:3)"},
+        {584, 438, 15, "584 x 438 (4:3)"},
+        {592, 444, 15, "592 x 444 (4:3)"},
+        {600, 450, 15, "600 x 450 (4:3)"},
+        {608, 456, 15, "608 x 456 (4:3)"},
+        {616, 462, 15, "616 x 462 (4:3)"},
+        {624, 468, 15, "624 x 468 (4:3)"},
+        {632, 474, 15, "632 x 474 (4:3)"},
+        {640, 480, 15, "640 x 480 (4:3)"},
+        {648, 486, 15, "648 x 486 (4:3)"},
+        {656, 492, 15, "656 x 492 (4:3)"},
+        {664, 498, 15, "664 x 498 (4:3)"},
+        {672, 504, 15, "672 x 504 (4:3)"},
+        {680, 510, 15, "680 x 510 (4:3)"},
+        {688, 516, 15, "688 x 516 (4:3)"},
+        {696, 522, 15, "696 x 522 (4:3)"},
+        {704, 528, 15, "704 x 528 (4:3)"},
+        {712, 534, 15, "712 x 534 (4:3)"},
+        {720, 540, 15, "720 x 540 (4:3)"},
+        {728, 546, 15, "728 x 546 (4:3)"},
+        {736, 552, 15, "736 x 552 (4:3)"},
+        {744, 558, 15, "744 x 558 (4:3)"},
+        {752, 564, 15, "752 x 564 (4:3)"},
+        {760, 570, 15, "760 x 570 (4:3)"},
+        {768, 576, 15, "768 x 576 (4:3)"},
+        {776, 582, 15, "776 x 582 (4:3)"},
+        {784, 588, 15, "784 x 588 (4:3)"},
+        {792, 594, 15, "792 x 594 (4:3)"},
+        {800, 600, 15, "800 x 600 (4:3)"},
+        {808, 606, 15, "808 x 606 (4:3)"},
+        {816, 612, 15, "816 x 612 (4:3)"},
+        {824, 618, 15, "824 x 618 (4:3)"},
+        {832, 624, 15, "832 x 624 (4:3)"},
+        {840, 630, 15, "840 x 630 (4:3)"},
+        {848, 636, 15, "848 x 636 (4:3)"},
+        {856, 642, 15, "856 x 642 (4:3)"},
+        {864, 648, 15, "864 x 648 (4:3)"},
+        {872, 654, 15, "872 x 654 (4:3)"},
+        {880, 660, 15, "880 x 660 (4:3)"},
+        {888, 666, 15, "888 x 666 (4:3)"},
+        {896, 672, 15, "896 x 672 (4:3)"},
+        {904, 678, 15, "904 x 678 (4:3)"},
+        {912, 684, 15, "912 x 684 (4:3)"},
+        {920, 690, 15, "920 x 690 (4:3)"},
+        {928, 696, 15, "928 x 696 (4:3)"},
+        {936, 702, 15, "936 x 702 (4:3)"},
+        {944, 708, 15, "944 x 708 (4:3)"},
+        {952, 714, 15, "952 x 714 (4:3)"},
+        {960, 720, 15, "960 x 720 (4:3)"},
+        {968, 726, 15, "968 x 726 (4:3)"},
+        {976, 732, 15, "976 x 732 (4:3)"},
+        {984, 738, 15, "984 x 738 (4:3)"},
+        {992, 744, 15, "992 x 744 (4:3)"},
+        {1000, 750, 16, "1000 x 750 (4:3)"},
+        {1008, 756, 16, "1008 x 756 (4:3)"},
+        {1016, 762, 16, "1016 x 762 (4:3)"},
+        {1024, 768, 16, "1024 x 768 (4:3)"},
+        {1032, 774, 16, "1032 x 774 (4:3)"},
+        {1040, 780, 16, "1040 x 780 (4:3)"},
+        {1048, 786, 16, "1048 x 786 (4:3)"},
+        {1056, 792, 16, "1056 x 792 (4:3)"},
+        {1064, 798, 16, "1064 x 798 (4:3)"},
+        {1072, 804, 16, "1072 x 804 (4:3)"},
+        {1080, 810, 16, "1080 x 810 (4:3)"},
+        {1088, 816, 16, "1088 x 816 (4:3)"},
+        {1096, 822, 16, "1096 x 822 (4:3)"},
+        {1104, 828, 16, "1104 x 828 (4:3)"},
+        {1112, 834, 16, "1112 x 834 (4:3)"},
+        {1120, 840, 16, "1120 x 840 (4:3)"},
+        {1128, 846, 16, "1128 x 846 (4:3)"},
+        {1136, 852, 16, "1136 x 852 (4:3)"},
+        {1144, 858, 16, "1144 x 858 (4:3)"},
+        {1152, 864, 16, "1152 x 864 (4:3)"},
+        {1160, 870, 16, "1160 x 870 (4:3)"},
+        {1168, 876, 16, "1168 x 876 (4:3)"},
+        {1176, 882, 16, "1176 x 882 (4:3)"},
+        {1184, 888, 16, "1184 x 888 (4:3)"},
+        {1192, 894, 16, "1192 x 894 (4:3)"},
+        {1200, 900, 16, "1200 x 900 (4:3)"},
+        {1208, 906, 16, "1208 x 906 (4:3)"},
+        {1216, 912, 16, "1216 x 912 (4:3)"},
+        {1224, 918, 16, "1224 x 918 (4:3)"},
+        {1232, 924, 16, "1232 x 924 (4:3)"},
+        {1240, 930, 16, "1240 x 930 (4:3)"},
+        {1248, 936, 16, "1248 x 936 (4:3)"},
+        {1256, 942, 16, "1256 x 942 (4:3)"},
+        {1264, 948, 16, "1264 x 948 (4:3)"},
+        {1272, 954, 16, "1272 x 954 (4:3)"},
+        {1280, 960, 16, "1280 x 960 (4:3)"},
+        {1288, 966, 16, "1288 x 966 (4:3)"},
+        {1296, 972, 16, "1296 x 972 (4:3)"},
+        {1304, 978, 16, "1304 x 978 (4:3)"},
+        {1312, 984, 16, "1312 x 984 (4:3)"},
+        {1320, 990, 16, "1320 x 990 (4:3)"},
+        {1328, 996, 16, "1328 x 996 (4:3)"},
+        {1336, 1002, 17, "1336 x 1002 (4:3)"},
+        {1344, 1008, 17, "1344 x 1008 (4:3)"},
+        {1352, 1014, 17, "1352 x 1014 (4:3)"},
+        {1360, 1020, 17, "1360 x 1020 (4:3)"},
+        {1368, 1026, 17, "1368 x 1026 (4:3)"},
+        {1376, 1032, 17, "1376 x 1032 (4:3)"},
+        {1384, 1038, 17, "1384 x 1038 (4:3)"},
+        {1392, 1044, 17, "1392 x 1044 (4:3)"},
+        {1400, 1050, 17, "1400 x 1050 (4:3)"},
+        {1408, 1056, 17, "1408 x 1056 (4:3)"},
+        {1416, 1062, 17, "1416 x 1062 (4:3)"},
+        {1424, 1068, 17, "1424 x 1068 (4:3)"},
+        {1432, 1074, 17, "1432 x 1074 (4:3)"},
+        {1440, 1080, 17, "1440 x 1080 (4:3)"},
+        {1448, 1086, 17, "1448 x 1086 (4:3)"},
+        {1456, 1092, 17, "1456 x 1092 (4:3)"},
+        {1464, 1098, 17, "1464 x 1098 (4:3)"},
+        {1472, 1104, 17, "1472 x 1104 (4:3)"},
+        {1480, 1110, 17, "1480 x 1110 (4:3)"},
+        {1488, 1116, 17, "1488 x 1116 (4:3)"},
+        {1496, 1122, 17, "1496 x 1122 (4:3)"},
+        {1504, 1128, 17, "1504 x 1128 (4:3)"},
+        {1512, 1134, 17, "1512 x 1134 (4:3)"},
+        {1520, 1140, 17, "1520 x 1140 (4:3)"},
+        {1528, 1146, 17, "1528 x 1146 (4:3)"},
+        {1536, 1152, 17, "1536 x 1152 (4:3)"},
+        {1544, 1158, 17, "1544 x 1158 (4:3)"},
+        {1552, 1164, 17, "1552 x 1164 (4:3)"},
+        {1560, 1170, 17, "1560 x 1170 (4:3)"},
+        {1568, 1176, 17, "1568 x 1176 (4:3)"},
+        {1576, 1182, 17, "1576 x 1182 (4:3)"},
+        {1584, 1188, 17, "1584 x 1188 (4:3)"},
+        {1592, 1194, 17, "1592 x 1194 (4:3)"},
+        {1600, 1200, 17, "1600 x 1200 (4:3)"},
+        {1608, 1206, 17, "1608 x 1206 (4:3)"},
+        {1616, 1212, 17, "1616 x 1212 (4:3)"},
+        {1624, 1218, 17, "1624 x 1218 (4:3)"},
+        {1632, 1224, 17, "1632 x 1224 (4:3)"},
+        {1640, 1230, 17, "1640 x 1230 (4:3)"},
+        {1648, 1236, 17, "1648 x 1236 (4:3)"},
+        {1656, 1242, 17, "1656 x 1242 (4:3)"},
+        {1664, 1248, 17, "1664 x 1248 (4:3)"},
+        {1672, 1254, 17, "1672 x 1254 (4:3)"},
+        {1680, 1260, 17, "1680 x 1260 (4:3)"},
+        {1688, 1266, 17, "1688 x 1266 (4:3)"},
+        {1696, 1272, 17, "1696 x 1272 (4:3)"},
+        {1704, 1278, 17, "1704 x 1278 (4:3)"},
+        {1712, 1284, 17, "1712 x 1284 (4:3)"},
+        {1720, 1290, 17, "1720 x 1290 (4:3)"},
+        {1728, 1296, 17, "1728 x 1296 (4:3)"},
+        {1736, 1302, 17, "1736 x 1302 (4:3)"},
+        {1744, 1308, 17, "1744 x 1308 (4:3)"},
+        {1752, 1314, 17, "1752 x 1314 (4:3)"},
+        {1760, 1320, 17, "1760 x 1320 (4:3)"},
+        {1768, 1326, 17, "1768 x 1326 (4:3)"},
+        {1776, 1332, 17, "1776 x 1332 (4:3)"},
+        {1784, 1338, 17, "1784 x 1338 (4:3)"},
+        {1792, 1344, 17, "1792 x 1344 (4:3)"},
+        {1800, 1350, 17, "1800 x 1350 (4:3)"},
+        {1808, 1356, 17, "1808 x 1356 (4:3)"},
+        {1816, 1362, 17, "1816 x 1362 (4:3)"},
+        {1824, 1368, 17, "1824 x 1368 (4:3)"},
+        {1832, 1374, 17, "1832 x 1374 (4:3)"},
+        {1840, 1380, 17, "1840 x 1380 (4:3)"},
+        {1848, 1386, 17, "1848 x 1386 (4:3)"},
+        {1856, 1392, 17, "1856 x 1392 (4:3)"},
+        {1864, 1398, 17, "1864 x 1398 (4:3)"},
+        {1872, 1404, 17, "1872 x 1404 (4:3)"},
+        {1880, 1410, 17, "1880 x 1410 (4:3)"},
+        {1888, 1416, 17, "1888 x 1416 (4:3)"},
+        {1896, 1422, 17, "1896 x 1422 (4:3)"},
+        {1904, 1428, 17, "1904 x 1428 (4:3)"},
+        {1912, 1434, 17, "1912 x 1434 (4:3)"},
+        {1920, 1440, 17, "1920 x 1440 (4:3)"},
+        {1928, 1446, 17, "1928 x 1446 (4:3)"},
+        {1936, 1452, 17, "1936 x 1452 (4:3)"},
+        {1944, 1458, 17, "1944 x 1458 (4:3)"},
+        {1952, 1464, 17, "1952 x 1464 (4:3)"},
+        {1960, 1470, 17, "1960 x 1470 (4:3)"},
+        {1968, 1476, 17, "1968 x 1476 (4:3)"},
+        {1976, 1482, 17, "1976 x 1482 (4:3)"},
+        {1984, 1488, 17, "1984 x 1488 (4:3)"},
+        {1992, 1494, 17, "1992 x 1494 (4:3)"},
+        {2000, 1500, 17, "2000 x 1500 (4:3)"},
+        {2008, 1506, 17, "2008 x 1506 (4:3)"},
+        {2016, 1512, 17, "2016 x 1512 (4:3)"},
+        {2024, 1518, 17, "2024 x 1518 (4:3)"},
+        {2032, 1524, 17, "2032 x 1524 (4:3)"},
+        {2040, 1530, 17, "2040 x 1530 (4:3)"},
+        {2048, 1536, 17, "2048 x 1536 (4:3)"},
+        {2056, 1542, 17, "2056 x 1542 (4:3)"},
+        {2064, 1548, 17, "2064 x 1548 (4:3)"},
+        {2072, 1554, 17, "2072 x 1554 (4:3)"},
+        {2080, 1560, 17, "2080 x 1560 (4:3)"},
+        {2088, 1566, 17, "2088 x 1566 (4:3)"},
+        {2096, 1572, 17, "2096 x 1572 (4:3)"},
+        {2104, 1578, 17, "2104 x 1578 (4:3)"},
+        {2112, 1584, 17, "2112 x 1584 (4:3)"},
+        {2120, 1590, 17, "2120 x 1590 (4:3)"},
+        {2128, 1596, 17, "2128 x 1596 (4:3)"},
+        {2136, 1602, 17, "2136 x 1602 (4:3)"},
+        {2144, 1608, 17, "2144 x 1608 (4:3)"},
+        {2152, 1614, 17, "2152 x 1614 (4:3)"},
+        {2160, 1620, 17, "2160 x 1620 (4:3)"},
+        {2168, 1626, 17, "2168 x 1626 (4:3)"},
+        {2176, 1632, 17, "2176 x 1632 (4:3)"},
+        {2184, 1638, 17, "2184 x 1638 (4:3)"},
+        {2192, 1644, 17, "2192 x 1644 (4:3)"},
+        {2200, 1650, 17, "2200 x 1650 (4:3)"},
+        {2208, 1656, 17, "2208 x 1656 (4:3)"},
+        {2216, 1662, 17, "2216 x 1662 (4:3)"},
+        {2224, 1668, 17, "2224 x 1668 (4:3)"},
+        {2232, 1674, 17, "2232 x 1674 (4:3)"},
+        {2240, 1680, 17, "2240 x 1680 (4:3)"},
+        {2248, 1686, 17, "2248 x 1686 (4:3)"},
+        {2256, 1692, 17, "2256 x 1692 (4:3)"},
+        {2264, 1698, 17, "2264 x 1698 (4:3)"},
+        {2272, 1704, 17, "2272 x 1704 (4:3)"},
+        {2280, 1710, 17, "2280 x 1710 (4:3)"},
+        {2288, 1716, 17, "2288 x 1716 (4:3)"},
+    },
+    {
+        {248, 198, 15, "248 x 198 (5:4)"},
+        {256, 204, 15, "256 x 204 (5:4)"},
+        {264, 211, 15, "264 x 211 (5:4)"},
+        {272, 217, 15, "272 x 217 (5:4)"},
+        {280, 224, 15, "280 x 224 (5:4)"},
+        {288, 230, 15, "288 x 230 (5:4)"},
+        {296, 236, 15, "296 x 236 (5:4)"},
+        {304, 243, 15, "304 x 243 (5:4)"},
+        {312, 249, 15, "312 x 249 (5:4)"},
+        {320, 256, 15, "320 x 256 (5:4)"},
+        {328, 262, 15, "328 x 262 (5:4)"},
+        {336, 268, 15, "336 x 268 (5:4)"},
+        {344, 275, 15, "344 x 275 (5:4)"},
+        {352, 281, 15, "352 x 281 (5:4)"},
+        {360, 288, 15, "360 x 288 (5:4)"},
+        {368, 294, 15, "368 x 294 (5:4)"},
+        {376, 300, 15, "376 x 300 (5:4)"},
+        {384, 307, 15, "384 x 307 (5:4)"},
+        {392, 313, 15, "392 x 313 (5:4)"},
+        {400, 320, 15, "400 x 320 (5:4)"},
+        {408, 326, 15, "408 x 326 (5:4)"},
+        {416, 332, 15, "416 x 332 (5:4)"},
+        {424, 339, 15, "424 x 339 (5:4)"},
+        {432, 345, 15, "432 x 345 (5:4)"},
+        {440, 352, 15, "440 x 352 (5:4)"},
+        {448, 358, 15, "448 x 358 (5:4)"},
+        {456, 364, 15, "456 x 364 (5:4)"},
+        {464, 371, 15, "464 x 371 (5:4)"},
+        {472, 377, 15, "472 x 377 (5:4)"},
+        {480, 384, 15, "480 x 384 (5:4)"},
+        {488, 390, 15, "488 x 390 (5:4)"},
+        {496, 396, 15, "496 x 396 (5:4)"},
+        {504, 403, 15, "504 x 403 (5:4)"},
+        {512, 409, 15, "512 x 409 (5:4)"},
+        {520, 416, 15, "520 x 416 (5:4)"},
+        {528, 422, 15, "528 x 422 (5:4)"},
+        {536, 428, 15, "536 x 428 (5:4)"},
+        {544, 435, 15, "544 x 435 (5:4)"},
+        {552, 441, 15, "552 x 441 (5:4)"},
+        {560, 448, 15, "560 x 448 (5:4)"},
+        {568, 454, 15, "568 x 454 (5:4)"},
+        {576, 460, 15, "576 x 460 (5:4)"},
+        {584, 467, 15, "584 x 467 (5:4)"},
+        {592, 473, 15, "592 x 473 (5:4)"},
+        {600, 480, 15, "600 x 480 (5:4)"},
+        {608, 486, 15, "608 x 486 (5:4)"},
+        {616, 492, 15, "616 x 492 (5:4)"},
+        {624, 499, 15, "624 x 499 (5:4)"},
+        {632, 505, 15, "632 x 505 (5:4)"},
+        {640, 512, 15, "640 x 512 (5:4)"},
+        {648, 518, 15, "648 x 518 (5:4)"},
+        {656, 524, 15, "656 x 524 (5:4)"},
+        {664, 531, 15, "664 x 531 (5:4)"},
+        {672, 537, 15, "672 x 537 (5:4)"},
+        {680, 544, 15, "680 x 544 (5:4)"},
+        {688, 550, 15, "688 x 550 (5:4)"},
+        {696, 556, 15, "696 x 556 (5:4)"},
+        {704, 563, 15, "704 x 563 (5:4)"},
+        {712, 569, 15, "712 x 569 (5:4)"},
+        {720, 576, 15, "720 x 576 (5:4)"},
+        {728, 582, 15, "728 x 582 (5:4)"},
+        {736, 588, 15, "736 x 588 (5:4)"},
+        {744, 595, 15, "744 x 595 (5:4)"},
+        {752, 601, 15, "752 x 601 (5:4)"},
+        {760, 608, 15, "760 x 608 (5:4)"},
+        {768, 614, 15, "768 x 614 (5:4)"},
+        {776, 620, 15, "776 x 620 (5:4)"},
+        {784, 627, 15, "784 x 627 (5:4)"},
+        {792, 633, 15, "792 x 633 (5:4)"},
+        {800, 640, 15, "800 x 640 (5:4)"},
+        {808, 646, 15, "808 x 646 (5:4)"},
+        {816, 652, 15, "816 x 652 (5:4)"},
+        {824, 659, 15, "824 x 659 (5:4)"},
+        {832, 665, 15, "832 x 665 (5:4)"},
+        {840, 672, 15, "840 x 672 (5:4)"},
+        {848, 678, 15, "848 x 678 (5:4)"},
+        {856, 684, 15, "856 x 684 (5:4)"},
+        {864, 691, 15, "864 x 691 (5:4)"},
+        {872, 697, 15, "872 x 697 (5:4)"},
+        {880, 704, 15, "880 x 704 (5:4)"},
+        {888, 710, 15, "888 x 710 (5:4)"},
+        {896, 716, 15, "896 x 716 (5:4)"},
+        {904, 723, 15, "904 x 723 (5:4)"},
+        {912, 729, 15, "912 x 729 (5:4)"},
+        {920, 736, 15, "920 x 736 (5:4)"},
+        {928, 742, 15, "928 x 742 (5:4)"},
+        {936, 748, 15, "936 x 748 (5:4)"},
+        {944, 755, 15, "944 x 755 (5:4)"},
+        {952, 761, 15, "952 x 761 (5:4)"},
+        {960, 768, 15, "960 x 768 (5:4)"},
+        {968, 774, 15, "968 x 774 (5:4)"},
+        {976, 780, 15, "976 x 780 (5:4)"},
+        {984, 787, 15, "984 x 787 (5:4)"},
+        {992, 793, 15, "992 x 793 (5:4)"},
+        {1000, 800, 16, "1000 x 800 (5:4)"},
+        {1008, 806, 16, "1008 x 806 (5:4)"},
+        {1016, 812, 16, "1016 x 812 (5:4)"},
+        {1024, 819, 16, "1024 x 819 (5:4)"},
+        {1032, 825, 16, "1032 x 825 (5:4)"},
+        {1040, 832, 16, "1040 x 832 (5:4)"},
+        {1048, 838, 16, "1048 x 838 (5:4)"},
+        {1056, 844, 16, "1056 x 844 (5:4)"},
+        {1064, 851, 16, "1064 x 851 (5:4)"},
+        {1072, 857, 16, "1072 x 857 (5:4)"},
+        {1080, 864, 16, "1080 x 864 (5:4)"},
+        {1088, 870, 16, "1088 x 870 (5:4)"},
+        {1096, 876, 16, "1096 x 876 (5:4)"},
+        {1104, 883, 16, "1104 x 883 (5:4)"},
+        {1112, 889, 16, "1112 x 889 (5:4)"},
+        {1120, 896, 16, "1120 x 896 (5:4)"},
+        {1128, 902, 16, "1128 x 902 (5:4)"},
+        {1136, 908, 16, "1136 x 908 (5:4)"},
+        {1144, 915, 16, "1144 x 915 (5:4)"},
+        {1152, 921, 16, "1152 x 921 (5:4)"},
+        {1160, 928, 16, "1160 x 928 (5:4)"},
+        {1168, 934, 16, "1168 x 934 (5:4)"},
+        {1176, 940, 16, "1176 x 940 (5:4)"},
+        {1184, 947, 16, "1184 x 947 (5:4)"},
+        {1192, 953, 16, "1192 x 953 (5:4)"},
+        {1200, 960, 16, "1200 x 960 (5:4)"},
+        {1208, 966, 16, "1208 x 966 (5:4)"},
+        {1216, 972, 16, "1216 x 972 (5:4)"},
+        {1224, 979, 16, "1224 x 979 (5:4)"},
+        {1232, 985, 16, "1232 x 985 (5:4)"},
+        {1240, 992, 16, "1240 x 992 (5:4)"},
+        {1248, 998, 16, "1248 x 998 (5:4)"},
+        {1256, 1004, 17, "1256 x 1004 (5:4)"},
+        {1264, 1011, 17, "1264 x 1011 (5:4)"},
+        {1272, 1017, 17, "1272 x 1017 (5:4)"},
+        {1280, 1024, 17, "1280 x 1024 (5:4)"},
+        {1288, 1030, 17, "1288 x 1030 (5:4)"},
+        {1296, 1036, 17, "1296 x 1036 (5:4)"},
+        {1304, 1043, 17, "1304 x 1043 (5:4)"},
+        {1312, 1049, 17, "1312 x 1049 (5:4)"},
+        {1320, 1056, 17, "1320 x 1056 (5:4)"},
+        {1328, 1062, 17, "1328 x 1062 (5:4)"},
+        {1336, 1068, 17, "1336 x 1068 (5:4)"},
+        {1344, 1075, 17, "1344 x 1075 (5:4)"},
+        {1352, 1081, 17, "1352 x 1081 (5:4)"},
+        {1360, 1088, 17, "1360 x 1088 (5:4)"},
+        {1368, 1094, 17, "1368 x 1094 (5:4)"},
+        {1376, 1100, 17, "1376 x 1100 (5:4)"},
+        {1384, 1107, 17, "1384 x 1107 (5:4)"},
+        {1392, 1113, 17, "1392 x 1113 (5:4)"},
+        {1400, 1120, 17, "1400 x 1120 (5:4)"},
+        {1408, 1126, 17, "1408 x 1126 (5:4)"},
+        {1416, 1132, 17, "1416 x 1132 (5:4)"},
+        {1424, 1139, 17, "1424 x 1139 (5:4)"},
+        {1432, 1145, 17, "1432 x 1145 (5:4)"},
+        {1440, 1152, 17, "1440 x 1152 (5:4)"},
+        {1448, 1158, 17, "1448 x 1158 (5:4)"},
+        {1456, 1164, 17, "1456 x 1164 (5:4)"},
+        {1464, 1171, 17, "1464 x 1171 (5:4)"},
+        {1472, 1177, 17, "1472 x 1177 (5:4)"},
+        {1480, 1184, 17, "1480 x 1184 (5:4)"},
+        {1488, 1190, 17, "1488 x 1190 (5:4)"},
+        {1496, 1196, 17, "1496 x 1196 (5:4)"},
+        {1504, 1203, 17, "1504 x 1203 (5:4)"},
+        {1512, 1209, 17, "1512 x 1209 (5:4)"},
+        {1520, 1216, 17, "1520 x 1216 (5:4)"},
+        {1528, 1222, 17, "1528 x 1222 (5:4)"},
+        {1536, 1228, 17, "1536 x 1228 (5:4)"},
+        {1544, 1235, 17, "1544 x 1235 (5:4)"},
+        {1552, 1241, 17, "1552 x 1241 (5:4)"},
+        {1560, 1248, 17, "1560 x 1248 (5:4)"},
+        {1568, 1254, 17, "1568 x 1254 (5:4)"},
+        {1576, 1260, 17, "1576 x 1260 (5:4)"},
+        {1584, 1267, 17, "1584 x 1267 (5:4)"},
+        {1592, 1273, 17, "1592 x 1273 (5:4)"},
+        {1600, 1280, 17, "1600 x 1280 (5:4)"},
+        {1608, 1286, 17, "1608 x 1286 (5:4)"},
+        {1616, 1292, 17, "1616 x 1292 (5:4)"},
+        {1624, 1299, 17, "1624 x 1299 (5:4)"},
+        {1632, 1305, 17, "1632 x 1305 (5:4)"},
+        {1640, 1312, 17, "1640 x 1312 (5:4)"},
+        {1648, 1318, 17, "1648 x 1318 (5:4)"},
+        {1656, 1324, 17, "1656 x 1324 (5:4)"},
+        {1664, 1331, 17, "1664 x 1331 (5:4)"},
+        {1672, 1337, 17, "1672 x 1337 (5:4)"},
+        {1680, 1344, 17, "1680 x 1344 (5:4)"},
+        {1688, 1350, 17, "1688 x 1350 (5:4)"},
+        {1696, 1356, 17, "1696 x 1356 (5:4)"},
+        {1704, 1363, 17, "1704 x 1363 (5:4)"},
+        {1712, 1369, 17, "1712 x 1369 (5:4)"},
+        {1720, 1376, 17, "1720 x 1376 (5:4)"},
+        {1728, 1382, 17, "1728 x 1382 (5:4)"},
+        {1736, 1388, 17, "1736 x 1388 (5:4)"},
+        {1744, 1395, 17, "1744 x 1395 (5:4)"},
+        {1752, 1401, 17, "1752 x 1401 (5:4)"},
+        {1760, 1408, 17, "1760 x 1408 (5:4)"},
+        {1768, 1414, 17, "1768 x 1414 (5:4)"},
+        {1776, 1420, 17, "1776 x 1420 (5:4)"},
+        {1784, 1427, 17, "1784 x 1427 (5:4)"},
+        {1792, 1433, 17, "1792 x 1433 (5:4)"},
+        {1800, 1440, 17, "1800 x 1440 (5:4)"},
+        {1808, 1446, 17, "1808 x 1446 (5:4)"},
+        {1816, 1452, 17, "1816 x 1452 (5:4)"},
+        {1824, 1459, 17, "1824 x 1459 (5:4)"},
+        {1832, 1465, 17, "1832 x 1465 (5:4)"},
+        {1840, 1472, 17, "1840 x 1472 (5:4)"},
+        {1848, 1478, 17, "1848 x 1478 (5:4)"},
+        {1856, 1484, 17, "1856 x 1484 (5:4)"},
+        {1864, 1491, 17, "1864 x 1491 (5:4)"},
+        {1872, 1497, 17, "1872 x 1497 (5:4)"},
+        {1880, 1504, 17, "1880 x 1504 (5:4)"},
+        {1888, 1510, 17, "1888 x 1510 (5:4)"},
+        {1896, 1516, 17, "1896 x 1516 (5:4)"},
+        {1904, 1523, 17, "1904 x 1523 (5:4)"},
+        {1912, 1529, 17, "1912 x 1529 (5:4)"},
+        {1920, 1536, 17, "1920 x 1536 (5:4)"},
+        {1928, 1542, 17, "1928 x 1542 (5:4)"},
+        {1936, 1548, 17, "1936 x 1548 (5:4)"},
+        {1944, 1555, 17, "1944 x 1555 (5:4)"},
+        {1952, 1561, 17, "1952 x 1561 (5:4)"},
+        {1960, 1568, 17, "1960 x 1568 (5:4)"},
+        {1968, 1574, 17, "1968 x 1574 (5:4)"},
+        {1976, 1580, 17, "1976 x 1580 (5:4)"},
+        {1984, 1587, 17, "1984 x 1587 (5:4)"},
+        {1992, 1593, 17, "1992 x 1593 (5:4)"},
+        {2000, 1600, 17, "2000 x 1600 (5:4)"},
+        {2008, 1606, 17, "2008 x 1606 (5:4)"},
+        {2016, 1612, 17, "2016 x 1612 (5:4)"},
+        {2024, 1619, 17, "2024 x 1619 (5:4)"},
+        {2032, 1625, 17, "2032 x 1625 (5:4)"},
+        {2040, 1632, 17, "2040 x 1632 (5:4)"},
+        {2048, 1638, 17, "2048 x 1638 (5:4)"},
+        {2056, 1644, 17, "2056 x 1644 (5:4)"},
+        {2064, 1651, 17, "2064 x 1651 (5:4)"},
+        {2072, 1657, 17, "2072 x 1657 (5:4)"},
+        {2080, 1664, 17, "2080 x 1664 (5:4)"},
+        {2088, 1670, 17, "2088 x 1670 (5:4)"},
+        {2096, 1676, 17, "2096 x 1676 (5:4)"},
+        {2104, 1683, 17, "2104 x 1683 (5:4)"},
+        {2112, 1689, 17, "2112 x 1689 (5:4)"},
+        {2120, 1696, 17, "2120 x 1696 (5:4)"},
+        {2128, 1702, 17, "2128 x 1702 (5:4)"},
+        {2136, 1708, 17, "2136 x 1708 (5:4)"},
+        {2144, 1715, 17, "2144 x 1715 (5:4)"},
+        {2152, 1721, 17, "2152 x 1721 (5:4)"},
+        {2160, 1728, 17, "2160 x 1728 (5:4)"},
+        {2168, 1734, 17, "2168 x 1734 (5:4)"},
+        {2176, 1740, 17, "2176 x 1740 (5:4)"},
+        {2184, 1747, 17, "2184 x 1747 (5:4)"},
+        {2192, 1753, 17, "2192 x 1753 (5:4)"},
+        {2200, 1760, 17, "2200 x 1760 (5:4)"},
+        {2208, 1766, 17, "2208 x 1766 (5:4)"},
+        {2216, 1772, 17, "2216 x 1772 (5:4)"},
+        {2224, 1779, 17, "2224 x 1779 (5:4)"},
+        {2232, 1785, 17, "2232 x 1785 (5:4)"},
+        {2240, 1792, 17, "2240 x 1792 (5:4)"},
+        {2248, 1798, 17, "2248 x 1798 (5:4)"},
+        {2256, 1804, 17, "2256 x 1804 (5:4)"},
+        {2264, 1811, 17, "2264 x 1811 (5:4)"},
+        {2272, 1817, 17, "2272 x 1817 (5:4)"},
+        {2280, 1824, 17, "2280 x 1824 (5:4)"},
+        {2288, 1830, 17, "2288 x 1830 (5:4)"},
+    },
+    {
+        {248, 139, 16, "248 x 139 (16:9)"},
+        {256, 144, 16, "256 x 144 (16:9)"},
+        {264, 148, 16, "264 x 148 (16:9)"},
+        {272, 153, 16, "272 x 153 (16:9)"},
+        {280, 157, 16, "280 x 157 (16:9)"},
+        {288, 162, 16, "288 x 162 (16:9)"},
+        {296, 166, 16, "296 x 166 (16:9)"},
+        {304, 171, 16, "304 x 171 (16:9)"},
+        {312, 175, 16, "312 x 175 (16:9)"},
+        {320, 180, 16, "320 x 180 (16:9)"},
+        {328, 184, 16, "328 x 184 (16:9)"},
+        {336, 189, 16, "336 x 189 (16:9)"},
+        {344, 193, 16, "344 x 193 (16:9)"},
+        {352, 198, 16, "352 x 198 (16:9)"},
+        {360, 202, 16, "360 x 202 (16:9)"},
+        {368, 207, 16, "368 x 207 (16:9)"},
+        {376, 211, 16, "376 x 211 (16:9)"},
+        {384, 216, 16, "384 x 216 (16:9)"},
+        {392, 220, 16, "392 x 220 (16:9)"},
+        {400, 225, 16, "400 x 225 (16:9)"},
+        {408, 229, 16, "408 x 229 (16:9)"},
+        {416, 234, 16, "416 x 234 (16:9)"},
+        {424, 238, 16, "424 x 238 (16:9)"},
+        {432, 243, 16, "432 x 243 (16:9)"},
+        {440, 247, 16, "440 x 247 (16:9)"},
+        {448, 252, 16, "448 x 252 (16:9)"},
+        {456, 256, 16, "456 x 256 (16:9)"},
+        {464, 261, 16, "464 x 261 (16:9)"},
+        {472, 265, 16, "472 x 265 (16:9)"},
+        {480, 270, 16, "480 x 270 (16:9)"},
+        {488, 274, 16, "488 x 274 (16:9)"},
+        {496, 279, 16, "496 x 279 (16:9)"},
+        {504, 283, 16, "504 x 283 (16:9)"},
+        {512, 288, 16, "512 x 288 (16:9)"},
+        {520, 292, 16, "520 x 292 (16:9)"},
+        {528, 297, 16, "528 x 297 (16:9)"},
+        {536, 301, 16, "536 x 301 (16:9)"},
+        {544, 306, 16, "544 x 306 (16:9)"},
+        {552, 310, 16, "552 x 310 (16:9)"},
+        {560, 315, 16, "560 x 315 (16:9)"},
+        {568, 319, 16, "568 x 319 (16:9)"},
+        {576, 324, 16, "576 x 324 (16:9)"},
+        {584, 328, 16, "584 x 328 (16:9)"},
+        {592, 333, 16, "592 x 333 (16:9)"},
+        {600, 337, 16, "600 x 337 (16:9)"},
+        {608, 342, 16, "608 x 342 (16:9)"},
+        {616, 346, 16, "616 x 346 (16:9)"},
+        {624, 351, 16, "624 x 351 (16:9)"},
+        {632, 355, 16, "632 x 355 (16:9)"},
+        {640, 360, 16, "640 x 360 (16:9)"},
+        {648, 364, 16, "648 x 364 (16:9)"},
+        {656, 369, 16, "656 x 369 (16:9)"},
+        {664, 373, 16, "664 x 373 (16:9)"},
+        {672, 378, 16, "672 x 378 (16:9)"},
+        {680, 382, 16, "680 x 382 (16:9)"},
+        {688, 387, 16, "688 x 387 (16:9)"},
+        {696, 391, 16, "696 x 391 (16:9)"},
+        {704, 396, 16, "704 x 396 (16:9)"},
+        {712, 400, 16, "712 x 400 (16:9)"},
+        {720, 405, 16, "720 x 405 (16:9)"},
+        {728, 409, 16, "728 x 409 (16:9)"},
+        {736, 414, 16, "736 x 414 (16:9)"},
+        {744, 418, 16, "744 x 418 (16:9)"},
+        {752, 423, 16, "752 x 423 (16:9)"},
+        {760, 427, 16, "760 x 427 (16:9)"},
+        {768, 432, 16, "768 x 432 (16:9)"},
+        {776, 436, 16, "776 x 436 (16:9)"},
+        {784, 441, 16, "784 x 441 (16:9)"},
+        {792, 445, 16, "792 x 445 (16:9)"},
+        {800, 450, 16, "800 x 450 (16:9)"},
+        {808, 454, 16, "808 x 454 (16:9)"},
+        {816, 459, 16, "816 x 459 (16:9)"},
+        {824, 463, 16, "824 x 463 (16:9)"},
+        {832, 468, 16, "832 x 468 (16:9)"},
+        {840, 472, 16, "840 x 472 (16:9)"},
+        {848, 477, 16, "848 x 477 (16:9)"},
+        {856, 481, 16, "856 x 481 (16:9)"},
+        {864, 486, 16, "864 x 486 (16:9)"},
+        {872, 490, 16, "872 x 490 (16:9)"},
+        {880, 495, 16, "880 x 495 (16:9)"},
+        {888, 499, 16, "888 x 499 (16:9)"},
+        {896, 504, 16, "896 x 504 (16:9)"},
+        {904, 508, 16, "904 x 508 (16:9)"},
+        {912, 513, 16, "912 x 513 (16:9)"},
+        {920, 517, 16, "920 x 517 (16:9)"},
+        {928, 522, 16, "928 x 522 (16:9)"},
+        {936, 526, 16, "936 x 526 (16:9)"},
+        {944, 531, 16, "944 x 531 (16:9)"},
+        {952, 535, 16, "952 x 535 (16:9)"},
+        {960, 540, 16, "960 x 540 (16:9)"},
+        {968, 544, 16, "968 x 544 (16:9)"},
+        {976, 549, 16, "976 x 549 (16:9)"},
+        {984, 553, 16, "984 x 553 (16:9)"},
+        {992, 558, 16, "992 x 558 (16:9)"},
+        {1000, 562, 17, "1000 x 562 (16:9)"},
+        {1008, 567, 17, "1008 x 567 (16:9)"},
+        {1016, 571, 17, "1016 x 571 (16:9)"},
+        {1024, 576, 17, "1024 x 576 (16:9)"},
+        {1032, 580, 17, "1032 x 580 (16:9)"},
+        {1040, 585, 17, "1040 x 585 (16:9)"},
+        {1048, 589, 17, "1048 x 589 (16:9)"},
+        {1056, 594, 17, "1056 x 594 (16:9)"},
+        {1064, 598, 17, "1064 x 598 (16:9)"},
+        {1072, 603, 17, "1072 x 603 (16:9)"},
+        {1080, 607, 17, "1080 x 607 (16:9)"},
+        {1088, 612, 17, "1088 x 612 (16:9)"},
+        {1096, 616, 17, "1096 x 616 (16:9)"},
+        {1104, 621, 17, "1104 x 621 (16:9)"},
+        {1112, 625, 17, "1112 x 625 (16:9)"},
+        {1120, 630, 17, "1120 x 630 (16:9)"},
+        {1128, 634, 17, "1128 x 634 (16:9)"},
+        {1136, 639, 17, "1136 x 639 (16:9)"},
+        {1144, 643, 17, "1144 x 643 (16:9)"},
+        {1152, 648, 17, "1152 x 648 (16:9)"},
+        {1160, 652, 17, "1160 x 652 (16:9)"},
+        {1168, 657, 17, "1168 x 657 (16:9)"},
+        {1176, 661, 17, "1176 x 661 (16:9)"},
+        {1184, 666, 17, "1184 x 666 (16:9)"},
+        {1192, 670, 17, "1192 x 670 (16:9)"},
+        {1200, 675, 17, "1200 x 675 (16:9)"},
+        {1208, 679, 17, "1208 x 679 (16:9)"},
+        {1216, 684, 17, "1216 x 684 (16:9)"},
+        {1224, 688, 17, "1224 x 688 (16:9)"},
+        {1232, 693, 17, "1232 x 693 (16:9)"},
+        {1240, 697, 17, "1240 x 697 (16:9)"},
+        {1248, 702, 17, "1248 x 702 (16:9)"},
+        {1256, 706, 17, "1256 x 706 (16:9)"},
+        {1264, 711, 17, "1264 x 711 (16:9)"},
+        {1272, 715, 17, "1272 x 715 (16:9)"},
+        {1280, 720, 17, "1280 x 720 (16:9)"},
+        {1288, 724, 17, "1288 x 724 (16:9)"},
+        {1296, 729, 17, "1296 x 729 (16:9)"},
+        {1304, 733, 17, "1304 x 733 (16:9)"},
+        {1312, 738, 17, "1312 x 738 (16:9)"},
+        {1320, 742, 17, "1320 x 742 (16:9)"},
+        {1328, 747, 17, "1328 x 747 (16:9)"},
+        {1336, 751, 17, "1336 x 751 (16:9)"},
+        {1344, 756, 17, "1344 x 756 (16:9)"},
+        {1352, 760, 17, "1352 x 760 (16:9)"},
+        {1360, 765, 17, "1360 x 765 (16:9)"},
+        {1368, 769, 17, "1368 x 769 (16:9)"},
+        {1376, 774, 17, "1376 x 774 (16:9)"},
+        {1384, 778, 17, "1384 x 778 (16:9)"},
+        {1392, 783, 17, "1392 x 783 (16:9)"},
+        {1400, 787, 17, "1400 x 787 (16:9)"},
+        {1408, 792, 17, "1408 x 792 (16:9)"},
+        {1416, 796, 17, "1416 x 796 (16:9)"},
+        {1424, 801, 17, "1424 x 801 (16:9)"},
+        {1432, 805, 17, "1432 x 805 (16:9)"},
+        {1440, 810, 17, "1440 x 810 (16:9)"},
+        {1448, 814, 17, "1448 x 814 (16:9)"},
+        {1456, 819, 17, "1456 x 819 (16:9)"},
+        {1464, 823, 17, "1464 x 823 (16:9)"},
+        {1472, 828, 17, "1472 x 828 (16:9)"},
+        {1480, 832, 17, "1480 x 832 (16:9)"},
+        {1488, 837, 17, "1488 x 837 (16:9)"},
+        {1496, 841, 17, "1496 x 841 (16:9)"},
+        {1504, 846, 17, "1504 x 846 (16:9)"},
+        {1512, 850, 17, "1512 x 850 (16:9)"},
+        {1520, 855, 17, "1520 x 855 (16:9)"},
+        {1528, 859, 17, "1528 x 859 (16:9)"},
+        {1536, 864, 17, "1536 x 864 (16:9)"},
+        {1544, 868, 17, "1544 x 868 (16:9)"},
+        {1552, 873, 17, "1552 x 873 (16:9)"},
+        {1560, 877, 17, "1560 x 877 (16:9)"},
+        {1568, 882, 17, "1568 x 882 (16:9)"},
+        {1576, 886, 17, "1576 x 886 (16:9)"},
+        {1584, 891, 17, "1584 x 891 (16:9)"},
+        {1592, 895, 17, "1592 x 895 (16:9)"},
+        {1600, 900, 17, "1600 x 900 (16:9)"},
+        {1608, 904, 17, "1608 x 904 (16:9)"},
+        {1616, 909, 17, "1616 x 909 (16:9)"},
+        {1624, 913, 17, "1624 x 913 (16:9)"},
+        {1632, 918, 17, "1632 x 918 (16:9)"},
+        {1640, 922, 17, "1640 x 922 (16:9)"},
+        {1648, 927, 17, "1648 x 927 (16:9)"},
+        {1656, 931, 17, "1656 x 931 (16:9)"},
+        {1664, 936, 17, "1664 x 936 (16:9)"},
+        {1672, 940, 17, "1672 x 940 (16:9)"},
+        {1680, 945, 17, "1680 x 945 (16:9)"},
+        {1688, 949, 17, "1688 x 949 (16:9)"},
+        {1696, 954, 17, "1696 x 954 (16:9)"},
+        {1704, 958, 17, "1704 x 958 (16:9)"},
+        {1712, 963, 17, "1712 x 963 (16:9)"},
+        {1720, 967, 17, "1720 x 967 (16:9)"},
+        {1728, 972, 17, "1728 x 972 (16:9)"},
+        {1736, 976, 17, "1736 x 976 (16:9)"},
+        {1744, 981, 17, "1744 x 981 (16:9)"},
+        {1752, 985, 17, "1752 x 985 (16:9)"},
+        {1760, 990, 17, "1760 x 990 (16:9)"},
+        {1768, 994, 17, "1768 x 994 (16:9)"},
+        {1776, 999, 17, "1776 x 999 (16:9)"},
+        {1784, 1003, 18, "1784 x 1003 (16:9)"},
+        {1792, 1008, 18, "1792 x 1008 (16:9)"},
+        {1800, 1012, 18, "1800 x 1012 (16:9)"},
+        {1808, 1017, 18, "1808 x 1017 (16:9)"},
+        {1816, 1021, 18, "1816 x 1021 (16:9)"},
+        {1824, 1026, 18, "1824 x 1026 (16:9)"},
+        {1832, 1030, 18, "1832 x 1030 (16:9)"},
+        {1840, 1035, 18, "1840 x 1035 (16:9)"},
+        {1848, 1039, 18, "1848 x 1039 (16:9)"},
+        {1856, 1044, 18, "1856 x 1044 (16:9)"},
+        {1864, 1048, 18, "1864 x 1048 (16:9)"},
+        {1872, 1053, 18, "1872 x 1053 (16:9)"},
+        {1880, 1057, 18, "1880 x 1057 (16:9)"},
+        {1888, 1062, 18, "1888 x 1062 (16:9)"},
+        {1896, 1066, 18, "1896 x 1066 (16:9)"},
+        {1904, 1071, 18, "1904 x 1071 (16:9)"},
+        {1912, 1075, 18, "1912 x 1075 (16:9)"},
+        {1920, 1080, 18, "1920 x 1080 (16:9)"},
+        {1928, 1084, 18, "1928 x 1084 (16:9)"},
+        {1936, 1089, 18, "1936 x 1089 (16:9)"},
+        {1944, 1093, 18, "1944 x 1093 (16:9)"},
+        {1952, 1098, 18, "1952 x 1098 (16:9)"},
+        {1960, 1102, 18, "1960 x 1102 (16:9)"},
+        {1968, 1107, 18, "1968 x 1107 (16:9)"},
+        {1976, 1111, 18, "1976 x 1111 (16:9)"},
+        {1984, 1116, 18, "1984 x 1116 (16:9)"},
+        {1992, 1120, 18, "1992 x 1120 (16:9)"},
+        {2000, 1125, 18, "2000 x 1125 (16:9)"},
+        {2008, 1129, 18, "2008 x 1129 (16:9)"},
+        {2016, 1134, 18, "2016 x 1134 (16:9)"},
+        {2024, 1138, 18, "2024 x 1138 (16:9)"},
+        {2032, 1143, 18, "2032 x 1143 (16:9)"},
+        {2040, 1147, 18, "2040 x 1147 (16:9)"},
+        {2048, 1152, 18, "2048 x 1152 (16:9)"},
+        {2056, 1156, 18, "2056 x 1156 (16:9)"},
+        {2064, 1161, 18, "2064 x 1161 (16:9)"},
+        {2072, 1165, 18, "2072 x 1165 (16:9)"},
+        {2080, 1170, 18, "2080 x 1170 (16:9)"},
+        {2088, 1174, 18, "2088 x 1174 (16:9)"},
+        {2096, 1179, 18, "2096 x 1179 (16:9)"},
+        {2104, 1183, 18, "2104 x 1183 (16:9)"},
+        {2112, 1188, 18, "2112 x 1188 (16:9)"},
+        {2120, 1192, 18, "2120 x 1192 (16:9)"},
+        {2128, 1197, 18, "2128 x 1197 (16:9)"},
+        {2136, 1201, 18, "2136 x 1201 (16:9)"},
+        {2144, 1206, 18, "2144 x 1206 (16:9)"},
+        {2152, 1210, 18, "2152 x 1210 (16:9)"},
+        {2160, 1215, 18, "2160 x 1215 (16:9)"},
+        {2168, 1219, 18, "2168 x 1219 (16:9)"},
+        {2176, 1224, 18, "2176 x 1224 (16:9)"},
+        {2184, 1228, 18, "2184 x 1228 (16:9)"},
+        {2192, 1233, 18, "2192 x 1233 (16:9)"},
+        {2200, 1237, 18, "2200 x 1237 (16:9)"},
+        {2208, 1242, 18, "2208 x 1242 (16:9)"},
+        {2216, 1246, 18, "2216 x 1246 (16:9)"},
+        {2224, 1251, 18, "2224 x 1251 (16:9)"},
+        {2232, 1255, 18, "2232 x 1255 (16:9)"},
+        {2240, 1260, 18, "2240 x 1260 (16:9)"},
+        {2248, 1264, 18, "2248 x 1264 (16:9)"},
+        {2256, 1269, 18, "2256 x 1269 (16:9)"},
+        {2264, 1273, 18, "2264 x 1273 (16:9)"},
+        {2272, 1278, 18, "2272 x 1278 (16:9)"},
+        {2280, 1282, 18, "2280 x 1282 (16:9)"},
+        {2288, 1287, 18, "2288 x 1287 (16:9)"},
+    },
+};
+
+#endif
@@ -0,0 +1,243 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <sched.h>
+#include "parser.h"
+#include "edid_regs.h"
+#include "edid_tx.h"
+/**
+ * Hotplug manager keeping the decoded EDID of every transmitter channel published
+ */
+
+/**
+ * Prepares a manager with idle channels and an empty queue.
+ *
+ * @param manager Manager to initialise; release it with edid_tx_free()
+ * @param channel_count Number of channels, tx_id 0 to channel_count - 1, at most EDID_TX_MAX_CHANNELS
+ * @param queue_size Events the queue holds, rounded up to a power of two, or 0 for EDID_TX_DEFAULT_QUEUE
+ * @param burst Register backend the channels publish through
+ * @param context Passed through to burst
+ * @param mem_base Address the register offsets are relative to
+ * @return 1 on success, 0 on bad arguments or allocation failure
+ */
+int edid_tx_init(struct edid_tx_manager *manager, unsigned int channel_count, size_t queue_size, edid_reg_burst_fn burst,
+                 void *context, uint32_t mem_base)
+{
+    size_t ring = 2;
+
+    memset(manager, 0, sizeof(*manager));
+    if (channel_count == 0 || channel_count > EDID_TX_MAX_CHANNELS)
+    {
+        return 0;
+    }
+    while (ring < (queue_size ? queue_size : EDID_TX_DEFAULT_QUEUE))
+    {
+        ring *= 2;
+    }
+
+    manager->slots = calloc(channel_count, sizeof(*manager->slots));
+    manager->events = malloc(ring * sizeof(*manager->events));
+    if (!manager->slots || !manager->events)
+    {
+        edid_tx_free(manager);
+        return 0;
+    }
+
+    manager->channel_count = channel_count;
+    for (unsigned int i = 0; i < channel_count; i++)
+    {
+        atomic_flag_clear(&manager->slots[i].busy);
+        atomic_init(&manager->slots[i].submitted, 0);
+        edid_reg_sink_init(&manager->slots[i].sink, burst, context, mem_base, i);
+    }
+
+    manager->event_mask = ring - 1;
+    for (size_t i = 0; i < ring; i++)
+    {
+        atomic_init(&manager->events[i].sequence, i);
+    }
+    atomic_init(&manager->enqueue_pos, 0);
+    atomic_init(&manager->dequeue_pos, 0);
+    atomic_init(&manager->rejected, 0);
+    return 1;
+}
+
+void edid_tx_free(struct edid_tx_manager *manager)
+{
+    free(manager->slots);
+    free(manager->events);
+    memset(manager, 0, sizeof(*manager));
+}
+
+/**
+ * Queues a hotplug event. Safe to call from any number of threads.
+ *
+ * @param manager Manager from edid_tx_init()
+ * @param tx_id Channel that reported the EDID
+ * @param data EDID read from the sink, copied into the queue
+ * @param length Number of bytes, from EDID_LENGTH to EDID_TX_MAX_LENGTH
+ * @return 1 if queued, 0 if the arguments are out of range or the queue is full
+ */
+int edid_tx_submit(struct edid_tx_manager *manager, unsigned int tx_id, const unsigned char *data, size_t length)
+{
+    struct edid_tx_event *event;
+    size_t pos = atomic_load_explicit(&manager->enqueue_pos, memory_order_relaxed);
+
+    if (tx_id >= manager->channel_count || length < EDID_LENGTH || length > EDID_TX_MAX_LENGTH)
+    {
+        return 0;
+    }
+
+    // Bounded MPMC ring: a cell is free for position pos once its sequence equals pos
+    for (;;)
+    {
+        event = &manager->events[pos & manager->event_mask];
+        size_t sequence = atomic_load_explicit(&event->sequence, memory_order_acquire);
+        intptr_t lag = (intptr_t)sequence - (intptr_t)pos;
+
+        if (lag == 0)
+        {
+            if (atomic_compare_exchange_weak_explicit(&manager->enqueue_pos, &pos, pos + 1, memory_order_relaxed,
+                                                      memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (lag < 0)
+        {
+            atomic_fetch_add_explicit(&manager->rejected, 1, memory_order_relaxed);
+            return 0;
+        }
+        else
+        {
+            pos = atomic_load_explicit(&manager->enqueue_pos, memory_order_relaxed);
+        }
+    }
+
+    event->tx_id = tx_id;
+    event->serial = atomic_fetch_add_explicit(&manager->slots[tx_id].submitted, 1, memory_order_relaxed) + 1;
+    event->length = length;
+    memcpy(event->data, data, length);
+    atomic_store_explicit(&event->sequence, pos + 1, memory_order_release);
+    return 1;
+}
+
+#define EDID_TX_SPIN_LIMIT 64    // pauses before a blocked worker yields its time slice
+
+/**
+ * Takes a channel's lock. The holder may have been preempted mid-decode, so
+ * after a short spin the waiter yields instead of burning its time slice.
+ */
+static void lock_slot(struct edid_tx_slot *slot)
+{
+    unsigned int spins = 0;
+
+    while (atomic_flag_test_and_set_explicit(&slot->busy, memory_order_acquire))
+    {
+        if (++spins < EDID_TX_SPIN_LIMIT)
+        {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+            __builtin_ia32_pause();
+#endif
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+}
+
+/**
+ * Brings a channel up to date with one event. Identical bytes are neither
+ * decoded nor written again; changed bytes are decoded incrementally with
+ * edid_reparse() and the record is written to the channel's window.
+ */
+static void apply_event(struct edid_tx_slot *slot, const struct edid_tx_event *event)
+{
+    lock_slot(slot);
+
+    // Two workers may take a channel's events out of order; only the newest counts
+    if ((int32_t)(event->serial - slot->applied) <= 0)
+    {
+        slot->stale++;
+    }
+    else if (slot->length == event->length && memcmp(slot->data, event->data, event->length) == 0)
+    {
+        slot->applied = event->serial;
+        slot->unchanged++;
+    }
+    else
+    {
+        slot->applied = event->serial;
+        if (slot->length)
+        {
+            edid_reparse(slot->data, slot->length, event->data, event->length, &slot->info, &slot->ext);
+        }
+        else
+        {
+            parse_edid_struct(event->data, &slot->info);
+            parse_edid_extensions(event->data, event->length, &slot->ext);
+        }
+        memcpy(slot->data, event->data, event->length);
+        slot->length = event->length;
+        slot->decodes++;
+
+        if (!edid_reg_write_record(&slot->sink, &slot->info, slot->ext.block_count ? &slot->ext : NULL))
+        {
+            // Forget the bytes so the next event for the channel writes again
+            slot->length = 0;
+            slot->write_failures++;
+        }
+    }
+
+    atomic_flag_clear_explicit(&slot->busy, memory_order_release);
+}
+
+/**
+ * Applies queued events until the queue is empty. Safe to call from any
+ * number of worker threads.
+ *
+ * @param manager Manager from edid_tx_init()
+ * @param max_events Stop after this many events, or 0 for no limit
+ * @return Number of events applied
+ */
+size_t edid_tx_process(struct edid_tx_manager *manager, size_t max_events)
+{
+    size_t processed = 0;
+
+    while (max_events == 0 || processed < max_events)
+    {
+        struct edid_tx_event *event;
+        size_t pos = atomic_load_explicit(&manager->dequeue_pos, memory_order_relaxed);
+
+        for (;;)
+        {
+            event = &manager->events[pos & manager->event_mask];
+            size_t sequence = atomic_load_explicit(&event->sequence, memory_order_acquire);
+            intptr_t lag = (intptr_t)sequence - (intptr_t)(pos + 1);
+
+            if (lag == 0)
+            {
+                if (atomic_compare_exchange_weak_explicit(&manager->dequeue_pos, &pos, pos + 1, memory_order_relaxed,
+                                                          memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (lag < 0)
+            {
+                return processed;
+            }
+            else
+            {
+                pos = atomic_load_explicit(&manager->dequeue_pos, memory_order_relaxed);
+            }
+        }
+
+        apply_event(&manager->slots[event->tx_id], event);
+        atomic_store_explicit(&event->sequence, pos + manager->event_mask + 1, memory_order_release);
+        processed++;
+    }
+    return processed;
+}
@@ -0,0 +1,71 @@
+#ifndef EDID_TX_H
+#define EDID_TX_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include "parser.h"
+#include "edid_regs.h"
+
+#define EDID_TX_MAX_CHANNELS 64
+#define EDID_TX_MAX_LENGTH (EDID_LENGTH * EDID_MAX_BLOCKS)  // longest EDID a hotplug event carries
+#define EDID_TX_DEFAULT_QUEUE 256
+
+/**
+ * State of one transmitter channel: the EDID it last reported, the decoded
+ * result and the register window it is published to.
+ */
+struct edid_tx_slot
+{
+    atomic_flag busy;                   // held by the worker applying an event
+    _Atomic uint32_t submitted;         // serial of the latest event queued for the channel
+    uint32_t applied;                   // serial of the latest event applied
+    size_t length;                      // bytes in data, 0 until the first EDID
+    unsigned char data[EDID_TX_MAX_LENGTH];
+    struct edid_info info;
+    struct edid_ext_info ext;
+    struct edid_reg_sink sink;
+
+    uint64_t decodes;                   // events whose bytes changed and were decoded
+    uint64_t unchanged;                 // events with the bytes already published
+    uint64_t stale;                     // events overtaken by a later one for the channel
+    uint64_t write_failures;
+};
+
+/**
+ * One queued hotplug event. sequence orders the cell in the ring; the rest is
+ * owned by whoever claimed the cell.
+ */
+struct edid_tx_event
+{
+    _Atomic size_t sequence;
+    unsigned int tx_id;
+    uint32_t serial;
+    size_t length;
+    unsigned char data[EDID_TX_MAX_LENGTH];
+};
+
+/**
+ * Hotplug manager for a set of transmitter channels. Any number of threads
+ * may submit events and any number may process them: the queue is a bounded
+ * lock-free ring, and each channel is only updated by one worker at a time.
+ */
+struct edid_tx_manager
+{
+    struct edid_tx_slot *slots;
+    unsigned int channel_count;
+    struct edid_tx_event *events;
+    size_t event_mask;                  // ring size - 1
+    _Atomic size_t enqueue_pos;
+    char pad[64 - sizeof(size_t)];      // keep producers and consumers on separate cache lines
+    _Atomic size_t dequeue_pos;
+    _Atomic uint64_t rejected;          // events refused because the queue was full
+};
+
+int edid_tx_init(struct edid_tx_manager *manager, unsigned int channel_count, size_t queue_size, edid_reg_burst_fn burst,
+                 void *context, uint32_t mem_base);
+void edid_tx_free(struct edid_tx_manager *manager);
+int edid_tx_submit(struct edid_tx_manager *manager, unsigned int tx_id, const unsigned char *data, size_t length);
+size_t edid_tx_process(struct edid_tx_manager *manager, size_t max_events);
+
+#endif
@@ -0,0 +1,161 @@
+#include <string.h>
+#include <stdint.h>
+#include "parser.h"
+#include "edid_simd.h"
+/**
+ * Header and checksum checks over runs of 128-byte blocks
+ */
+
+static const uint8_t edid_header[8] = {0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00};
+
+#if !EDID_HAVE_SSE2
+#define BYTE_LANES 0x00FF00FF00FF00FFull
+
+/**
+ * Sums the 128 bytes of a block eight at a time. Alternate bytes are added in
+ * 16-bit lanes, which cannot overflow over 16 words, and only the low 8 bits
+ * of the total matter.
+ */
+static uint8_t block_sum_scalar(const uint8_t *block)
+{
+    uint64_t lanes = 0;
+
+    for (int i = 0; i < EDID_LENGTH; i += 8)
+    {
+        uint64_t word;
+
+        memcpy(&word, block + i, sizeof(word));
+        lanes += (word & BYTE_LANES) + ((word >> 8) & BYTE_LANES);
+    }
+
+    lanes += lanes >> 32;
+    lanes += lanes >> 16;
+    return (uint8_t)lanes;
+}
+#endif
+
+#if EDID_HAVE_SSE2
+/**
+ * Adds the eight 16-byte rows bytewise (wrapping is harmless mod 256), then
+ * sums the 16 column bytes with one horizontal SAD.
+ */
+static uint8_t block_sum_sse2(const uint8_t *block)
+{
+    const __m128i *rows = (const __m128i *)block;
+    __m128i sum = _mm_add_epi8(_mm_add_epi8(_mm_loadu_si128(rows + 0), _mm_loadu_si128(rows + 1)),
+                               _mm_add_epi8(_mm_loadu_si128(rows + 2), _mm_loadu_si128(rows + 3)));
+    sum = _mm_add_epi8(sum, _mm_add_epi8(_mm_add_epi8(_mm_loadu_si128(rows + 4), _mm_loadu_si128(rows + 5)),
+                                         _mm_add_epi8(_mm_loadu_si128(rows + 6), _mm_loadu_si128(rows + 7))));
+
+    __m128i halves = _mm_sad_epu8(sum, _mm_setzero_si128());
+    return (uint8_t)(_mm_cvtsi128_si32(halves) + _mm_cvtsi128_si32(_mm_unpackhi_epi64(halves, halves)));
+}
+#endif
+
+#if EDID_HAVE_AVX2
+EDID_TARGET_AVX2
+static uint8_t block_sum_avx2(const uint8_t *block)
+{
+    const __m256i *rows = (const __m256i *)block;
+    __m256i sum = _mm256_add_epi8(_mm256_add_epi8(_mm256_loadu_si256(rows + 0), _mm256_loadu_si256(rows + 1)),
+                                  _mm256_add_epi8(_mm256_loadu_si256(rows + 2), _mm256_loadu_si256(rows + 3)));
+
+    __m256i lanes = _mm256_sad_epu8(sum, _mm256_setzero_si256());
+    __m128i halves = _mm_add_epi64(_mm256_castsi256_si128(lanes), _mm256_extracti128_si256(lanes, 1));
+    return (uint8_t)(_mm_cvtsi128_si32(halves) + _mm_cvtsi128_si32(_mm_unpackhi_epi64(halves, halves)));
+}
+
+/**
+ * AVX2 variant of edid_validate_blocks(), kept in one function so the block
+ * sums inline into the loop.
+ */
+EDID_TARGET_AVX2
+static void validate_blocks_avx2(const uint8_t *blocks, size_t count, uint64_t header, uint8_t *status)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        const uint8_t *block = blocks + i * EDID_LENGTH;
+        uint64_t word;
+
+        memcpy(&word, block, sizeof(word));
+        status[i] = (uint8_t)((word != header ? EDID_STATUS_BAD_HEADER : 0) |
+                              (block_sum_avx2(block) != 0 ? EDID_STATUS_BAD_CHECKSUM : 0));
+    }
+}
+#endif
+
+/**
+ * Returns the mod-256 sum of a 128-byte block, which is 0 for a block with a
+ * valid checksum. Uses the widest vector path the CPU supports.
+ */
+uint8_t edid_block_sum(const uint8_t *block)
+{
+#if EDID_HAVE_AVX2
+    if (edid_cpu_features() & EDID_CPU_AVX2)
+    {
+        return block_sum_avx2(block);
+    }
+#endif
+#if EDID_HAVE_SSE2
+    return block_sum_sse2(block);
+#else
+    return block_sum_scalar(block);
+#endif
+}
+
+/**
+ * Checks the 8-byte EDID header with a single 64-bit compare.
+ */
+int edid_header_valid(const uint8_t *block)
+{
+    uint64_t header;
+    uint64_t word;
+
+    memcpy(&header, edid_header, sizeof(header));
+    memcpy(&word, block, sizeof(word));
+    return word == header;
+}
+
+/**
+ * Checks the header and checksum of count consecutive 128-byte blocks.
+ *
+ * @param blocks Pointer to count blocks of EDID_LENGTH bytes each
+ * @param count Number of blocks
+ * @param status Receives the EDID_STATUS_* bits for each block
+ */
+void edid_validate_blocks(const uint8_t *blocks, size_t count, uint8_t *status)
+{
+    uint64_t header;
+
+    memcpy(&header, edid_header, sizeof(header));
+
+#if EDID_HAVE_AVX2
+    if (edid_cpu_features() & EDID_CPU_AVX2)
+    {
+        validate_blocks_avx2(blocks, count, header, status);
+        return;
+    }
+#endif
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const uint8_t *block = blocks + i * EDID_LENGTH;
+        uint64_t word;
+        uint8_t result = EDID_STATUS_OK;
+
+        memcpy(&word, block, sizeof(word));
+        if (word != header)
+        {
+            result |= EDID_STATUS_BAD_HEADER;
+        }
+#if EDID_HAVE_SSE2
+        if (block_sum_sse2(block) != 0)
+#else
+        if (block_sum_scalar(block) != 0)
+#endif
+        {
+            result |= EDID_STATUS_BAD_CHECKSUM;
+        }
+        status[i] = result;
+    }
+}
@@ -1,16 +1,19 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <io.h>
 #include <fcntl.h>
 #include <string.h>
 #include <stdint.h>
-#include <ctype.h>
+#include "parser.h"
+#include "edid_corpus.h"
+#include "edid_archive.h"
+#include "edid_lines.h"
+#include "edid_instrument.h"
 
 /**
  * This function is an EDID parser that can take an input of the raw EDID data
  */
 
-#define EDID_LENGTH 128
-
 #define DEBUG_PRINT_ENABLED 0
 #if DEBUG_PRINT_ENABLED
 #define DGB_PRINTF printf
@@ -18,695 +21,211 @@
 #define DGB_PRINTF(...) ((void)0)
 #endif
 
-#define FILE_OUTPUT_ENABLED 0
-
-void write_to_file_once(const char *filename, const char *data) {
-#if FILE_OUTPUT_ENABLED
-    FILE *fp = fopen(filename, "w");
-    if (!fp) {
-        perror("Failed to open output file");
-        return;
-    }
-    fprintf(fp, "%s", data);
-    fclose(fp);
-#else
-    (void)filename;
-    (void)data;
-#endif
-}
-
-//FILE *out = NULL;
-char edid_out[1500];
-
-// Declaring all functions
-int check_header(const unsigned char *edid);
-void parse_manufacturer_id(const unsigned char *edid, char *output, int *offset);
-void parse_product_code(const unsigned char *edid, char *output, int *offset);
-void parse_serial_number(const unsigned char *edid, char *output, int *offset);
-void parse_manufacture_date(const unsigned char *edid, char *output, int *offset);
-void parse_edid_version(const unsigned char *edid, char *output, int *offset);
-void parse_video_input(const unsigned char *edid, char *output, int *offset);
-void parse_screen_size(const unsigned char *edid, char *output, int *offset);
-void parse_display_gamma(const unsigned char *edid, char *output, int *offset);
-void parse_supported_features(const unsigned char *edid, char *output, int *offset);
-void parse_colour_characteristics(const unsigned char *edid, char *output, int *offset);
-void parse_established_timings(const unsigned char *edid, char *output, int *offset);
-void parse_standard_timings(const unsigned char *edid, char *output, int *offset);
-unsigned char *string_to_hex(const char *hex_string);
-
 /**
- * Parses the EDID data
- *
- * @param edid Pointer to the EDID hex string
+ * Prints the CSV header line when the output format is CSV.
  */
-void parse_edid_string(const char *hex_string, char *output)
+static void print_format_header(int format)
 {
-    int offset = 0;
-    unsigned char *edid = string_to_hex(hex_string);
-    /*out = fopen("output.txt", "w");
-    if (!out)
-    {
-        perror("Failed to open output file");
-        return;
-    }*/
+    char header[512];
+    struct edid_sink sink;
 
-    if (!check_header(edid))
+    if (format == EDID_FORMAT_CSV)
     {
-        DGB_PRINTF("Invalid EDID header.\n");
-        /*if (out)
-            fprintf(out, "Invalid EDID header\n");*/
-        int written = sprintf(output + offset, "Invalid EDID header\n");
-        offset += written;
-        return;
+        edid_sink_init(&sink, header, sizeof(header));
+        format_edid_csv_header(&sink);
+        fwrite(header, 1, sink.length, stdout);
     }
-
-    DGB_PRINTF("Valid EDID header.\n");
-    int written = sprintf(output + offset, "Valid EDID header\n");
-    offset += written;
-    /*if (out)
-        fprintf(out, "Valid EDID header\n");*/
-    parse_manufacturer_id(edid, output, &offset);
-    parse_product_code(edid, output, &offset);
-    parse_serial_number(edid, output, &offset);
-    parse_manufacture_date(edid, output, &offset);
-    parse_edid_version(edid, output, &offset);
-    parse_video_input(edid, output, &offset);
-    parse_screen_size(edid, output, &offset);
-    parse_display_gamma(edid, output, &offset);
-    parse_supported_features(edid, output, &offset);
-    parse_colour_characteristics(edid, output, &offset);
-    parse_established_timings(edid, output, &offset);
-    parse_standard_timings(edid, output, &offset);
 }
 
 /**
- * Parses the EDID data
+ * Parses every EDID in a corpus file on several threads and prints the output
+ * in input order.
  *
- * @param edid Pointer to the 128-byte EDID data array
+ * @param path Corpus of hex lines or concatenated binary EDIDs
+ * @param threads Worker threads, 0 for one per processor
+ * @param format EDID_FORMAT_* to print
+ * @return 0 on success, 1 on failure
  */
-void parse_edid_array(const unsigned char *edid, char *output){
-    int offset = 0;
-    /*out = fopen("output.txt", "w");
-    if (!out)
-    {
-        perror("Failed to open output file");
-        return;
-    }*/
-    if (!check_header(edid))
-    {
-        DGB_PRINTF("Invalid EDID header.\n");
-        /*if (out)
-            fprintf(out, "Invalid EDID header\n");*/
-        int written = sprintf(output + offset, "Invalid EDID header\n");
-        offset += written;
-        return;
-    }
-
-    DGB_PRINTF("Valid EDID header.\n");
-    int written = sprintf(output + offset, "Valid EDID header\n");
-    offset += written;
-    /*if (out)
-        fprintf(out, "Valid EDID header\n");*/
-    parse_manufacturer_id(edid, output, &offset);
-    parse_product_code(edid, output, &offset);
-    parse_serial_number(edid, output, &offset);
-    parse_manufacture_date(edid, output, &offset);
-    parse_edid_version(edid, output, &offset);
-    parse_video_input(edid, output, &offset);
-    parse_screen_size(edid, output, &offset);
-    parse_display_gamma(edid, output, &offset);
-    parse_supported_features(edid, output, &offset);
-    parse_colour_characteristics(edid, output, &offset);
-    parse_established_timings(edid, output, &offset);
-    parse_standard_timings(edid, output, &offset);
-}
-
-/**
- * Converts the hex string to hex format
- *
- * @param edid Pointer to the 128-byte EDID hex string
- */
-unsigned char *string_to_hex(const char *hex_string)
+static int parse_corpus_file(const char *path, unsigned int threads, int format)
 {
-    static unsigned char edid[128];
-    int index = 0;
+    struct edid_corpus corpus;
 
-    while (*hex_string && index < 128)
+    if (!edid_corpus_load(path, &corpus))
     {
-        while (*hex_string && isspace(*hex_string))
-        {
-            hex_string++;
-        }
-
-        if (*hex_string == '\0')
-            break;
-
-        unsigned int byte;
-        if (sscanf(hex_string, "%2x", &byte) == 1)
-        {
-            edid[index++] = (unsigned char)byte;
-            hex_string += 2;
-        }
-        else
-        {
-            break;
-        }
+        fprintf(stderr, "Cannot load corpus %s\n", path);
+        return 1;
     }
 
-    return edid;
+    print_format_header(format);
+    int ok = edid_corpus_parse(&corpus, threads ? threads : edid_corpus_default_threads(), format, stdout);
+    edid_corpus_free(&corpus);
+    return ok ? 0 : 1;
 }
 
 /**
- * Checks whether the EDID header is valid.
+ * Parses every EDID in a binary archive straight from a memory mapping and
+ * prints the output, each text EDID followed by a blank line.
  *
- * @param edid Pointer to the 128-byte EDID data array
- * @return 1 if header is valid, 0 otherwise.
+ * @param path Binary archive of concatenated EDIDs
+ * @param format EDID_FORMAT_* to print
+ * @return 0 on success, 1 on failure
  */
-int check_header(const unsigned char *edid)
+static int parse_archive_file(const char *path, int format)
 {
-    if (edid[0] != 0x00 || edid[1] != 0xFF || edid[2] != 0xFF || edid[3] != 0xFF || edid[4] != 0xFF || edid[5] != 0xFF ||
-        edid[6] != 0xFF || edid[7] != 0x00)
+    struct edid_archive archive;
+    struct edid_archive_iter iter;
+    const unsigned char *edid;
+    size_t length;
+    size_t capacity = 65536;
+    char *output = malloc(capacity);
+
+    if (!output || !edid_archive_open(path, &archive))
     {
-        return 0; // Invalid header
+        fprintf(stderr, "Cannot map archive %s\n", path);
+        free(output);
+        return 1;
     }
-    return 1; // Valid header
-}
 
-/**
- * Parses and prints the EDID version and revision.
- *
- * @param edid Pointer to the 128-byte EDID data array.
- */
-void parse_edid_version(const unsigned char *edid, char *output, int *offset)
-{
-    uint8_t version = edid[0x12];  // EDID version byte
-    uint8_t revision = edid[0x13]; // EDID revision byte
-    DGB_PRINTF("EDID Version: %d.%d\n", version, revision);
-    int written = sprintf(output + *offset, "EDID Version: %d.%d\n", version, revision);
-    *offset += written;
-    /*if (out)
-        fprintf(out, "EDID Version: %d.%d\n", version, revision);*/
-}
-
-/**
- * Parses and prints the manufacturer ID
- *
- * @param edid Pointer to the 128-byte EDID data array
- */
-void parse_manufacturer_id(const unsigned char *edid, char *output, int *offset)
-{
-    uint16_t manufacturer = (edid[8] << 8) | edid[9]; // Combine bytes 8 and 9
-
-    char manufacturer_id[4];
-
-    manufacturer_id[0] = ((manufacturer >> 10) & 0x1F) + 'A' - 1; // ASCII
-    manufacturer_id[1] = ((manufacturer >> 5) & 0x1F) + 'A' - 1;
-    manufacturer_id[2] = (manufacturer & 0x1F) + 'A' - 1;
-    manufacturer_id[3] = '\0';
-
-    DGB_PRINTF("Manufacturer ID: %s\n", manufacturer_id);
-    int written = sprintf(output + *offset, "Manufacturer ID: %s\n", manufacturer_id);
-    *offset += written;
-    /*if (out)
-        fprintf(out, "Manufacturer ID: %s\n", manufacturer_id);*/
-}
-
-/**
- * Parses and prints the product code from the EDID.
- *
- * @param edid Pointer to the 128-byte EDID data array
- */
-void parse_product_code(const unsigned char *edid, char *output, int *offset)
-{
-    // Combine the two bytes
-    uint16_t product_code = edid[10] | (edid[11] << 8);
-    DGB_PRINTF("Product Code: %u (0x%04X)\n", product_code, product_code);
-    int written = sprintf(output + *offset, "Product Code: %u (0x%04X)\n", product_code, product_code);
-    *offset += written;
-    /*if (out)
-        fprintf(out, "Product Code: %u (0x%04X)\n", product_code, product_code);*/
-}
-
-/**
- * Parses and prints the serial number from the EDID.
- *
- * @param edid Pointer to the 128-byte EDID data array
- */
-void parse_serial_number(const unsigned char *edid, char *output, int *offset)
-{
-    // Combine 4 bytes
-    uint32_t serial = edid[12] | (edid[13] << 8) | (edid[14] << 16) | (edid[15] << 24);
-    int written = sprintf(output + *offset, "Serial Number: %u (0x%08X)\n", serial, serial);
-    *offset += written;
-    DGB_PRINTF("Serial Number: %u (0x%08X)\n", serial, serial);
-    /*if (out)
-        fprintf(out, "Serial Number: %u (0x%08X)\n", serial, serial);*/
-}
-
-/**
- * Parses and prints the week and year of manufacture
- *
- * @param edid Pointer to the 128-byte EDID data array.
- */
-void parse_manufacture_date(const unsigned char *edid, char *output, int *offset)
-{
-    uint8_t week = edid[16];
-    uint8_t year_offset = edid[17];
-    uint16_t year = 1990 + year_offset;
-
-    DGB_PRINTF("Manufacture Date: Year %u, Week %u\n", year, week);
-    int written = sprintf(output + *offset, "Manufacture Date: Year %u, Week %u\n", year, week);
-    *offset += written;
-    /*if (out)
-        fprintf(out, "Manufacture Date: Year %u, Week %u\n", year, week);*/
-}
-
-/**
- * Prints the video input type and other details details
- *
- * @param edid Pointer to the 128-byte EDID data array
- */
-void parse_video_input(const unsigned char *edid, char *output, int *offset)
-{
-    uint8_t input = edid[20];
-
-    if (input & 0x80)
+    print_format_header(format);
+    edid_archive_iter_init(&iter, &archive);
+    while ((edid = edid_archive_next(&iter, &length)) != NULL)
     {
-        DGB_PRINTF("Video Input Type: Digital\n");
-        int written = sprintf(output + *offset, "Video Input Type: Digital\n");
-        *offset += written;
-        /*if (out)
-            fprintf(out, "Video Input Type: Digital\n");*/
-
-        uint8_t bit = (input >> 4) & 0x07;
-        uint8_t interface = input & 0x0F;
-
-        const char *bits[] = {"Undefined", "6", "8", "10", "12", "14", "16", "Reserved"};
+        size_t needed = parse_edid_blocks_as(edid, length, format, output, capacity);
 
-        const char *interfaces[] = {"Undefined", "DVI", "HDMIa", "HDMIb", "MDDI", "DisplayPort"};
-
-        DGB_PRINTF("   Bits per colour: %s\n", bits[bit]);
-        written = sprintf(output + *offset, "   Bits per colour: %s\n", bits[bit]);
-        *offset += written;
-        /*if (out)
-            fprintf(out, "   Bits per colour: %s\n", bits[bit]);*/
-        if (interface < 6)
-        {
-            DGB_PRINTF("   Interface: %s\n", interfaces[interface]);
-            int written = sprintf(output + *offset, "   Interface: %s\n", interfaces[interface]);
-            *offset += written;
-            /*if (out)
-                fprintf(out, "   Interface: %s\n", interfaces[interface]);*/
-        }
-        else
+        if (needed >= capacity)
         {
-            DGB_PRINTF("   Interface: Reserved or Unknown\n");
-            int written = sprintf(output + *offset, "   Interface: Reserved or Unknown\n");
-            *offset += written;
-            /*if (out)
-                fprintf(out, "   Interface: Reserved or Unknown\n");*/
+            char *larger = realloc(output, needed + 1);
+            if (!larger)
+            {
+                break;
+            }
+            output = larger;
+            capacity = needed + 1;
+            parse_edid_blocks_as(edid, length, format, output, capacity);
         }
+        fwrite(output, 1, needed, stdout);
     }
-    else
-    {
-        DGB_PRINTF("Video Input Type: Analog\n");
-        int written = sprintf(output + *offset, "Video Input Type: Analog\n");
-        *offset += written;
-        /*if (out)
-            fprintf(out, "Video Input Type: Analog\n");*/
-        uint8_t level = (input >> 5) & 0x03;
-        uint8_t setup = (input >> 4) & 0x01;
-        uint8_t sync = input & 0x0F;
-
-        const char *video_levels[] = {
-            "0.700, 0.300 (1.0 V p-p)",
-            "0.714, 0.286 (1.0 V p-p)",
-            "1.000, 0.286 (1.0 V p-p)",
-            "0.700, 0.000 (0.7 V p-p)",
-        };
-
-        DGB_PRINTF("   Signal Level: %s\n", video_levels[level]);
-        written = sprintf(output + *offset, "   Signal Level: %s\n", video_levels[level]);
-        *offset += written;
-
-        if (setup)
-        {
-            DGB_PRINTF("Video setup: Blank-to-Black setup or pedestal\n");
-            written = sprintf(output + *offset, "Video setup: Blank-to-Black setup or pedestal\n");
-            *offset += written;
-            /*if (out)
-                fprintf(out, "Video setup: Blank-to-Black setup or pedestal\n");*/
-        }
-        else
-        {
-            DGB_PRINTF("Video setup: Blank level = Black level\n");
-            written = sprintf(output + *offset, "Video setup: Blank level = Black level\n");
-            *offset += written;
-            /*if (out)
-                fprintf(out, "Video setup: Blank level = Black level\n");*/
-        }
 
-        DGB_PRINTF("   Sync Types Supported:\n");
-        written = sprintf(output + *offset, "   Sync Types Supported:\n");
-        *offset += written;
-        /*if (out)
-            fprintf(out, "   Sync Types Supported:\n");*/
-        if (sync & 0x08)
-        {
-            DGB_PRINTF("   -Separate Sync H & V Signals\n");
-            written = sprintf(output + *offset, "   -Separate Sync H & V Signals\n");
-            *offset += written;
-            /*if (out)
-                fprintf(out, "   -Separate Sync H & V Signals\n");*/
-        }
-        if (sync & 0x04)
-        {
-            DGB_PRINTF("   -Composite Sync H & V Signals\n");
-            written = sprintf(output + *offset, "   -Composite Sync H & V Signals\n");
-            *offset += written;
-            /*if (out)
-                fprintf(out, "   -Composite Sync H & V Signals\n");*/
-        }
-        if (sync & 0x02)
-        {
-            DGB_PRINTF("   -Composite Sync Signal on Green Video\n");
-            written = sprintf(output + *offset, "   -Composite Sync Signal on Green Video\n");
-            *offset += written;
-            /*if (out)
-                fprintf(out, "   -Composite Sync Signal on Green Video\n");*/
-        }
-        if (sync & 0x01)
-        {
-            DGB_PRINTF("   -Serration on Vertical Sync\n");
-            written = sprintf(output + *offset, "   -Serration on Vertical Sync\n");
-            *offset += written;
-            /*if (out)
-                fprintf(out, "   -Serration on Vertical Sync\n");*/
-        }
-    }
-}
-
-/*
- * Prints the screen size in centimetres in the format of horizontal size x vertical size
- *
- * @param edid Pointer to the 128-byte EDID data array
- */
-void parse_screen_size(const unsigned char *edid, char *output, int *offset)
-{
-    uint8_t horizontal_size = edid[21];
-    uint8_t vertical_size = edid[22];
-    DGB_PRINTF("Screen Size: %d cm x %d cm\n", horizontal_size, vertical_size);
-    int written = sprintf(output + *offset, "Screen Size: %d cm x %d cm\n", horizontal_size, vertical_size);
-    *offset += written;
-    /*if (out)
-        fprintf(out, "Screen Size: %d cm x %d cm\n", horizontal_size, vertical_size);*/
+    edid_archive_close(&archive);
+    free(output);
+    return edid ? 1 : 0;
 }
 
-/*
- * Parses and prints the display gamma
- *
- * @param edid Pointer to the 128-byte EDID data array
- */
-void parse_display_gamma(const unsigned char *edid, char *output, int *offset)
+struct stdin_output
 {
-    uint8_t gamma_encoded = edid[23];
+    char *text;
+    size_t capacity;
+    int format;
+};
 
-    float gamma = (gamma_encoded + 100) / 100.0f;
-    DGB_PRINTF("Display Gamma: %.2f\n", gamma);
-    int written = sprintf(output + *offset, "Display Gamma: %.2f\n", gamma);
-    *offset += written;
-    /*if (out)
-        fprintf(out, "Display Gamma: %.2f\n", gamma);*/
-}
-
-/**
- * Parses and prints supported display features
- *
- * @param edid Pointer to the 128-byte EDID data array 
-*/
-void parse_supported_features(const unsigned char *edid, char *output, int *offset)
+static int print_stdin_edid(const unsigned char *edid, size_t length, void *context)
 {
-    uint8_t features = edid[24];
-    uint8_t input = edid[20];
+    struct stdin_output *output = context;
 
-    uint8_t power = (features >> 5) & 0x03;
-
-    DGB_PRINTF("Supported Features:\n");
-    int written = sprintf(output + *offset, "Supported Features:\n");
-    *offset += written;
-    /*if (out)
-        fprintf(out, "Supported Features:\n");*/
-
-    // Power management
-    if (power & 0x04)
-    {
-        DGB_PRINTF(" - Standby Supported\n");
-        written = sprintf(output + *offset, " - Standby Supported\n");
-        *offset += written;
-        /*if (out)
-            fprintf(out, " - Standby Supported\n");*/
-    }
-    if (features & 0x02)
-    {
-        DGB_PRINTF(" - Suspend Supported\n");
-        written = sprintf(output + *offset, " - Suspend Supported\n");
-        *offset += written;
-        /*if (out)
-            fprintf(out, " - Suspend Supported\n");*/
-    }
-    if (features & 0x01)
-    {
-        DGB_PRINTF(" - Active-Off Supported\n");
-        written = sprintf(output + *offset, " - Active-Off Supported\n");
-        *offset += written;
-        /*if (out)
-            fprintf(out, " - Active-Off Supported\n");*/
-    }
-
-    // Display type
-    uint8_t display_type = (features >> 3) & 0x03;
-    const char *display_types_digital[] = {
-        "RGB 4:4:4", "RGB 4:4:4 & YCrCb 4:4:4", "RGB 4:4:4 & YCrCb 4:2:2", "RGB 4:4:4 & YCrCb 4:4:4 & YCrCb 4:2:2"};
-    const char *display_types_analog[] = {
-        "Monochrome or Grayscale", "RGB Color", "Non-RGB Color", "Undefined"};
-    if (input & 0x80)
-    {
-        DGB_PRINTF(" - Display Type: %s\n", display_types_digital[display_type]);
-        written = sprintf(output + *offset, " - Display Type: %s\n", display_types_digital[display_type]);
-        *offset += written;
-        /*if (out)
-            fprintf(out, " - Display Type: %s\n", display_types_digital[display_type]);*/
-    }
-    else
-    {
-        DGB_PRINTF(" - Display Type: %s\n", display_types_analog[display_type]);
-        written = sprintf(output + *offset, " - Display Type: %s\n", display_types_analog[display_type]);
-        *offset += written;
-        /*if (out)
-            fprintf(out, " - Display Type: %s\n", display_types_analog[display_type]);*/
-    }
-
-    // sRGB color space
-    if (features & 0x04)
+    if (!edid)
     {
-        DGB_PRINTF(" - sRGB Color Space Default\n");
-        written = sprintf(output + *offset, " - sRGB Color Space Default\n");
-        *offset += written;
-        /*if (out)
-            fprintf(out, " - sRGB Color Space Default\n");*/
+        fflush(stdout);
+        return 0;
     }
 
-    // Preferred timing mode
-    if (features & 0x02)
+    size_t needed = parse_edid_blocks_as(edid, length, output->format, output->text, output->capacity);
+    if (needed >= output->capacity)
     {
-        DGB_PRINTF(" - Preferred Timing Mode\n");
-        written = sprintf(output + *offset, " - Preferred Timing Mode\n");
-        *offset += written;
-        /*if (out)
-            fprintf(out, " - Preferred Timing Mode\n");*/
-    }
-
-    // Continuous timings
-    if (features & 0x01)
-    {
-        DGB_PRINTF(" - Continuous Timing Support\n");
-        written = sprintf(output + *offset, " - Continuous Timing Support\n");
-        *offset += written;
-        /*if (out)
-            fprintf(out, " - Continuous Timing Support\n");*/
+        char *larger = realloc(output->text, needed + 1);
+        if (!larger)
+        {
+            return 1;
+        }
+        output->text = larger;
+        output->capacity = needed + 1;
+        parse_edid_blocks_as(edid, length, output->format, output->text, output->capacity);
     }
+    fwrite(output->text, 1, needed, stdout);
+    return 0;
 }
 
 /**
- * Parses and prints the chromaticity coordinates (color characteristics)
+ * Parses hex EDIDs from stdin as they arrive, one per line or as multi-line
+ * dumps separated by blank lines, and prints each result straight away.
  *
- * @param edid Pointer to the 128-byte EDID data array.
+ * @param format EDID_FORMAT_* to print
+ * @return 0 on success, 1 on failure
  */
-void parse_colour_characteristics(const unsigned char *edid, char *output, int *offset)
+static int parse_stdin(int format)
 {
+    struct stdin_output output;
 
-    uint8_t red_green_lo = edid[25];
-    uint8_t blue_white_lo = edid[26];
-
-    uint16_t red_x = ((edid[27] << 2) | ((red_green_lo >> 6) & 0x03));
-    uint16_t red_y = (edid[28] << 2) | ((red_green_lo >> 4) & 0x03);
-    uint16_t green_x = (edid[29] << 2) | ((red_green_lo >> 2) & 0x03);
-    uint16_t green_y = ((edid[30]) << 2) | ((red_green_lo & 0x03));
-
-    uint16_t blue_x = (edid[31] << 2) | ((blue_white_lo >> 6) & 0x03);
-    uint16_t blue_y = (edid[32] << 2) | ((blue_white_lo >> 4) & 0x03);
-    uint16_t white_x = (edid[33] << 2) | ((blue_white_lo >> 2) & 0x03);
-    uint16_t white_y = (edid[34] << 2) | (blue_white_lo & 0x03);
+    output.format = format;
+    output.capacity = 65536;
+    output.text = malloc(output.capacity);
+    if (!output.text)
+    {
+        return 1;
+    }
 
-    DGB_PRINTF("Color Characteristics (Chromaticity Coordinates):\n");
-    int written = sprintf(output + *offset, "Color Characteristics (Chromaticity Coordinates):\n");
-    *offset += written;
-    /*if (out)
-        fprintf(out, "Color Characteristics (Chromaticity Coordinates):\n");*/
-    DGB_PRINTF("  Red   : (X = %.4f, Y = %.4f)\n", red_x / 1024.0, red_y / 1024.0);
-    written = sprintf(output + *offset, "  Red   : (X = %.4f, Y = %.4f)\n", red_x / 1024.0, red_y / 1024.0);
-    *offset += written;
-    /*if (out)
-        fprintf(out, "  Red   : (X = %.4f, Y = %.4f)\n", red_x / 1024.0, red_y / 1024.0);*/
-    DGB_PRINTF("  Green : (X = %.4f, Y = %.4f)\n", green_x / 1024.0, green_y / 1024.0);
-    written = sprintf(output + *offset, "  Green : (X = %.4f, Y = %.4f)\n", green_x / 1024.0, green_y / 1024.0);
-    *offset += written;
-    /*if (out)
-        fprintf(out, "  Green : (X = %.4f, Y = %.4f)\n", green_x / 1024.0, green_y / 1024.0);*/
-    DGB_PRINTF("  Blue  : (X = %.4f, Y = %.4f)\n", blue_x / 1024.0, blue_y / 1024.0);
-    written = sprintf(output + *offset, "  Blue  : (X = %.4f, Y = %.4f)\n", blue_x / 1024.0, blue_y / 1024.0);
-    *offset += written;
-    /*if (out)
-        fprintf(out, "  Blue  : (X = %.4f, Y = %.4f)\n", blue_x / 1024.0, blue_y / 1024.0);*/
-    DGB_PRINTF("  White : (X = %.4f, Y = %.4f)\n", white_x / 1024.0, white_y / 1024.0);
-    written = sprintf(output + *offset, "  White : (X = %.4f, Y = %.4f)\n", white_x / 1024.0, white_y / 1024.0);
-    *offset += written;
-    /*if (out)
-        fprintf(out, "  White : (X = %.4f, Y = %.4f)\n", white_x / 1024.0, white_y / 1024.0);*/
+    print_format_header(format);
+    int ok = edid_read_hex_lines(0, print_stdin_edid, &output);
+    fflush(stdout);
+    free(output.text);
+    return ok ? 0 : 1;
 }
 
-
+#if EDID_INSTRUMENT
 /**
- * Parses and prints all established display timings supported by the monitor.
- *
- * @param edid Pointer to the 128-byte EDID data array.
+ * Prints the stage timings of the run to stderr, keeping stdout unchanged.
  */
-void parse_established_timings(const unsigned char *edid, char *output, int *offset)
+static void print_instrument_report(void)
 {
-    uint8_t timing1 = edid[35];
-    uint8_t timing2 = edid[36];
-    uint8_t timing3 = edid[37];
+    struct edid_sink sink;
 
-    const char *established_timings[] = {
-        "720x400 @ 70Hz", "720x400 @ 88Hz", "640x480 @ 60Hz", "640x480 @ 67Hz", "640x480 @ 72Hz", "640x480 @ 75Hz", "800x600 @ 56Hz", "800x600 @ 60Hz",
+    edid_sink_init(&sink, NULL, 0);
+    edid_instrument_report(&sink);
 
-        "800x600 @ 72Hz", "800x600 @ 75Hz", "832x624 @ 75Hz", "1024x768 @ 87Hz (interlaced)", "1024x768 @ 60Hz", "1024x768 @ 70Hz", "1024x768 @ 75Hz", "1280x1024 @ 75Hz"};
+    char *text = malloc(sink.length + 1);
+    if (text)
+    {
+        edid_sink_init(&sink, text, sink.length + 1);
+        edid_instrument_report(&sink);
+        fwrite(text, 1, sink.length, stderr);
+        free(text);
+    }
+}
+#endif
 
-    DGB_PRINTF("Established Timings:\n");
-    int written = sprintf(output + *offset, "Established Timings:\n");
-    *offset += written;
-    /*if (out)
-        fprintf(out, "Established Timings:\n");*/
+int main(int argc, char **argv)
+{
+    int format = EDID_FORMAT_TEXT;
 
-    uint8_t mask = 0x80;
+#if EDID_INSTRUMENT
+    atexit(print_instrument_report);
+#endif
 
-    for (int i = 0; i < 8; i++)
+    // --format applies to the modes that print parsed EDIDs and comes first
+    if (argc > 2 && strcmp(argv[1], "--format") == 0)
     {
-        if (timing1 & mask)
+        format = edid_format_from_name(argv[2]);
+        if (format < 0)
         {
-            DGB_PRINTF(" - %s\n", established_timings[i]);
-            written = sprintf(output + *offset, " - %s\n", established_timings[i]);
-            *offset += written;
-            /*if (out)
-                fprintf(out, " - %s\n", established_timings[i]);*/
+            fprintf(stderr, "Unknown format %s, expected text, json or csv\n", argv[2]);
+            return 1;
         }
-        mask >>= 1;
+        argc -= 2;
+        argv += 2;
     }
 
-    mask = 0x80;
-
-    for (int i = 0; i < 8; i++)
+    if (argc > 1 && strcmp(argv[1], "--stdin") == 0)
     {
-        if (timing2 & mask)
-        {
-            DGB_PRINTF(" - %s\n", established_timings[8 + i]);
-            written = sprintf(output + *offset, " - %s\n", established_timings[8 + i]);
-            *offset += written;
-            /*if (out)
-                fprintf(out, " - %s\n", established_timings[8 + i]);*/
-        }
-        mask >>= 1;
+        return parse_stdin(format);
     }
-
-    // manufacturer timing
-    if (timing3 != 0x00)
+    if (argc > 2 && strcmp(argv[1], "--archive") == 0)
     {
-        DGB_PRINTF(" - Manufacturer reserved timings: 0x%02X\n", timing3);
-        written = sprintf(output + *offset, " - Manufacturer reserved timings: 0x%02X\n", timing3);
-        *offset += written;
-        /*if (out)
-            fprintf(out, " - Manufacturer reserved timings: 0x%02X\n", timing3);*/
+        return parse_archive_file(argv[2], format);
     }
-}
-
-/**
- * Parses and prints the standard display timings encoded in the EDID.
- *
- * @param edid Pointer to the 128-byte EDID data array.
- */
-void parse_standard_timings(const unsigned char *edid, char *output, int *offset)
-{
-    /*if (out)
-        fprintf(out, "Standard Timings:\n");*/
-    DGB_PRINTF("Standard Timings:\n");
-    int written = sprintf(output + *offset, "Standard Timings:\n");
-    *offset += written;
-
-    for (int i = 0; i < 8; i++)
+    if (argc > 2 && strcmp(argv[1], "--corpus") == 0)
     {
-        uint8_t byte1 = edid[38 + i * 2];
-        uint8_t byte2 = edid[39 + i * 2];
-
-        if (byte1 == 0x01 && byte2 == 0x01)
-        {
-            continue;
-        }
-
-        int horizontal_resolution = (byte1 + 31) * 8;
-        uint8_t aspect = (byte2 >> 6) & 0x03;
-        int vertical_frequency = (byte2 & 0x3F) + 60;
-
-        const char *aspect_ratios[] = {"16:10", "4:3", "5:4", "16:9"};
-
-        int vertical_resolution;
-        switch (aspect)
-        {
-        case 0:
-            vertical_resolution = horizontal_resolution * 10 / 16;
-            break; // 16:10
-        case 1:
-            vertical_resolution = horizontal_resolution * 3 / 4;
-            break; // 4:3
-        case 2:
-            vertical_resolution = horizontal_resolution * 4 / 5;
-            break; // 5:4
-        case 3:
-            vertical_resolution = horizontal_resolution * 9 / 16;
-            break; // 16:9
-        default:
-            vertical_resolution = 0;
-        }
-
-        DGB_PRINTF(" - %d x %d (%s) @ %dHz\n", horizontal_resolution, vertical_resolution, aspect_ratios[aspect], vertical_frequency);
-        written = sprintf(output + *offset, " - %d x %d (%s) @ %dHz\n", horizontal_resolution, vertical_resolution, aspect_ratios[aspect], vertical_frequency);
-        *offset += written;
-        /*if (out)
-            fprintf(out, " - %d x %d (%s) @ %dHz\n", horizontal_resolution, vertical_resolution, aspect_ratios[aspect], vertical_frequency);*/
+        return parse_corpus_file(argv[2], argc > 3 ? (unsigned int)strtoul(argv[3], NULL, 10) : 0, format);
     }
-}
 
-int main()
-{
     /*FILE *file = fopen("edid_dump.bin", "rb"); //testing using the example edid
     if (!file){
         perror("Failed to open");
@@ -732,11 +251,22 @@ int main()
     
     const char *input5 = "00 FF FF FF FF FF FF 00 10 AC 79 42 4C 47 5A 42 0F 22 01 04 B5 3C 22 78 3A DF 15 AD 50 44 AD 25 0F 50 54 A5 4B 00 D1 00 D1 C0 B3 00 A9 40 81 80 81 00 71 4F E1 C0 4D D0 00 A0 F0 70 3E 80 30 20 35 00 55 50 21 00 00 1A 00 00 00 FF 00 32 33 5A 53 4A 30 34 0A 20 20 20 20 20 00 00 00 FC 00 44 45 4C 4C 20 55 32 37 32 33 51 45 0A 00 00 00 FD 00 17 56 0F 8C 36 01 0A 20 20 20 20 20 20 01 2A";
     
-    parse_edid_string(input1, edid_out);
+    // Size the report exactly before parsing into it
+    size_t edid_out_size = parse_edid_string(input1, NULL, 0) + 1;
+    char *edid_out = malloc(edid_out_size);
+    if (!edid_out)
+    {
+        perror("Failed to allocate output");
+        return 1;
+    }
+
+    parse_edid_string(input1, edid_out, edid_out_size);
     printf("----- Edid parsed in memory ----- \n %s \n --------------------", edid_out);
     /*if (out)
         fprintf(out, edid_out);
 
     fclose(out);*/
     write_to_file_once("output.txt", edid_out);
+    free(edid_out);
+    return 0;
 }
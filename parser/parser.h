@@ -1,27 +1,606 @@
 #ifndef PARSER_H
 #define PARSER_H
 
+#include <stddef.h>
+#include <stdint.h>
+
 #define PARSED_EDID_0_REGISTER 0x400
 
+#define EDID_LENGTH 128
+#define EDID_MAX_BLOCKS 4      // blocks held by the fixed-size text and hex paths
+#define EDID_STANDARD_TIMING_COUNT 8
+
+/**
+ * Chromaticity coordinates as the raw 10-bit values from bytes 25-34.
+ * The coordinate is the value divided by 1024.
+ */
+struct edid_chromaticity
+{
+    uint16_t red_x;
+    uint16_t red_y;
+    uint16_t green_x;
+    uint16_t green_y;
+    uint16_t blue_x;
+    uint16_t blue_y;
+    uint16_t white_x;
+    uint16_t white_y;
+};
+
+/**
+ * One decoded standard timing slot (bytes 38-53).
+ */
+struct edid_standard_timing
+{
+    uint16_t horizontal_resolution;
+    uint16_t vertical_resolution;
+    uint8_t aspect;             // 0 = 16:10, 1 = 4:3, 2 = 5:4, 3 = 16:9
+    uint8_t vertical_frequency; // Hz
+};
+
+/**
+ * One decoded 18-byte Detailed Timing Descriptor. Also used for the timings
+ * found in extension blocks.
+ */
+struct edid_detailed_timing
+{
+    uint32_t pixel_clock_khz;
+    uint32_t refresh_mhz;       // vertical refresh in millihertz
+    uint16_t horizontal_active;
+    uint16_t horizontal_blanking;
+    uint16_t horizontal_sync_offset;
+    uint16_t horizontal_sync_width;
+    uint16_t vertical_active;
+    uint16_t vertical_blanking;
+    uint16_t vertical_sync_offset;
+    uint16_t vertical_sync_width;
+    uint16_t horizontal_image_mm;
+    uint16_t vertical_image_mm;
+    uint8_t horizontal_border;
+    uint8_t vertical_border;
+    uint8_t flags;              // raw byte 17, bit 7 = interlaced
+};
+
+/**
+ * Display range limits descriptor (tag 0xFD).
+ */
+struct edid_range_limits
+{
+    uint16_t min_vertical_hz;
+    uint16_t max_vertical_hz;
+    uint16_t min_horizontal_khz;
+    uint16_t max_horizontal_khz;
+    uint16_t max_pixel_clock_mhz;
+    uint8_t timing_support;     // byte 10 of the descriptor
+};
+
+#define EDID_DESCRIPTOR_COUNT 4
+#define EDID_DESCRIPTOR_TEXT_LENGTH 13
+
+#define EDID_DESCRIPTOR_TIMING 0x00       // descriptor slot holds a detailed timing
+#define EDID_DESCRIPTOR_SERIAL 0xFF
+#define EDID_DESCRIPTOR_TEXT 0xFE
+#define EDID_DESCRIPTOR_RANGE_LIMITS 0xFD
+#define EDID_DESCRIPTOR_NAME 0xFC
+
+// Bits of edid_info.status; 0 means the block is valid
+#define EDID_STATUS_OK 0x00
+#define EDID_STATUS_BAD_HEADER 0x01
+#define EDID_STATUS_BAD_CHECKSUM 0x02
+#define EDID_STATUS_TRUNCATED 0x04     // edid_view only: fewer than EDID_LENGTH bytes
+
+/**
+ * Decoded contents of the 128-byte EDID base block. Filled by
+ * parse_edid_struct() without any string formatting.
+ */
+struct edid_info
+{
+    uint8_t status;             // EDID_STATUS_* bits
+    uint8_t header_valid;
+    uint8_t checksum_valid;
+
+    // Vendor and product identification (bytes 8-17)
+    char manufacturer_id[4];
+    uint16_t product_code;
+    uint32_t serial_number;
+    uint8_t manufacture_week;
+    uint16_t manufacture_year;
+
+    // EDID structure version (bytes 18-19)
+    uint8_t version;
+    uint8_t revision;
+
+    // Basic display parameters (bytes 20-24)
+    uint8_t video_input;        // raw byte 20
+    uint8_t digital;            // 1 if bit 7 of byte 20 is set
+    uint8_t bit_depth;          // digital: index into 6/8/10/.. bits per colour
+    uint8_t interface;          // digital: interface type code
+    uint8_t signal_level;       // analog: video white/sync level code
+    uint8_t video_setup;        // analog: blank-to-black setup flag
+    uint8_t sync_types;         // analog: sync type bits 3..0
+    uint8_t horizontal_size_cm;
+    uint8_t vertical_size_cm;
+    uint8_t gamma_encoded;      // gamma = (gamma_encoded + 100) / 100
+    uint8_t features;           // raw byte 24
+    uint8_t display_type;       // bits 4..3 of byte 24
+
+    // Chromaticity (bytes 25-34)
+    struct edid_chromaticity chromaticity;
+
+    // Established timings (bytes 35-37)
+    uint16_t established_timings; // bit 15 = byte 35 bit 7, bit 0 = byte 36 bit 0
+    uint8_t manufacturer_timings; // byte 37
+
+    // Standard timings (bytes 38-53), unused slots skipped
+    uint8_t standard_timing_count;
+    struct edid_standard_timing standard_timings[EDID_STANDARD_TIMING_COUNT];
+
+    // Descriptors (bytes 54-125). The first detailed timing is the preferred mode.
+    uint8_t descriptor_tags[EDID_DESCRIPTOR_COUNT];
+    uint8_t detailed_timing_count;
+    struct edid_detailed_timing detailed_timings[EDID_DESCRIPTOR_COUNT];
+    char monitor_name[EDID_DESCRIPTOR_TEXT_LENGTH + 1];
+    char serial_string[EDID_DESCRIPTOR_TEXT_LENGTH + 1];
+    char unspecified_text[EDID_DESCRIPTOR_TEXT_LENGTH + 1];
+    uint8_t has_range_limits;
+    struct edid_range_limits range_limits;
+};
+
+#define EDID_EXTENSION_CTA 0x02
+#define EDID_EXTENSION_BLOCK_MAP 0xF0
+
+#define EDID_CTA_MAX_VICS 64
+#define EDID_CTA_MAX_AUDIO 16
+#define EDID_CTA_MAX_Y420_VICS 16
+#define EDID_CTA_MAX_TIMINGS 6
+
+/**
+ * One CTA-861 Short Audio Descriptor.
+ */
+struct edid_cta_audio
+{
+    uint8_t format;             // audio format code, 1 = LPCM
+    uint8_t channels;
+    uint8_t sample_rates;       // bit 0 = 32 kHz ... bit 6 = 192 kHz
+    uint8_t detail;             // LPCM: bit depth flags, otherwise format specific
+};
+
+/**
+ * Decoded CTA-861 extension data. When a sink has several CTA blocks their
+ * data blocks are merged here.
+ */
+struct edid_cta_info
+{
+    uint8_t present;
+    uint8_t revision;
+    uint8_t flags;              // byte 3: underscan, basic audio, YCbCr 4:4:4 / 4:2:2, native DTD count
+
+    // Video data block
+    uint8_t vic_count;
+    uint8_t vics[EDID_CTA_MAX_VICS];
+    uint64_t native_vics;       // bit i set if vics[i] was flagged native
+
+    // Audio and speaker allocation data blocks
+    uint8_t audio_count;
+    struct edid_cta_audio audio[EDID_CTA_MAX_AUDIO];
+    uint8_t has_speaker_allocation;
+    uint8_t speaker_allocation[3];
+
+    // HDMI Licensing vendor specific data block (OUI 00-0C-03)
+    uint8_t has_hdmi;
+    uint16_t physical_address;  // A.B.C.D, one nibble each
+    uint8_t hdmi_flags;         // Supports_AI, deep colour and DVI dual-link bits
+    uint16_t hdmi_max_tmds_mhz;
+
+    // HDMI Forum vendor specific data block (OUI C4-5D-D8)
+    uint8_t has_hdmi_forum;
+    uint8_t hdmi_forum_version;
+    uint16_t hdmi_forum_max_tmds_mhz;
+    uint8_t hdmi_forum_flags;   // SCDC present, RR capable, ...
+    uint8_t hdmi_forum_max_frl; // FRL rate code, 0 = TMDS only
+    uint8_t hdmi_forum_dc_420;  // deep colour 4:2:0 bits
+
+    // Extended tag data blocks
+    uint8_t has_colorimetry;
+    uint16_t colorimetry;       // byte 3 | metadata byte 4 << 8
+    uint8_t has_hdr_static;
+    uint8_t hdr_eotfs;
+    uint8_t hdr_metadata_types;
+    uint8_t hdr_max_luminance;  // raw code values, 0 if absent
+    uint8_t hdr_max_frame_avg;
+    uint8_t hdr_min_luminance;
+    uint8_t y420_vic_count;     // VICs that are only supported as YCbCr 4:2:0
+    uint8_t y420_vics[EDID_CTA_MAX_Y420_VICS];
+    uint8_t has_y420_capability_map;
+    uint64_t y420_capability_map; // bit i set if vics[i] also supports YCbCr 4:2:0
+
+    // Detailed timings after the data block collection
+    uint8_t detailed_timing_count;
+    struct edid_detailed_timing detailed_timings[EDID_CTA_MAX_TIMINGS];
+};
+
+#define EDID_EXTENSION_DISPLAYID 0x70
+#define EDID_DISPLAYID_MAX_TIMINGS 8
+#define EDID_DISPLAYID_MAX_CODES 16
+#define EDID_DISPLAYID_NAME_LENGTH 24
+
+#define EDID_DISPLAYID_CODE_DMT 0
+#define EDID_DISPLAYID_CODE_VIC 1
+#define EDID_DISPLAYID_CODE_HDMI_VIC 2
+
+/**
+ * Tiled display topology block. Tile counts and locations are 1-based here
+ * (the block stores them minus one).
+ */
+struct edid_displayid_tile
+{
+    uint8_t capabilities;       // raw byte 0, bit 7 = single physical enclosure
+    uint8_t horizontal_tiles;
+    uint8_t vertical_tiles;
+    uint8_t horizontal_location;
+    uint8_t vertical_location;
+    uint16_t tile_width;
+    uint16_t tile_height;
+    uint8_t vendor[3];          // same encoding as edid_displayid_info.vendor
+    uint16_t product_code;
+    uint32_t serial_number;
+};
+
+/**
+ * Decoded DisplayID 1.3 / 2.x sections carried in extension blocks (tag 0x70).
+ * Timings use the same structure as the base block descriptors.
+ */
+struct edid_displayid_info
+{
+    uint8_t present;
+    uint8_t version;            // 0x12, 0x13, 0x20, ...
+    uint8_t product_type;       // 1.x display product type, 2.x primary use case
+    uint8_t bad_sections;       // sections skipped for a bad checksum or length
+
+    uint8_t has_product_id;
+    uint8_t vendor[3];          // 1.x: three ASCII PNP ID letters, 2.x: IEEE OUI
+    uint16_t product_code;
+    uint32_t serial_number;
+    uint8_t manufacture_week;
+    uint16_t manufacture_year;
+    char product_name[EDID_DISPLAYID_NAME_LENGTH + 1];
+
+    // Type I (1.x) and Type VII (2.x) detailed timings
+    uint8_t detailed_timing_count;
+    uint8_t preferred_timing;   // index into detailed_timings, 0xFF if none is flagged
+    struct edid_detailed_timing detailed_timings[EDID_DISPLAYID_MAX_TIMINGS];
+
+    // Type VIII enumerated timing codes
+    uint8_t timing_code_count;
+    uint8_t timing_code_types[EDID_DISPLAYID_MAX_CODES];   // EDID_DISPLAYID_CODE_*
+    uint16_t timing_codes[EDID_DISPLAYID_MAX_CODES];
+
+    uint8_t has_tile;
+    struct edid_displayid_tile tile;
+};
+
+/**
+ * Decoded extension blocks following the base block.
+ */
+struct edid_ext_info
+{
+    uint8_t block_count;        // extension count announced in byte 126
+    uint8_t blocks_decoded;
+    uint8_t bad_checksums;      // extension blocks skipped for a bad checksum
+    struct edid_cta_info cta;
+    struct edid_displayid_info displayid;
+};
+
+/**
+ * Incremental decoder for EDID blocks arriving one at a time, e.g. from
+ * consecutive DDC reads. Block 0 is decoded as soon as it is pushed.
+ */
+struct edid_stream
+{
+    struct edid_info base;
+    struct edid_ext_info ext;
+    uint16_t blocks_expected;   // 1 + byte 126, known once block 0 arrives
+    uint16_t blocks_received;
+};
+
+#define EDID_STREAM_ERROR (-1)
+#define EDID_STREAM_COMPLETE 0
+#define EDID_STREAM_MORE 1
+
+// Sections of an EDID, as reported by edid_section_diff() and edid_reparse()
+#define EDID_SECTION_HEADER 0x001        // bytes 0-7
+#define EDID_SECTION_VENDOR 0x002        // bytes 8-17
+#define EDID_SECTION_VERSION 0x004       // bytes 18-19
+#define EDID_SECTION_BASIC 0x008         // bytes 20-24
+#define EDID_SECTION_CHROMATICITY 0x010  // bytes 25-34
+#define EDID_SECTION_TIMINGS 0x020       // bytes 35-53, established and standard timings
+#define EDID_SECTION_DESCRIPTORS 0x040   // bytes 54-125
+#define EDID_SECTION_CHECKSUM 0x080      // byte 127
+#define EDID_SECTION_EXTENSIONS 0x100    // byte 126 and the extension blocks
+#define EDID_SECTION_ALL 0x1FF
+
+// Output formats for parse_edid_blocks_as()
+#define EDID_FORMAT_TEXT 0
+#define EDID_FORMAT_JSON 1
+#define EDID_FORMAT_CSV 2
+
+#define EDID_RECORD_MAGIC 0x43524445u   // "EDRC" as little-endian bytes
+#define EDID_RECORD_VERSION 1
+
+// edid_record.flags
+#define EDID_RECORD_HEADER_VALID 0x01
+#define EDID_RECORD_CHECKSUM_VALID 0x02
+#define EDID_RECORD_RANGE_LIMITS 0x04
+#define EDID_RECORD_EXTENSIONS 0x08   // an edid_record_ext follows the base record
+
+// edid_record_ext.flags
+#define EDID_RECORD_CTA 0x01
+#define EDID_RECORD_HDMI 0x02
+#define EDID_RECORD_HDMI_FORUM 0x04
+#define EDID_RECORD_HDR_STATIC 0x08
+#define EDID_RECORD_DISPLAYID 0x10
+#define EDID_RECORD_TILE 0x20
+
+/**
+ * Fixed-layout binary form of struct edid_info, little-endian on disk. Every
+ * field sits at its natural alignment with no padding, so on a little-endian
+ * host a record is loaded with one memcpy. The scalar fields are stored
+ * decoded; chromaticity, standard timings and the four descriptors keep their
+ * EDID byte layout and are decoded by edid_record_read().
+ */
+struct edid_record
+{
+    uint32_t magic;
+    uint8_t version;
+    uint8_t flags;                      // EDID_RECORD_* bits
+    uint16_t length;                    // bytes including any extension section
+    uint32_t serial_number;
+    uint16_t product_code;
+    uint16_t manufacture_year;
+    uint16_t established_timings;
+    uint8_t status;
+    uint8_t manufacture_week;
+    char manufacturer_id[3];
+    uint8_t edid_version;
+    uint8_t edid_revision;
+    uint8_t video_input;
+    uint8_t digital;
+    uint8_t bit_depth;
+    uint8_t interface;
+    uint8_t signal_level;
+    uint8_t video_setup;
+    uint8_t sync_types;
+    uint8_t horizontal_size_cm;
+    uint8_t vertical_size_cm;
+    uint8_t gamma_encoded;
+    uint8_t features;
+    uint8_t display_type;
+    uint8_t manufacturer_timings;
+    uint8_t chromaticity[10];           // as EDID bytes 25-34
+    uint8_t standard_timings[EDID_STANDARD_TIMING_COUNT][2];    // as bytes 38-53, used slots first
+    uint8_t descriptors[EDID_DESCRIPTOR_COUNT][18];             // as bytes 54-125
+};
+
+/**
+ * Optional extension section: the summary of the extension blocks that
+ * downstream consumers use, not every decoded field. Short Audio Descriptors
+ * keep their 3-byte CTA-861 layout. CTA and DisplayID detailed timings are
+ * not carried and read back as zero.
+ */
+struct edid_record_ext
+{
+    uint8_t block_count;
+    uint8_t blocks_decoded;
+    uint8_t bad_checksums;
+    uint8_t flags;                      // EDID_RECORD_CTA, ...
+    uint8_t cta_revision;
+    uint8_t cta_flags;
+    uint8_t vic_count;
+    uint8_t audio_count;
+    uint16_t physical_address;
+    uint16_t hdmi_max_tmds_mhz;
+    uint16_t hdmi_forum_max_tmds_mhz;
+    uint8_t hdr_eotfs;
+    uint8_t hdr_metadata_types;
+    uint64_t native_vics;
+    uint8_t vics[EDID_CTA_MAX_VICS];
+    uint8_t audio[EDID_CTA_MAX_AUDIO][3];
+    uint8_t displayid_version;
+    uint8_t horizontal_tiles;
+    uint8_t vertical_tiles;
+    uint8_t horizontal_tile_location;
+    uint8_t vertical_tile_location;
+    uint8_t reserved;
+    uint16_t tile_width;
+    uint16_t tile_height;
+    uint8_t reserved2[6];
+};
+
+#define EDID_RECORD_BASE_SIZE sizeof(struct edid_record)
+#define EDID_RECORD_MAX_SIZE (sizeof(struct edid_record) + sizeof(struct edid_record_ext))
+
+/**
+ * Video format for a CTA-861 VIC.
+ */
+struct edid_cta_vic
+{
+    uint8_t vic;
+    uint8_t interlaced;
+    uint16_t width;
+    uint16_t height;
+    uint16_t refresh;           // Hz
+};
+
+// edid_mode.sources: where a mode was advertised
+#define EDID_MODE_ESTABLISHED 0x01
+#define EDID_MODE_STANDARD 0x02
+#define EDID_MODE_DETAILED 0x04         // base block detailed timing
+#define EDID_MODE_CTA_VIC 0x08
+#define EDID_MODE_CTA_DETAILED 0x10
+#define EDID_MODE_DISPLAYID 0x20
+#define EDID_MODE_PREFERRED 0x80        // first detailed timing, a native VIC or the DisplayID preferred timing
+
+#define EDID_MODE_SET_MAX 192
+
+/**
+ * One supported video mode. Refresh is rounded to whole hertz, so 59.94 Hz
+ * and 60 Hz variants count as the same mode; interlaced modes give the frame
+ * height and the field rate.
+ */
+struct edid_mode
+{
+    uint16_t width;
+    uint16_t height;
+    uint16_t refresh;
+    uint8_t interlaced;
+    uint8_t sources;            // EDID_MODE_* bits
+};
+
+/**
+ * Every mode an EDID advertises, deduplicated and sorted by width, height,
+ * refresh, progressive before interlaced. keys[i] packs mode i so that
+ * comparing keys compares modes.
+ */
+struct edid_mode_set
+{
+    uint16_t count;
+    uint64_t keys[EDID_MODE_SET_MAX];
+    uint8_t sources[EDID_MODE_SET_MAX];
+};
+
+/**
+ * Read-only view of a raw EDID. The header and checksum are checked once by
+ * edid_view_init(); the edid_* accessors then decode only the field asked
+ * for, straight from the bytes, without filling a struct edid_info.
+ */
+struct edid_view
+{
+    const unsigned char *data;
+    size_t length;
+    uint8_t status;             // EDID_STATUS_* bits of the base block
+};
+
+/**
+ * Bounded text output used by the formatters. A sink with a NULL buffer only
+ * counts the bytes that would have been written.
+ */
+struct edid_sink
+{
+    char *buffer;
+    size_t capacity;
+    size_t length;      // bytes produced so far, including any that did not fit
+    uint8_t truncated;
+};
+
+#define EDID_SINK_LITERAL(sink, literal) edid_sink_write((sink), (literal), sizeof(literal) - 1)
+
+void edid_sink_init(struct edid_sink *sink, char *buffer, size_t capacity);
+void edid_sink_write(struct edid_sink *sink, const char *data, size_t len);
+void edid_sink_puts(struct edid_sink *sink, const char *str);
+void edid_sink_putc(struct edid_sink *sink, char c);
+void edid_sink_putu(struct edid_sink *sink, uint32_t value);
+void edid_sink_puthex(struct edid_sink *sink, uint32_t value, int width);
+void edid_sink_putfixed(struct edid_sink *sink, uint32_t value, int decimals);
+void edid_sink_putchromaticity(struct edid_sink *sink, uint16_t value);
+void edid_sink_putgamma(struct edid_sink *sink, uint8_t gamma_encoded, int decimals);
+
+#define EDID_CPU_SSE2 0x01
+#define EDID_CPU_AVX2 0x02
+
+int edid_cpu_features(void);
+
+#define EDID_HEX_NO_ERROR ((size_t)-1)
+
+size_t edid_hex_decode(const char *hex, size_t len, unsigned char *out, size_t capacity, size_t *error_pos);
+
+/*
+ * The functions below keep no state between calls and only write to the
+ * buffers passed in, so they may be called concurrently from any thread.
+ */
 int check_header(const unsigned char *edid);
-void parse_manufacturer_id(const unsigned char *edid, char *output, int *offset);
-void parse_product_code(const unsigned char *edid, char *output, int *offset);
-void parse_serial_number(const unsigned char *edid, char *output, int *offset);
-void parse_manufacture_date(const unsigned char *edid, char *output, int *offset);
-void parse_edid_version(const unsigned char *edid, char *output, int *offset);
-void parse_video_input(const unsigned char *edid, char *output, int *offset);
-void parse_screen_size(const unsigned char *edid, char *output, int *offset);
-void parse_display_gamma(const unsigned char *edid, char *output, int *offset);
-void parse_supported_features(const unsigned char *edid, char *output, int *offset);
-void parse_colour_characteristics(const unsigned char *edid, char *output, int *offset);
-void parse_established_timings(const unsigned char *edid, char *output, int *offset);
-void parse_standard_timings(const unsigned char *edid, char *output, int *offset);
-unsigned char *string_to_hex(const char *hex_string);
-void parse_edid_string(const char *hex_string, char *output);
-void parse_edid_array(const unsigned char *edid, char *output);
-void write_parsed_edid_data(unsigned int tx_id, const char *parsed_output);
+int parse_edid_struct(const unsigned char *edid, struct edid_info *info);
+int edid_view_init(struct edid_view *view, const unsigned char *data, size_t length);
+void edid_vendor(const struct edid_view *view, char id[4]);
+uint16_t edid_product(const struct edid_view *view);
+uint32_t edid_serial(const struct edid_view *view);
+uint8_t edid_manufacture_week(const struct edid_view *view);
+uint16_t edid_manufacture_year(const struct edid_view *view);
+uint8_t edid_version(const struct edid_view *view);
+uint8_t edid_revision(const struct edid_view *view);
+uint8_t edid_video_input(const struct edid_view *view);
+uint8_t edid_screen_width_cm(const struct edid_view *view);
+uint8_t edid_screen_height_cm(const struct edid_view *view);
+uint8_t edid_gamma(const struct edid_view *view);
+uint8_t edid_features(const struct edid_view *view);
+void edid_chromaticity_points(const struct edid_view *view, struct edid_chromaticity *points);
+uint16_t edid_established(const struct edid_view *view);
+uint8_t edid_manufacturer_timings(const struct edid_view *view);
+int edid_std_timing(const struct edid_view *view, int index, struct edid_standard_timing *timing);
+uint8_t edid_descriptor_tag(const struct edid_view *view, int index);
+int edid_detailed_timing(const struct edid_view *view, int index, struct edid_detailed_timing *timing);
+int edid_descriptor_text(const struct edid_view *view, int index, char text[EDID_DESCRIPTOR_TEXT_LENGTH + 1]);
+int edid_descriptor_range_limits(const struct edid_view *view, int index, struct edid_range_limits *range);
+int edid_monitor_name(const struct edid_view *view, char name[EDID_DESCRIPTOR_TEXT_LENGTH + 1]);
+uint8_t edid_extension_count(const struct edid_view *view);
+const char *edid_pnp_name(uint16_t id);
+const char *edid_pnp_lookup(const char *manufacturer_id);
+const char *edid_vendor_name(const struct edid_view *view);
+int edid_header_valid(const uint8_t *block);
+uint8_t edid_block_sum(const uint8_t *block);
+void edid_validate_blocks(const uint8_t *blocks, size_t count, uint8_t *status);
+size_t parse_edid_batch(const uint8_t *blocks, size_t count, struct edid_info *out);
+unsigned int edid_section_diff(const unsigned char *old_data, size_t old_length, const unsigned char *data, size_t length);
+unsigned int edid_reparse(const unsigned char *old_data, size_t old_length, const unsigned char *data, size_t length,
+                          struct edid_info *info, struct edid_ext_info *ext);
+unsigned int edid_info_diff(const struct edid_info *a, const struct edid_ext_info *a_ext, const struct edid_info *b,
+                            const struct edid_ext_info *b_ext);
+void format_edid_info(const struct edid_info *info, struct edid_sink *sink);
+void parse_manufacturer_id(const unsigned char *edid, struct edid_sink *sink);
+void parse_product_code(const unsigned char *edid, struct edid_sink *sink);
+void parse_serial_number(const unsigned char *edid, struct edid_sink *sink);
+void parse_manufacture_date(const unsigned char *edid, struct edid_sink *sink);
+void parse_edid_version(const unsigned char *edid, struct edid_sink *sink);
+void parse_video_input(const unsigned char *edid, struct edid_sink *sink);
+void parse_screen_size(const unsigned char *edid, struct edid_sink *sink);
+void parse_display_gamma(const unsigned char *edid, struct edid_sink *sink);
+void parse_supported_features(const unsigned char *edid, struct edid_sink *sink);
+void parse_colour_characteristics(const unsigned char *edid, struct edid_sink *sink);
+void parse_established_timings(const unsigned char *edid, struct edid_sink *sink);
+void parse_standard_timings(const unsigned char *edid, struct edid_sink *sink);
+int edid_decode_detailed_timing(const unsigned char *dtd, struct edid_detailed_timing *timing);
+uint32_t edid_timing_refresh_mhz(const struct edid_detailed_timing *timing);
+void format_timing_summary(const struct edid_detailed_timing *timing, struct edid_sink *sink);
+void parse_descriptors(const unsigned char *edid, struct edid_sink *sink);
+const unsigned char *edid_extension_block(const unsigned char *data, size_t length, unsigned int index);
+void edid_stream_init(struct edid_stream *stream);
+int edid_stream_push(struct edid_stream *stream, const unsigned char *block);
+int parse_edid_extensions(const unsigned char *data, size_t length, struct edid_ext_info *ext);
+void format_edid_extensions(const struct edid_ext_info *ext, struct edid_sink *sink);
+size_t parse_edid_blocks(const unsigned char *data, size_t length, char *output, size_t capacity);
+void parse_cta_block(const unsigned char *block, struct edid_cta_info *cta);
+void format_cta_info(const struct edid_cta_info *cta, struct edid_sink *sink);
+const struct edid_cta_vic *edid_cta_vic_lookup(uint8_t vic);
+void parse_displayid_block(const unsigned char *block, struct edid_displayid_info *displayid);
+void format_displayid_info(const struct edid_displayid_info *displayid, struct edid_sink *sink);
+int edid_format_from_name(const char *name);
+void format_edid_json(const struct edid_info *info, const struct edid_ext_info *ext, struct edid_sink *sink);
+void format_edid_csv_header(struct edid_sink *sink);
+void format_edid_csv_row(const struct edid_info *info, const struct edid_ext_info *ext, struct edid_sink *sink);
+void format_edid_as(const struct edid_info *info, const struct edid_ext_info *ext, int format, struct edid_sink *sink);
+size_t parse_edid_blocks_as(const unsigned char *data, size_t length, int format, char *output, size_t capacity);
+size_t edid_record_write(const struct edid_info *info, const struct edid_ext_info *ext, unsigned char *out, size_t capacity);
+size_t edid_record_read(const unsigned char *data, size_t length, struct edid_info *info, struct edid_ext_info *ext);
+uint64_t edid_mode_key(uint16_t width, uint16_t height, uint16_t refresh, int interlaced);
+void edid_mode_set_build(const struct edid_info *info, const struct edid_ext_info *ext, struct edid_mode_set *set);
+void edid_mode_set_get(const struct edid_mode_set *set, size_t index, struct edid_mode *mode);
+int edid_mode_set_find(const struct edid_mode_set *set, uint64_t key);
+int edid_mode_set_contains(const struct edid_mode_set *set, uint16_t width, uint16_t height, uint16_t refresh, int interlaced);
+size_t edid_mode_set_intersect(const struct edid_mode_set *const *sets, size_t count, struct edid_mode_set *out);
+int edid_mode_set_best(const struct edid_mode_set *set, struct edid_mode *mode);
+size_t string_to_hex(const char *hex_string, unsigned char *edid, size_t capacity);
+size_t parse_edid_string(const char *hex_string, char *output, size_t capacity);
+size_t parse_edid_array(const unsigned char *edid, char *output, size_t capacity);
+int write_parsed_edid_data(unsigned int tx_id, const struct edid_info *info, const struct edid_ext_info *ext);
 void write_to_file_once(const char *filename, const char *data);
-void float_to_string(float value, char* float_string);
 int verify_edid_checksum(const unsigned char *edid);
 
-#endif
\ No newline at end of file
+#endif
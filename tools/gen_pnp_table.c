@@ -0,0 +1,114 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+/**
+ * Generates parser/edid_pnp_table.h, the manufacturer name table behind
+ * edid_pnp_name(), from the checked-in registry data/pnp_ids.txt:
+ *
+ *     gcc tools/gen_pnp_table.c -o gen_pnp_table
+ *     ./gen_pnp_table data/pnp_ids.txt > parser/edid_pnp_table.h
+ *
+ * The table is indexed directly by the 15-bit ID packed in EDID bytes 8-9
+ * and holds offsets into one string pool, offset 0 being the empty string
+ * of unassigned IDs.
+ */
+
+#define PNP_ID_COUNT 0x8000
+#define PNP_POOL_MAX (1u << 20)
+#define PNP_NAME_MAX 128
+
+static uint32_t offsets[PNP_ID_COUNT];
+static char pool[PNP_POOL_MAX];
+
+int main(int argc, char **argv)
+{
+    FILE *file = argc > 1 ? fopen(argv[1], "r") : stdin;
+    char line[256];
+    uint32_t pool_length = 1; // pool[0] is the empty name
+    unsigned int entries = 0, line_number = 0;
+
+    if (!file)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+
+    while (fgets(line, sizeof(line), file))
+    {
+        size_t length = strcspn(line, "\r\n");
+        line_number++;
+        line[length] = '\0';
+        if (length == 0 || line[0] == '#')
+        {
+            continue;
+        }
+
+        int valid = length > 4 && line[3] == '\t' && length - 4 < PNP_NAME_MAX;
+        for (int k = 0; k < 3 && valid; k++)
+        {
+            valid = line[k] >= 'A' && line[k] <= 'Z';
+        }
+        if (!valid)
+        {
+            fprintf(stderr, "line %u: expected a three-letter ID, a tab and a name\n", line_number);
+            return 1;
+        }
+
+        unsigned int id = ((line[0] - '@') << 10) | ((line[1] - '@') << 5) | (line[2] - '@');
+        if (offsets[id])
+        {
+            fprintf(stderr, "line %u: duplicate ID %.3s\n", line_number, line);
+            return 1;
+        }
+        if (pool_length + (length - 4) + 1 > PNP_POOL_MAX)
+        {
+            fprintf(stderr, "line %u: names exceed %u bytes\n", line_number, PNP_POOL_MAX);
+            return 1;
+        }
+        offsets[id] = pool_length;
+        memcpy(pool + pool_length, line + 4, length - 4 + 1);
+        pool_length += (uint32_t)(length - 4) + 1;
+        entries++;
+    }
+
+    printf("#ifndef EDID_PNP_TABLE_H\n");
+    printf("#define EDID_PNP_TABLE_H\n\n");
+    printf("/*\n * Generated by tools/gen_pnp_table.c from data/pnp_ids.txt; do not edit.\n */\n\n");
+    printf("#include <stdint.h>\n\n");
+
+    // 16-bit offsets halve the table as long as the names fit in 64 KiB
+    printf("typedef %s edid_pnp_offset;\n\n", pool_length <= 0xFFFF ? "uint16_t" : "uint32_t");
+
+    printf("// %u manufacturer names, NUL separated; offset 0 is the empty name\n", entries);
+    printf("static const char pnp_names[%u] =\n", pool_length);
+    for (uint32_t start = 0; start < pool_length;)
+    {
+        uint32_t end = start + (uint32_t)strlen(pool + start);
+
+        printf("    \"");
+        for (uint32_t k = start; k < end; k++)
+        {
+            printf(pool[k] == '"' || pool[k] == '\\' ? "\\%c" : "%c", pool[k]);
+        }
+        printf(end + 1 < pool_length ? "\\0\"\n" : "\";\n");
+        start = end + 1;
+    }
+
+    printf("\n// Offset into pnp_names of each packed ID (bytes 8-9, bit 15 clear)\n");
+    printf("static const edid_pnp_offset pnp_name_offsets[%d] = {\n", PNP_ID_COUNT);
+    for (unsigned int id = 0; id < PNP_ID_COUNT; id++)
+    {
+        if (offsets[id])
+        {
+            printf("    [0x%04X] = %u, // %c%c%c\n", id, offsets[id], '@' + (id >> 10), '@' + ((id >> 5) & 0x1F),
+                   '@' + (id & 0x1F));
+        }
+    }
+    printf("};\n\n#endif\n");
+
+    if (file != stdin)
+    {
+        fclose(file);
+    }
+    return 0;
+}
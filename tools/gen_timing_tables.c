@@ -0,0 +1,101 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+/**
+ * Generates parser/edid_timing_tables.h, the lookup tables behind the
+ * established and standard timing decoders:
+ *
+ *     gcc tools/gen_timing_tables.c -o gen_timing_tables
+ *     ./gen_timing_tables > parser/edid_timing_tables.h
+ */
+
+static const char *established_timings[] = {
+    "720x400 @ 70Hz", "720x400 @ 88Hz", "640x480 @ 60Hz", "640x480 @ 67Hz", "640x480 @ 72Hz", "640x480 @ 75Hz", "800x600 @ 56Hz", "800x600 @ 60Hz",
+
+    "800x600 @ 72Hz", "800x600 @ 75Hz", "832x624 @ 75Hz", "1024x768 @ 87Hz (interlaced)", "1024x768 @ 60Hz", "1024x768 @ 70Hz", "1024x768 @ 75Hz", "1280x1024 @ 75Hz"};
+
+static const char *aspect_ratios[] = {"16:10", "4:3", "5:4", "16:9"};
+
+/**
+ * Vertical resolution of a standard timing, computed the way the decoder did
+ * before it used these tables.
+ */
+static int standard_timing_height(int width, int aspect)
+{
+    switch (aspect)
+    {
+    case 0:
+        return width * 10 / 16; // 16:10
+    case 1:
+        return width * 3 / 4;   // 4:3
+    case 2:
+        return width * 4 / 5;   // 5:4
+    default:
+        return width * 9 / 16;  // 16:9
+    }
+}
+
+int main(void)
+{
+    printf("#ifndef EDID_TIMING_TABLES_H\n");
+    printf("#define EDID_TIMING_TABLES_H\n\n");
+    printf("/*\n * Generated by tools/gen_timing_tables.c; do not edit.\n */\n\n");
+    printf("#include <stdint.h>\n\n");
+
+    printf("struct edid_timing_line\n{\n    uint8_t length;\n    char text[34];\n};\n\n");
+    printf("struct edid_standard_timing_entry\n{\n    uint16_t width;\n    uint16_t height;\n    uint8_t length;\n    char text[20];\n};\n\n");
+
+    // One pre-rendered report line per established timing bit, bit 15 (byte 35 bit 7) first
+    printf("// Report lines for the established timing bits, index 0 being bit 15\n");
+    printf("static const struct edid_timing_line established_timing_lines[16] = {\n");
+    for (int i = 0; i < 16; i++)
+    {
+        char line[64];
+        int length = snprintf(line, sizeof(line), " - %s\n", established_timings[i]);
+
+        printf("    {%d, \"", length);
+        for (int k = 0; k < length; k++)
+        {
+            printf(line[k] == '\n' ? "\\n" : "%c", line[k]);
+        }
+        printf("\"},\n");
+    }
+    printf("};\n\n");
+
+    // Position of the highest set bit, counted from bit 7, so set bits are visited high to low
+    printf("// Number of leading zero bits of each byte value; 8 for zero\n");
+    printf("static const uint8_t leading_zeros8[256] = {");
+    for (int value = 0; value < 256; value++)
+    {
+        int zeros = 0;
+
+        while (zeros < 8 && !(value & (0x80 >> zeros)))
+        {
+            zeros++;
+        }
+        printf("%s%d,", value % 32 == 0 ? "\n    " : " ", zeros);
+    }
+    printf("\n};\n\n");
+
+    // Standard timings: everything but the refresh depends on byte 1 and the aspect bits
+    printf("// Standard timings by [aspect bits][byte 1]: resolution and \"W x H (aspect)\"\n");
+    printf("static const struct edid_standard_timing_entry standard_timing_table[4][256] = {\n");
+    for (int aspect = 0; aspect < 4; aspect++)
+    {
+        printf("    {\n");
+        for (int byte1 = 0; byte1 < 256; byte1++)
+        {
+            int width = (byte1 + 31) * 8;
+            int height = standard_timing_height(width, aspect);
+            char text[32];
+            int length = snprintf(text, sizeof(text), "%d x %d (%s)", width, height, aspect_ratios[aspect]);
+
+            printf("        {%d, %d, %d, \"%s\"},\n", width, height, length, text);
+        }
+        printf("    },\n");
+    }
+    printf("};\n\n");
+
+    printf("#endif\n");
+    return 0;
+}